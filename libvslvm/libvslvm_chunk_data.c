@@ -25,6 +25,7 @@
 #include <types.h>
 
 #include "libvslvm_chunk_data.h"
+#include "libvslvm_chunk_data_pool.h"
 #include "libvslvm_definitions.h"
 #include "libvslvm_libbfio.h"
 #include "libvslvm_libcerror.h"
@@ -39,7 +40,8 @@ int libvslvm_chunk_data_initialize(
      size_t data_size,
      libcerror_error_t **error )
 {
-	static char *function = "libvslvm_chunk_data_initialize";
+	static char *function    = "libvslvm_chunk_data_initialize";
+	size_t alignment_padding = 0;
 
 	if( chunk_data == NULL )
 	{
@@ -64,7 +66,7 @@ int libvslvm_chunk_data_initialize(
 		return( -1 );
 	}
 	if( ( data_size == 0 )
-	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	 || ( data_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - LIBVSLVM_CHUNK_DATA_ALIGNMENT ) ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -108,10 +110,12 @@ int libvslvm_chunk_data_initialize(
 
 		return( -1 );
 	}
-	( *chunk_data )->data = (uint8_t *) memory_allocate(
-	                                     sizeof( uint8_t ) * data_size );
+	/* The data is over allocated so that it can be aligned
+	 */
+	( *chunk_data )->allocated_data = (uint8_t *) memory_allocate(
+	                                               sizeof( uint8_t ) * ( data_size + LIBVSLVM_CHUNK_DATA_ALIGNMENT - 1 ) );
 
-	if( ( *chunk_data )->data == NULL )
+	if( ( *chunk_data )->allocated_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -122,6 +126,13 @@ int libvslvm_chunk_data_initialize(
 
 		goto on_error;
 	}
+	alignment_padding = (size_t) ( (intptr_t) ( *chunk_data )->allocated_data % LIBVSLVM_CHUNK_DATA_ALIGNMENT );
+
+	if( alignment_padding != 0 )
+	{
+		alignment_padding = LIBVSLVM_CHUNK_DATA_ALIGNMENT - alignment_padding;
+	}
+	( *chunk_data )->data      = &( ( ( *chunk_data )->allocated_data )[ alignment_padding ] );
 	( *chunk_data )->data_size = data_size;
 
 	return( 1 );
@@ -138,6 +149,7 @@ on_error:
 }
 
 /* Frees a chunk data
+ * Chunk data that was created by a chunk data pool is released to the pool instead
  * Returns 1 if successful or -1 on error
  */
 int libvslvm_chunk_data_free(
@@ -160,6 +172,24 @@ int libvslvm_chunk_data_free(
 	}
 	if( *chunk_data != NULL )
 	{
+		if( ( *chunk_data )->chunk_data_pool != NULL )
+		{
+			if( libvslvm_chunk_data_pool_release_chunk_data(
+			     ( *chunk_data )->chunk_data_pool,
+			     chunk_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release chunk data to pool.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
 		if( memory_set(
 		     ( *chunk_data )->data,
 		     0,
@@ -175,7 +205,7 @@ int libvslvm_chunk_data_free(
 			result = -1;
 		}
 		memory_free(
-		 ( *chunk_data )->data );
+		 ( *chunk_data )->allocated_data );
 
 		memory_free(
 		 *chunk_data );
@@ -230,29 +260,12 @@ int libvslvm_chunk_data_read_file_io_pool(
 		 chunk_offset );
 	}
 #endif
-	if( libbfio_pool_seek_offset(
-	     file_io_pool,
-	     file_io_pool_entry,
-	     chunk_offset,
-	     SEEK_SET,
-	     error ) == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek chunk data offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 chunk_offset,
-		 chunk_offset );
-
-		return( -1 );
-	}
-	read_count = libbfio_pool_read_buffer(
+	read_count = libbfio_pool_read_buffer_at_offset(
 		      file_io_pool,
 		      file_io_pool_entry,
 		      chunk_data->data,
 		      chunk_data->data_size,
+		      chunk_offset,
 		      error );
 
 	if( read_count != (ssize_t) chunk_data->data_size )
@@ -261,8 +274,10 @@ int libvslvm_chunk_data_read_file_io_pool(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read chunk data.",
-		 function );
+		 "%s: unable to read chunk data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 chunk_offset,
+		 chunk_offset );
 
 		return( -1 );
 	}
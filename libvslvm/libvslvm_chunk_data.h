@@ -33,9 +33,14 @@ extern "C" {
 #endif
 
 typedef struct libvslvm_chunk_data libvslvm_chunk_data_t;
+typedef struct libvslvm_chunk_data_pool libvslvm_chunk_data_pool_t;
 
 struct libvslvm_chunk_data
 {
+	/* The allocated data, which contains the aligned data
+	 */
+	uint8_t *allocated_data;
+
 	/* The data
 	 */
 	uint8_t *data;
@@ -43,6 +48,10 @@ struct libvslvm_chunk_data
 	/* The data size
 	 */
 	size_t data_size;
+
+	/* The chunk data pool the chunk data is released to when freed
+	 */
+	libvslvm_chunk_data_pool_t *chunk_data_pool;
 };
 
 int libvslvm_chunk_data_initialize(
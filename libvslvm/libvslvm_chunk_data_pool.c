@@ -0,0 +1,580 @@
+/*
+ * Chunk data pool functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libvslvm_chunk_data.h"
+#include "libvslvm_chunk_data_pool.h"
+#include "libvslvm_libcerror.h"
+#include "libvslvm_libcthreads.h"
+
+/* Creates a chunk data pool
+ * Make sure the value chunk_data_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_chunk_data_pool_initialize(
+     libvslvm_chunk_data_pool_t **chunk_data_pool,
+     size_t data_size,
+     int maximum_number_of_free_chunk_data,
+     uint8_t wipe_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libvslvm_chunk_data_pool_initialize";
+
+	if( chunk_data_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_data_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk data pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_free_chunk_data <= 0 )
+	 || ( (size_t) maximum_number_of_free_chunk_data > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libvslvm_chunk_data_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of free chunk data value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*chunk_data_pool = memory_allocate_structure(
+	                    libvslvm_chunk_data_pool_t );
+
+	if( *chunk_data_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk data pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *chunk_data_pool,
+	     0,
+	     sizeof( libvslvm_chunk_data_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk data pool.",
+		 function );
+
+		memory_free(
+		 *chunk_data_pool );
+
+		*chunk_data_pool = NULL;
+
+		return( -1 );
+	}
+	( *chunk_data_pool )->free_chunk_data = (libvslvm_chunk_data_t **) memory_allocate(
+	                                                                    sizeof( libvslvm_chunk_data_t * ) * maximum_number_of_free_chunk_data );
+
+	if( ( *chunk_data_pool )->free_chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create free chunk data.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *chunk_data_pool )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *chunk_data_pool )->data_size                         = data_size;
+	( *chunk_data_pool )->maximum_number_of_free_chunk_data = maximum_number_of_free_chunk_data;
+	( *chunk_data_pool )->wipe_data                         = wipe_data;
+
+	return( 1 );
+
+on_error:
+	if( *chunk_data_pool != NULL )
+	{
+		if( ( *chunk_data_pool )->free_chunk_data != NULL )
+		{
+			memory_free(
+			 ( *chunk_data_pool )->free_chunk_data );
+		}
+		memory_free(
+		 *chunk_data_pool );
+
+		*chunk_data_pool = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a chunk data pool
+ * The chunk data currently handed out by the pool must have been released before
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_chunk_data_pool_free(
+     libvslvm_chunk_data_pool_t **chunk_data_pool,
+     libcerror_error_t **error )
+{
+	libvslvm_chunk_data_t *chunk_data = NULL;
+	static char *function             = "libvslvm_chunk_data_pool_free";
+	int chunk_data_index              = 0;
+	int result                        = 1;
+
+	if( chunk_data_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_data_pool != NULL )
+	{
+		/* The free chunk data was already wiped on release if required
+		 */
+		for( chunk_data_index = 0;
+		     chunk_data_index < ( *chunk_data_pool )->number_of_free_chunk_data;
+		     chunk_data_index++ )
+		{
+			chunk_data = ( *chunk_data_pool )->free_chunk_data[ chunk_data_index ];
+
+			memory_free(
+			 chunk_data->allocated_data );
+
+			memory_free(
+			 chunk_data );
+		}
+		memory_free(
+		 ( *chunk_data_pool )->free_chunk_data );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *chunk_data_pool )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+
+		memory_free(
+		 *chunk_data_pool );
+
+		*chunk_data_pool = NULL;
+	}
+	return( result );
+}
+
+/* Sets the value to indicate the chunk data should be wiped when released
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_chunk_data_pool_set_wipe_data(
+     libvslvm_chunk_data_pool_t *chunk_data_pool,
+     uint8_t wipe_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libvslvm_chunk_data_pool_set_wipe_data";
+
+	if( chunk_data_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data pool.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     chunk_data_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	chunk_data_pool->wipe_data = wipe_data;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     chunk_data_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves chunk data from the pool
+ * Chunk data is reused if available otherwise it is created
+ * Chunk data of a size other than the pool data size is not pooled
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_chunk_data_pool_get_chunk_data(
+     libvslvm_chunk_data_pool_t *chunk_data_pool,
+     size_t data_size,
+     libvslvm_chunk_data_t **chunk_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libvslvm_chunk_data_pool_get_chunk_data";
+
+	if( chunk_data_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk data value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     chunk_data_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( data_size == chunk_data_pool->data_size )
+	 && ( chunk_data_pool->number_of_free_chunk_data > 0 ) )
+	{
+		chunk_data_pool->number_of_free_chunk_data -= 1;
+
+		*chunk_data = chunk_data_pool->free_chunk_data[ chunk_data_pool->number_of_free_chunk_data ];
+
+		chunk_data_pool->free_chunk_data[ chunk_data_pool->number_of_free_chunk_data ] = NULL;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     chunk_data_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( *chunk_data != NULL )
+	{
+		return( 1 );
+	}
+	/* The chunk data is created outside the mutex
+	 */
+	if( libvslvm_chunk_data_initialize(
+	     chunk_data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == chunk_data_pool->data_size )
+	{
+		( *chunk_data )->chunk_data_pool = chunk_data_pool;
+	}
+	return( 1 );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+on_error:
+	if( *chunk_data != NULL )
+	{
+		memory_free(
+		 ( *chunk_data )->allocated_data );
+
+		memory_free(
+		 *chunk_data );
+
+		*chunk_data = NULL;
+	}
+	return( -1 );
+#endif
+}
+
+/* Releases chunk data to the pool
+ * The chunk data is wiped if required and kept for reuse if the pool is not full
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_chunk_data_pool_release_chunk_data(
+     libvslvm_chunk_data_pool_t *chunk_data_pool,
+     libvslvm_chunk_data_t **chunk_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libvslvm_chunk_data_pool_release_chunk_data";
+	uint8_t wipe_data     = 0;
+	int result            = 1;
+
+	if( chunk_data_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_data == NULL )
+	{
+		return( 1 );
+	}
+	if( ( *chunk_data )->data_size != chunk_data_pool->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk data - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     chunk_data_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	wipe_data = chunk_data_pool->wipe_data;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     chunk_data_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The chunk data is wiped outside the mutex
+	 */
+	if( wipe_data != 0 )
+	{
+		if( memory_set(
+		     ( *chunk_data )->data,
+		     0,
+		     ( *chunk_data )->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear data.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     chunk_data_pool->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( chunk_data_pool->number_of_free_chunk_data < chunk_data_pool->maximum_number_of_free_chunk_data )
+		{
+			chunk_data_pool->free_chunk_data[ chunk_data_pool->number_of_free_chunk_data ] = *chunk_data;
+
+			chunk_data_pool->number_of_free_chunk_data += 1;
+
+			*chunk_data = NULL;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     chunk_data_pool->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+	}
+	/* Chunk data that is not kept for reuse is freed
+	 */
+	if( *chunk_data != NULL )
+	{
+		memory_free(
+		 ( *chunk_data )->allocated_data );
+
+		memory_free(
+		 *chunk_data );
+	}
+	*chunk_data = NULL;
+
+	return( result );
+}
+
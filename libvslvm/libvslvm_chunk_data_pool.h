@@ -0,0 +1,101 @@
+/*
+ * Chunk data pool functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSLVM_CHUNK_DATA_POOL_H )
+#define _LIBVSLVM_CHUNK_DATA_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvslvm_chunk_data.h"
+#include "libvslvm_libcerror.h"
+#include "libvslvm_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The chunk data pool keeps released chunk data for reuse
+ * so that a chunk cache miss does not need to allocate new chunk data
+ * The pool is owned by the IO handle and shared by the logical volumes of a handle
+ */
+struct libvslvm_chunk_data_pool
+{
+	/* The data size of the pooled chunk data
+	 */
+	size_t data_size;
+
+	/* The free chunk data
+	 */
+	libvslvm_chunk_data_t **free_chunk_data;
+
+	/* The number of free chunk data
+	 */
+	int number_of_free_chunk_data;
+
+	/* The maximum number of free chunk data
+	 */
+	int maximum_number_of_free_chunk_data;
+
+	/* Value to indicate the chunk data should be wiped when released
+	 */
+	uint8_t wipe_data;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libvslvm_chunk_data_pool_initialize(
+     libvslvm_chunk_data_pool_t **chunk_data_pool,
+     size_t data_size,
+     int maximum_number_of_free_chunk_data,
+     uint8_t wipe_data,
+     libcerror_error_t **error );
+
+int libvslvm_chunk_data_pool_free(
+     libvslvm_chunk_data_pool_t **chunk_data_pool,
+     libcerror_error_t **error );
+
+int libvslvm_chunk_data_pool_set_wipe_data(
+     libvslvm_chunk_data_pool_t *chunk_data_pool,
+     uint8_t wipe_data,
+     libcerror_error_t **error );
+
+int libvslvm_chunk_data_pool_get_chunk_data(
+     libvslvm_chunk_data_pool_t *chunk_data_pool,
+     size_t data_size,
+     libvslvm_chunk_data_t **chunk_data,
+     libcerror_error_t **error );
+
+int libvslvm_chunk_data_pool_release_chunk_data(
+     libvslvm_chunk_data_pool_t *chunk_data_pool,
+     libvslvm_chunk_data_t **chunk_data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSLVM_CHUNK_DATA_POOL_H ) */
+
@@ -40,8 +40,14 @@ struct libvslvm_data_area_descriptor
 	uint64_t offset;
 
 	/* The size
+	 * A size of 0 represents that the data area extends to the end of the physical volume
 	 */
 	uint64_t size;
+
+	/* The data offset
+	 * Contains the offset of the data area relative to the start of the physical volume data
+	 */
+	uint64_t data_offset;
 };
 
 int libvslvm_data_area_descriptor_initialize(
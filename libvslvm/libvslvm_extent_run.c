@@ -0,0 +1,166 @@
+/*
+ * Extent run functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libvslvm_extent_run.h"
+#include "libvslvm_libcerror.h"
+
+/* Creates an extent run
+ * Make sure the value extent_run is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_extent_run_initialize(
+     libvslvm_extent_run_t **extent_run,
+     libcerror_error_t **error )
+{
+	static char *function = "libvslvm_extent_run_initialize";
+
+	if( extent_run == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent run.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extent_run != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid extent run value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*extent_run = memory_allocate_structure(
+	                         libvslvm_extent_run_t );
+
+	if( *extent_run == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create extent run.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *extent_run,
+	     0,
+	     sizeof( libvslvm_extent_run_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear extent run.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *extent_run != NULL )
+	{
+		memory_free(
+		 *extent_run );
+
+		*extent_run = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an extent run
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_extent_run_free(
+     libvslvm_extent_run_t **extent_run,
+     libcerror_error_t **error )
+{
+	static char *function = "libvslvm_extent_run_free";
+
+	if( extent_run == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent run.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extent_run != NULL )
+	{
+		memory_free(
+		 *extent_run );
+
+		*extent_run = NULL;
+	}
+	return( 1 );
+}
+
+/* Compares two extent run references by their physical volume offset
+ * This function is used to sort an array of extent run references with qsort
+ * Returns -1 if less, 0 if equal or 1 if greater
+ */
+int libvslvm_extent_run_compare_references_by_physical_offset(
+     const void *first_extent_run_reference,
+     const void *second_extent_run_reference )
+{
+	const libvslvm_extent_run_t *first_extent_run  = NULL;
+	const libvslvm_extent_run_t *second_extent_run = NULL;
+
+	if( ( first_extent_run_reference == NULL )
+	 || ( second_extent_run_reference == NULL ) )
+	{
+		return( 0 );
+	}
+	first_extent_run  = *( (const libvslvm_extent_run_t **) first_extent_run_reference );
+	second_extent_run = *( (const libvslvm_extent_run_t **) second_extent_run_reference );
+
+	if( ( first_extent_run == NULL )
+	 || ( second_extent_run == NULL ) )
+	{
+		return( 0 );
+	}
+	if( first_extent_run->physical_offset < second_extent_run->physical_offset )
+	{
+		return( -1 );
+	}
+	else if( first_extent_run->physical_offset > second_extent_run->physical_offset )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,84 @@
+/*
+ * Extent run functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSLVM_EXTENT_RUN_H )
+#define _LIBVSLVM_EXTENT_RUN_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvslvm_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libvslvm_extent_run libvslvm_extent_run_t;
+
+/* An extent run maps a range of the logical volume data
+ * onto a contiguous range of a single physical volume
+ */
+struct libvslvm_extent_run
+{
+	/* The (logical volume) offset
+	 */
+	off64_t logical_offset;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The physical volume index
+	 */
+	int physical_volume_index;
+
+	/* The physical volume offset
+	 */
+	off64_t physical_offset;
+
+	/* The logical volume index
+	 * Only used by the allocations of a physical volume
+	 */
+	int logical_volume_index;
+
+	/* The type
+	 */
+	uint8_t type;
+};
+
+int libvslvm_extent_run_initialize(
+     libvslvm_extent_run_t **extent_run,
+     libcerror_error_t **error );
+
+int libvslvm_extent_run_free(
+     libvslvm_extent_run_t **extent_run,
+     libcerror_error_t **error );
+
+int libvslvm_extent_run_compare_references_by_physical_offset(
+     const void *first_extent_run_reference,
+     const void *second_extent_run_reference );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSLVM_EXTENT_RUN_H ) */
+
@@ -26,6 +26,7 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "libvslvm_chunk_data_pool.h"
 #include "libvslvm_data_area_descriptor.h"
 #include "libvslvm_debug.h"
 #include "libvslvm_definitions.h"
@@ -35,10 +36,15 @@
 #include "libvslvm_libcdata.h"
 #include "libvslvm_libcerror.h"
 #include "libvslvm_libcnotify.h"
+#include "libvslvm_logical_volume_values.h"
 #include "libvslvm_metadata.h"
 #include "libvslvm_metadata_area.h"
+#include "libvslvm_physical_volume.h"
 #include "libvslvm_raw_location_descriptor.h"
+#include "libvslvm_segment.h"
+#include "libvslvm_stripe.h"
 #include "libvslvm_types.h"
+#include "libvslvm_volume_group.h"
 
 /* Creates a handle
  * Make sure the value handle is referencing, is set to NULL
@@ -239,6 +245,59 @@ int libvslvm_handle_signal_abort(
 	return( 1 );
 }
 
+/* Sets the value to indicate cached chunk data should be wiped when it is released
+ * The setting applies to chunk data released after it was changed
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_handle_set_wipe_chunk_data(
+     libvslvm_handle_t *handle,
+     uint8_t wipe_chunk_data,
+     libcerror_error_t **error )
+{
+	libvslvm_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libvslvm_handle_set_wipe_chunk_data";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libvslvm_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvslvm_chunk_data_pool_set_wipe_data(
+	     internal_handle->io_handle->chunk_data_pool,
+	     wipe_chunk_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set wipe data in chunk data pool.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Opens a handle
  * Returns 1 if successful or -1 on error
  */
@@ -1505,7 +1564,6 @@ int libvslvm_internal_handle_open_read_data_area_table(
 	libvslvm_physical_volume_t *physical_volume = NULL;
 	libvslvm_volume_group_t *volume_group       = NULL;
 	static char *function                       = "libvslvm_internal_handle_open_read_data_area_table";
-	off64_t file_offset                         = 0;
 	int number_of_file_io_handles               = 0;
 	int number_of_data_area_descriptors         = 0;
 	int number_of_physical_volumes              = 0;
@@ -1613,64 +1671,530 @@ int libvslvm_internal_handle_open_read_data_area_table(
 
 			return( -1 );
 		}
-		/* The physical volume label can be stored in one of the first 4 sectors
-		 */
-		file_offset = 0;
+		if( libvslvm_physical_volume_read_label_file_io_pool(
+		     physical_volume,
+		     file_io_pool,
+		     physical_volume_index,
+		     0,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read physical volume: %d label.",
+			 function,
+			 physical_volume_index );
 
-		while( file_offset < 2048 )
+			return( -1 );
+		}
+		if( libvslvm_physical_volume_get_number_of_data_area_descriptors(
+		     physical_volume,
+		     &number_of_data_area_descriptors,
+		     error ) != 1 )
 		{
-			result = libvslvm_physical_volume_read_label_file_io_pool(
-				  physical_volume,
-				  file_io_pool,
-				  physical_volume_index,
-				  file_offset,
-				  error );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of data area descriptors from array.",
+			 function );
 
-			if( result == -1 )
+			return( -1 );
+		}
+		if( number_of_data_area_descriptors <= 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported number of data area descriptors.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libvslvm_internal_handle_open_build_allocation_tables(
+	     internal_handle,
+	     volume_group,
+	     file_io_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build allocation tables.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Builds the allocation tables of the physical volumes
+ * The allocation table maps the data of a physical volume onto the logical volumes
+ * The allocations are derived from the segments and stripes of the logical volume values
+ * hence the logical volumes do not need to be opened
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_internal_handle_open_build_allocation_tables(
+     libvslvm_internal_handle_t *internal_handle,
+     libvslvm_volume_group_t *volume_group,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error )
+{
+	libvslvm_internal_physical_volume_t *internal_physical_volume = NULL;
+	libvslvm_logical_volume_values_t *logical_volume_values       = NULL;
+	libvslvm_physical_volume_t *physical_volume                   = NULL;
+	static char *function                                         = "libvslvm_internal_handle_open_build_allocation_tables";
+	size64_t volume_size                                          = 0;
+	int logical_volume_index                                      = 0;
+	int number_of_logical_volumes                                 = 0;
+	int number_of_physical_volumes                                = 0;
+	int physical_volume_index                                     = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume group.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvslvm_volume_group_get_number_of_logical_volumes(
+	     volume_group,
+	     &number_of_logical_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of logical volumes.",
+		 function );
+
+		return( -1 );
+	}
+	for( logical_volume_index = 0;
+	     logical_volume_index < number_of_logical_volumes;
+	     logical_volume_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     ( (libvslvm_internal_volume_group_t *) volume_group )->logical_volumes_array,
+		     logical_volume_index,
+		     (intptr_t **) &logical_volume_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve logical volume: %d values.",
+			 function,
+			 logical_volume_index );
+
+			return( -1 );
+		}
+		if( libvslvm_internal_handle_open_append_allocations(
+		     volume_group,
+		     logical_volume_index,
+		     logical_volume_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append allocations of logical volume: %d.",
+			 function,
+			 logical_volume_index );
+
+			return( -1 );
+		}
+	}
+	if( libvslvm_volume_group_get_number_of_physical_volumes(
+	     volume_group,
+	     &number_of_physical_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of physical volumes.",
+		 function );
+
+		return( -1 );
+	}
+	for( physical_volume_index = 0;
+	     physical_volume_index < number_of_physical_volumes;
+	     physical_volume_index++ )
+	{
+		physical_volume = NULL;
+
+		if( libvslvm_volume_group_get_physical_volume(
+		     volume_group,
+		     physical_volume_index,
+		     &physical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve physical volume: %d from volume group.",
+			 function,
+			 physical_volume_index );
+
+			return( -1 );
+		}
+		internal_physical_volume = (libvslvm_internal_physical_volume_t *) physical_volume;
+
+		if( libvslvm_internal_physical_volume_sort_allocations(
+		     internal_physical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to sort physical volume: %d allocations.",
+			 function,
+			 physical_volume_index );
+
+			return( -1 );
+		}
+		/* Fall back to the size of the physical volume file if the metadata
+		 * does not define the device size
+		 */
+		volume_size = internal_physical_volume->size;
+
+		if( volume_size == 0 )
+		{
+			if( libbfio_pool_get_size(
+			     file_io_pool,
+			     internal_physical_volume->volume_index,
+			     &volume_size,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read physical volume label at offset: %" PRIi64 ".",
+				 LIBCERROR_IO_ERROR_GENERIC,
+				 "%s: unable to retrieve physical volume: %d file size.",
 				 function,
-				 file_offset );
+				 physical_volume_index );
 
 				return( -1 );
 			}
-			else if( result != 0 )
-			{
-				break;
-			}
-			file_offset += 512;
 		}
-		if( libvslvm_physical_volume_get_number_of_data_area_descriptors(
-		     physical_volume,
-		     &number_of_data_area_descriptors,
+		if( libvslvm_internal_physical_volume_build_unallocated_extent_runs(
+		     internal_physical_volume,
+		     volume_size,
+		     ( (libvslvm_internal_volume_group_t *) volume_group )->extent_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build physical volume: %d unallocated extent runs.",
+			 function,
+			 physical_volume_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends the allocations of a logical volume to the physical volumes
+ * Every stripe of a segment is allocated on the physical volume it refers to,
+ * where a stripe of a multi stripe segment contains an equal part of the segment
+ * Segments without stripes, such as snapshot segments, do not refer to physical volume data
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_internal_handle_open_append_allocations(
+     libvslvm_volume_group_t *volume_group,
+     int logical_volume_index,
+     libvslvm_logical_volume_values_t *logical_volume_values,
+     libcerror_error_t **error )
+{
+	char physical_volume_name[ 64 ];
+
+	libvslvm_data_area_descriptor_t *data_area_descriptor = NULL;
+	libvslvm_physical_volume_t *physical_volume           = NULL;
+	libvslvm_segment_t *segment                           = NULL;
+	libvslvm_stripe_t *stripe                             = NULL;
+	static char *function                                 = "libvslvm_internal_handle_open_append_allocations";
+	off64_t segment_offset                                = 0;
+	off64_t stripe_offset                                 = 0;
+	size64_t segment_size                                 = 0;
+	size64_t stripe_size                                  = 0;
+	size_t physical_volume_name_length                    = 0;
+	uint8_t allocation_type                               = 0;
+	int number_of_segments                                = 0;
+	int number_of_stripes                                 = 0;
+	int result                                            = 0;
+	int segment_index                                     = 0;
+	int stripe_index                                      = 0;
+
+	if( libvslvm_logical_volume_values_get_number_of_segments(
+	     logical_volume_values,
+	     &number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of segments.",
+		 function );
+
+		return( -1 );
+	}
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		segment = NULL;
+
+		if( libvslvm_logical_volume_values_get_segment(
+		     logical_volume_values,
+		     segment_index,
+		     &segment,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of data area descriptors from array.",
-			 function );
+			 "%s: unable to retrieve segment: %d.",
+			 function,
+			 segment_index );
 
 			return( -1 );
 		}
-		if( number_of_data_area_descriptors <= 0 )
+		if( libvslvm_segment_get_range(
+		     segment,
+		     &segment_offset,
+		     &segment_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment: %d range.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		if( libvslvm_segment_get_number_of_stripes(
+		     segment,
+		     &number_of_stripes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment: %d number of stripes.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		if( number_of_stripes == 0 )
+		{
+			continue;
+		}
+		if( ( segment_size % (size64_t) number_of_stripes ) != 0 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported number of data area descriptors.",
-			 function );
+			 "%s: unsupported segment: %d size: %" PRIu64 " not a multitude of number of stripes: %d.",
+			 function,
+			 segment_index,
+			 segment_size,
+			 number_of_stripes );
 
 			return( -1 );
 		}
+		stripe_size = segment_size / (size64_t) number_of_stripes;
+
+		if( number_of_stripes == 1 )
+		{
+			allocation_type = LIBVSLVM_EXTENT_RUN_TYPE_LINEAR;
+		}
+		else
+		{
+			allocation_type = LIBVSLVM_EXTENT_RUN_TYPE_STRIPED;
+		}
+		for( stripe_index = 0;
+		     stripe_index < number_of_stripes;
+		     stripe_index++ )
+		{
+			stripe = NULL;
+
+			if( libvslvm_segment_get_stripe(
+			     segment,
+			     stripe_index,
+			     &stripe,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve segment: %d stripe: %d.",
+				 function,
+				 segment_index,
+				 stripe_index );
+
+				return( -1 );
+			}
+			if( libvslvm_stripe_get_physical_volume_name(
+			     stripe,
+			     physical_volume_name,
+			     64,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve segment: %d stripe: %d physical volume name.",
+				 function,
+				 segment_index,
+				 stripe_index );
+
+				return( -1 );
+			}
+			if( libvslvm_stripe_get_data_area_offset(
+			     stripe,
+			     &stripe_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve segment: %d stripe: %d data area offset.",
+				 function,
+				 segment_index,
+				 stripe_index );
+
+				return( -1 );
+			}
+			physical_volume_name_length = narrow_string_length(
+			                               physical_volume_name );
+
+			physical_volume = NULL;
+
+			result = libvslvm_volume_group_get_physical_volume_by_name(
+			          volume_group,
+			          physical_volume_name,
+			          physical_volume_name_length,
+			          &physical_volume,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve physical volume by name.",
+				 function );
+
+				return( -1 );
+			}
+			/* A stripe that refers to a physical volume that is not part of
+			 * the volume group does not allocate data of the physical volumes
+			 */
+			else if( result == 0 )
+			{
+				continue;
+			}
+			data_area_descriptor = NULL;
+
+			result = libvslvm_physical_volume_get_data_area_descriptor_by_offset(
+			          physical_volume,
+			          (uint64_t) stripe_offset,
+			          &data_area_descriptor,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data area descriptor by offset: 0x%08" PRIx64 ".",
+				 function,
+				 stripe_offset );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				if( data_area_descriptor == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing data area descriptor.",
+					 function );
+
+					return( -1 );
+				}
+				/* The stripe data area offset is relative to the start
+				 * of the data areas of the physical volume
+				 */
+				stripe_offset = (off64_t) ( data_area_descriptor->offset + ( (uint64_t) stripe_offset - data_area_descriptor->data_offset ) );
+			}
+			if( libvslvm_internal_physical_volume_append_allocation(
+			     (libvslvm_internal_physical_volume_t *) physical_volume,
+			     stripe_offset,
+			     stripe_size,
+			     logical_volume_index,
+			     segment_offset,
+			     allocation_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append allocation of segment: %d stripe: %d.",
+				 function,
+				 segment_index,
+				 stripe_index );
+
+				return( -1 );
+			}
+		}
 	}
-/* TODO build data area table */
 	return( 1 );
 }
 
@@ -1847,13 +2371,11 @@ int libvslvm_internal_handle_open_read(
 	size64_t data_area_size                                     = 0;
 	size64_t metadata_size                                      = 0;
 	off64_t data_area_offset                                    = 0;
-	off64_t file_offset                                         = 0;
 	off64_t metadata_offset                                     = 0;
 	uint32_t raw_location_descriptor_flags                      = 0;
 	uint32_t stored_checksum                                    = 0;
 	int number_of_data_area_descriptors                         = 0;
 	int number_of_raw_location_descriptors                      = 0;
-	int result                                                  = 0;
 
 	if( internal_handle == NULL )
 	{
@@ -1921,34 +2443,21 @@ int libvslvm_internal_handle_open_read(
 
 		goto on_error;
 	}
-	/* The physical volume label can be stored in one of the first 4 sectors
-	 */
-	while( file_offset < 2048 )
+	if( libvslvm_physical_volume_read_label_file_io_pool(
+	     physical_volume,
+	     file_io_pool,
+	     0,
+	     0,
+	     error ) == -1 )
 	{
-		result = libvslvm_physical_volume_read_label_file_io_pool(
-		          physical_volume,
-		          file_io_pool,
-		          0,
-		          file_offset,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read physical volume label at offset: %" PRIi64 ".",
-			 function,
-			 file_offset );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read physical volume label.",
+		 function );
 
-			goto on_error;
-		}
-		else if( result != 0 )
-		{
-			break;
-		}
-		file_offset += 512;
+		goto on_error;
 	}
 	if( libbfio_pool_remove_handle(
 	     file_io_pool,
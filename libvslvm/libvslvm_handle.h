@@ -29,6 +29,7 @@
 #include "libvslvm_io_handle.h"
 #include "libvslvm_libbfio.h"
 #include "libvslvm_libcerror.h"
+#include "libvslvm_logical_volume_values.h"
 #include "libvslvm_metadata.h"
 #include "libvslvm_types.h"
 
@@ -92,6 +93,12 @@ int libvslvm_handle_signal_abort(
      libvslvm_handle_t *handle,
      libcerror_error_t **error );
 
+LIBVSLVM_EXTERN \
+int libvslvm_handle_set_wipe_chunk_data(
+     libvslvm_handle_t *handle,
+     uint8_t wipe_chunk_data,
+     libcerror_error_t **error );
+
 LIBVSLVM_EXTERN \
 int libvslvm_handle_open(
      libvslvm_handle_t *handle,
@@ -171,6 +178,18 @@ int libvslvm_internal_handle_open_read_data_area_table(
      libbfio_pool_t *file_io_pool,
      libcerror_error_t **error );
 
+int libvslvm_internal_handle_open_build_allocation_tables(
+     libvslvm_internal_handle_t *internal_handle,
+     libvslvm_volume_group_t *volume_group,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error );
+
+int libvslvm_internal_handle_open_append_allocations(
+     libvslvm_volume_group_t *volume_group,
+     int logical_volume_index,
+     libvslvm_logical_volume_values_t *logical_volume_values,
+     libcerror_error_t **error );
+
 LIBVSLVM_EXTERN \
 int libvslvm_handle_close(
      libvslvm_handle_t *handle,
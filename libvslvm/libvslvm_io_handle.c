@@ -23,6 +23,8 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libvslvm_chunk_data_pool.h"
+#include "libvslvm_definitions.h"
 #include "libvslvm_io_handle.h"
 #include "libvslvm_libcerror.h"
 
@@ -86,6 +88,25 @@ int libvslvm_io_handle_initialize(
 
 		goto on_error;
 	}
+	/* The chunk data pool holds one chunk more than the cache of a logical volume
+	 * so that the chunk data evicted by a cache miss can be reused directly
+	 */
+	if( libvslvm_chunk_data_pool_initialize(
+	     &( ( *io_handle )->chunk_data_pool ),
+	     (size_t) LIBVSLVM_CHUNK_SIZE,
+	     LIBVSLVM_MAXIMUM_CACHE_ENTRIES_CHUNKS + 1,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunk data pool.",
+		 function );
+
+		goto on_error;
+	}
 	( *io_handle )->bytes_per_sector = 512;
 
 	return( 1 );
@@ -109,6 +130,7 @@ int libvslvm_io_handle_free(
      libcerror_error_t **error )
 {
 	static char *function = "libvslvm_io_handle_free";
+	int result            = 1;
 
 	if( io_handle == NULL )
 	{
@@ -123,12 +145,28 @@ int libvslvm_io_handle_free(
 	}
 	if( *io_handle != NULL )
 	{
+		/* The chunk data of the logical volumes is released to the pool
+		 * hence the logical volumes must be freed before the IO handle
+		 */
+		if( libvslvm_chunk_data_pool_free(
+		     &( ( *io_handle )->chunk_data_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunk data pool.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *io_handle );
 
 		*io_handle = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Clears the IO handle
@@ -138,7 +176,8 @@ int libvslvm_io_handle_clear(
      libvslvm_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "libvslvm_io_handle_clear";
+	libvslvm_chunk_data_pool_t *chunk_data_pool = NULL;
+	static char *function                       = "libvslvm_io_handle_clear";
 
 	if( io_handle == NULL )
 	{
@@ -151,6 +190,10 @@ int libvslvm_io_handle_clear(
 
 		return( -1 );
 	}
+	/* The chunk data pool, including its wipe data setting, is retained
+	 */
+	chunk_data_pool = io_handle->chunk_data_pool;
+
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -166,6 +209,7 @@ int libvslvm_io_handle_clear(
 		return( -1 );
 	}
 	io_handle->bytes_per_sector = 512;
+	io_handle->chunk_data_pool  = chunk_data_pool;
 
 	return( 1 );
 }
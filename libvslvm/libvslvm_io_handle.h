@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libvslvm_chunk_data_pool.h"
 #include "libvslvm_libcerror.h"
 
 #if defined( __cplusplus )
@@ -39,6 +40,10 @@ struct libvslvm_io_handle
 	 */
 	size_t bytes_per_sector;
 
+	/* The chunk data pool, that is shared by the logical volumes
+	 */
+	libvslvm_chunk_data_pool_t *chunk_data_pool;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
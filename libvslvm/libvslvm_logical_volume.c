@@ -25,10 +25,13 @@
 #include <types.h>
 
 #include "libvslvm_chunk_data.h"
+#include "libvslvm_chunk_data_pool.h"
 #include "libvslvm_data_area_descriptor.h"
 #include "libvslvm_definitions.h"
+#include "libvslvm_extent_run.h"
 #include "libvslvm_io_handle.h"
 #include "libvslvm_libbfio.h"
+#include "libvslvm_libcdata.h"
 #include "libvslvm_libcerror.h"
 #include "libvslvm_libcthreads.h"
 #include "libvslvm_libfcache.h"
@@ -62,13 +65,16 @@ int libvslvm_logical_volume_initialize(
 	libvslvm_segment_t *segment                                 = NULL;
 	libvslvm_stripe_t *stripe                                   = NULL;
 	static char *function                                       = "libvslvm_logical_volume_initialize";
+	off64_t logical_offset                                      = 0;
 	off64_t segment_offset                                      = 0;
 	off64_t stripe_offset                                       = 0;
 	size64_t segment_size                                       = 0;
 	size_t physical_volume_name_length                          = 0;
 	int element_index                                           = 0;
+	int number_of_extent_runs                                   = 0;
 	int number_of_segments                                      = 0;
 	int number_of_stripes                                       = 0;
+	int physical_volume_index                                   = 0;
 	int result                                                  = 0;
 	int segment_index                                           = 0;
 	int stripe_index                                            = 0;
@@ -137,11 +143,14 @@ int libvslvm_logical_volume_initialize(
 
 		return( -1 );
 	}
-/* TODO determine how the LVM raid chunk size is determined, 64k seems to be pretty standard */
+	if( io_handle != NULL )
+	{
+		internal_logical_volume->chunk_data_pool = io_handle->chunk_data_pool;
+	}
 	if( libfdata_vector_initialize(
 	     &( internal_logical_volume->chunks_vector ),
-	     (size64_t) ( 64 * 1024 ),
-	     NULL,
+	     (size64_t) LIBVSLVM_CHUNK_SIZE,
+	     (intptr_t *) internal_logical_volume,
 	     NULL,
 	     NULL,
 	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libvslvm_logical_volume_read_chunk_data,
@@ -158,6 +167,20 @@ int libvslvm_logical_volume_initialize(
 
 		goto on_error;
 	}
+	if( libcdata_array_initialize(
+	     &( internal_logical_volume->extent_runs_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extent runs array.",
+		 function );
+
+		goto on_error;
+	}
 	if( libvslvm_logical_volume_values_get_number_of_segments(
 	     logical_volume_values,
 	     &number_of_segments,
@@ -302,6 +325,8 @@ int libvslvm_logical_volume_initialize(
 			physical_volume_name_length = narrow_string_length(
 			                               physical_volume_name );
 
+			physical_volume = NULL;
+
 			if( libvslvm_volume_group_get_physical_volume_by_name(
 			     volume_group,
 			     physical_volume_name,
@@ -318,9 +343,13 @@ int libvslvm_logical_volume_initialize(
 
 				goto on_error;
 			}
+			physical_volume_index = ( (libvslvm_internal_physical_volume_t *) physical_volume )->volume_index;
+
+			data_area_descriptor = NULL;
+
 			result = libvslvm_physical_volume_get_data_area_descriptor_by_offset(
 			          physical_volume,
-			          stripe_offset,
+			          (uint64_t) stripe_offset,
 			          &data_area_descriptor,
 			          error );
 
@@ -332,35 +361,62 @@ int libvslvm_logical_volume_initialize(
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
 				 "%s: unable to retrieve data area descriptor by offset: 0x%08" PRIx64 ".",
 				 function,
-				 segment_offset );
+				 stripe_offset );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid stripe: %d data area offset: 0x%08" PRIx64 " value out of bounds.",
+				 function,
+				 stripe_index,
+				 stripe_offset );
 
 				goto on_error;
 			}
-			else if( result != 0 )
+			if( data_area_descriptor == NULL )
 			{
-				if( data_area_descriptor == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing data area descriptor.",
-					 function );
-
-					goto on_error;
-				}
-				/* The stripe data area offset is relative to the start
-				 * of the data area of the volume
-				 */
-				stripe_offset += data_area_descriptor->offset;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing data area descriptor.",
+				 function );
+
+				goto on_error;
 			}
-/* TODO check segment size ? */
+			/* The stripe data area offset is relative to the start
+			 * of the data areas of the physical volume
+			 */
+			stripe_offset = (off64_t) ( data_area_descriptor->offset + ( (uint64_t) stripe_offset - data_area_descriptor->data_offset ) );
+		}
+		if( libvslvm_internal_logical_volume_append_extent_run(
+		     internal_logical_volume,
+		     logical_offset,
+		     segment_size,
+		     physical_volume_index,
+		     stripe_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append segment: %d extent run.",
+			 function,
+			 segment_index );
+
+			goto on_error;
 		}
 /* TODO skip the append if the physical volumes are not available? */
 		if( libfdata_vector_append_segment(
 		     internal_logical_volume->chunks_vector,
 		     &element_index,
-		     0,
+		     physical_volume_index,
 		     stripe_offset,
 		     segment_size,
 		     0,
@@ -375,8 +431,33 @@ int libvslvm_logical_volume_initialize(
 
 			goto on_error;
 		}
+		logical_offset += (off64_t) segment_size;
+
 		segment = NULL;
 	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_logical_volume->extent_runs_array,
+	     &number_of_extent_runs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extent runs.",
+		 function );
+
+		goto on_error;
+	}
+	/* The logical volume is read directly from the physical volume if its data
+	 * is stored in a single extent run, this is the case for a single segment
+	 * or for segments that are stored contiguously on the same physical volume
+	 * otherwise the logical volume is read using the chunks vector and cache
+	 */
+	if( number_of_extent_runs == 1 )
+	{
+		internal_logical_volume->is_linear = 1;
+	}
 	if( libfdata_vector_get_size(
 	     internal_logical_volume->chunks_vector,
 	     &( internal_logical_volume->size ),
@@ -443,6 +524,13 @@ on_error:
 			 &( internal_logical_volume->chunks_cache ),
 			 NULL );
 		}
+		if( internal_logical_volume->extent_runs_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_logical_volume->extent_runs_array ),
+			 (int (*)(intptr_t **, libcerror_error_t **)) &libvslvm_extent_run_free,
+			 NULL );
+		}
 		if( internal_logical_volume->chunks_vector != NULL )
 		{
 			libfdata_vector_free(
@@ -510,6 +598,20 @@ int libvslvm_logical_volume_free(
 
 			result = -1;
 		}
+		if( libcdata_array_free(
+		     &( internal_logical_volume->extent_runs_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libvslvm_extent_run_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free extent runs array.",
+			 function );
+
+			result = -1;
+		}
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
 		if( libcthreads_read_write_lock_free(
 		     &( internal_logical_volume->read_write_lock ),
@@ -531,22 +633,23 @@ int libvslvm_logical_volume_free(
 	return( result );
 }
 
-/* Reads (logical volume) data at the current offset into a buffer using a Basic File IO (bfio) pool
- * This function is not multi-thread safe acquire write lock before call
- * Returns the number of bytes read or -1 on error
+/* Appends an extent run
+ * The extent run is merged with the last extent run if both are stored contiguously on the same physical volume
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libvslvm_internal_logical_volume_read_buffer_from_file_io_pool(
-         libvslvm_internal_logical_volume_t *internal_logical_volume,
-         libbfio_pool_t *physical_volume_file_io_pool,
-         void *buffer,
-         size_t buffer_size,
-         libcerror_error_t **error )
+int libvslvm_internal_logical_volume_append_extent_run(
+     libvslvm_internal_logical_volume_t *internal_logical_volume,
+     off64_t logical_offset,
+     size64_t size,
+     int physical_volume_index,
+     off64_t physical_offset,
+     libcerror_error_t **error )
 {
-	libvslvm_chunk_data_t *chunk_data = NULL;
-	static char *function             = "libvslvm_internal_logical_volume_read_buffer_from_file_io_pool";
-	off64_t element_data_offset       = 0;
-	size_t buffer_offset              = 0;
-	size_t read_size                  = 0;
+	libvslvm_extent_run_t *extent_run      = NULL;
+	libvslvm_extent_run_t *last_extent_run = NULL;
+	static char *function                  = "libvslvm_internal_logical_volume_append_extent_run";
+	int entry_index                        = 0;
+	int number_of_extent_runs              = 0;
 
 	if( internal_logical_volume == NULL )
 	{
@@ -559,181 +662,163 @@ ssize_t libvslvm_internal_logical_volume_read_buffer_from_file_io_pool(
 
 		return( -1 );
 	}
-	if( internal_logical_volume->current_offset < 0 )
+	if( logical_offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid logical volume - current offset value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid logical offset value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( buffer_size == 0 )
+	if( size > (size64_t) INT64_MAX )
 	{
-		return( 0 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
 	}
-	if( (size64_t) internal_logical_volume->current_offset >= internal_logical_volume->size )
+	if( physical_offset < 0 )
 	{
-		return( 0 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid physical offset value out of bounds.",
+		 function );
+
+		return( -1 );
 	}
-	if( (size64_t) ( internal_logical_volume->current_offset + buffer_size ) > internal_logical_volume->size )
+	if( size == 0 )
 	{
-		buffer_size = (size_t) ( internal_logical_volume->size - internal_logical_volume->current_offset );
+		return( 1 );
 	}
-	while( buffer_size > 0 )
+	if( libcdata_array_get_number_of_entries(
+	     internal_logical_volume->extent_runs_array,
+	     &number_of_extent_runs,
+	     error ) != 1 )
 	{
-		if( libfdata_vector_get_element_value_at_offset(
-		     internal_logical_volume->chunks_vector,
-		     (intptr_t *) physical_volume_file_io_pool,
-		     (libfdata_cache_t *) internal_logical_volume->chunks_cache,
-		     internal_logical_volume->current_offset,
-		     &element_data_offset,
-		     (intptr_t **) &chunk_data,
-		     0,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extent runs.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_extent_runs > 0 )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_logical_volume->extent_runs_array,
+		     number_of_extent_runs - 1,
+		     (intptr_t **) &last_extent_run,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve chunk data at offset: 0x%08" PRIx64 ".",
+			 "%s: unable to retrieve extent run: %d.",
 			 function,
-			 internal_logical_volume->current_offset );
+			 number_of_extent_runs - 1 );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( chunk_data == NULL )
+		if( last_extent_run == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing chunk data.",
-			 function );
-
-			return( -1 );
-		}
-		read_size = chunk_data->data_size - (size_t) element_data_offset;
+			 "%s: missing extent run: %d.",
+			 function,
+			 number_of_extent_runs - 1 );
 
-		if( buffer_size < read_size )
-		{
-			read_size = buffer_size;
+			goto on_error;
 		}
-		if( memory_copy(
-		     &( ( (uint8_t *) buffer )[ buffer_offset ] ),
-		     &( chunk_data->data[ element_data_offset ] ),
-		     read_size ) == NULL )
+		if( ( last_extent_run->type == LIBVSLVM_EXTENT_RUN_TYPE_LINEAR )
+		 && ( last_extent_run->physical_volume_index == physical_volume_index )
+		 && ( ( last_extent_run->logical_offset + (off64_t) last_extent_run->size ) == logical_offset )
+		 && ( ( last_extent_run->physical_offset + (off64_t) last_extent_run->size ) == physical_offset )
+		 && ( last_extent_run->size <= ( (size64_t) INT64_MAX - size ) ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy chunk data.",
-			 function );
+			last_extent_run->size += size;
 
-			return( -1 );
+			return( 1 );
 		}
-		internal_logical_volume->current_offset += read_size;
-		buffer_offset                           += read_size;
-		buffer_size                             -= read_size;
 	}
-	return( (ssize_t) buffer_offset );
-}
-
-/* Reads (logical volume) data at the current offset into a buffer
- * Returns the number of bytes read or -1 on error
- */
-ssize_t libvslvm_logical_volume_read_buffer(
-         libvslvm_logical_volume_t *logical_volume,
-         void *buffer,
-         size_t buffer_size,
-         libcerror_error_t **error )
-{
-	libvslvm_internal_logical_volume_t *internal_logical_volume = NULL;
-	static char *function                                       = "libvslvm_logical_volume_read_buffer";
-	ssize_t read_count                                          = 0;
-
-	if( logical_volume == NULL )
+	if( libvslvm_extent_run_initialize(
+	     &extent_run,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid logical volume.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extent run.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_logical_volume = (libvslvm_internal_logical_volume_t *) logical_volume;
+	extent_run->logical_offset        = logical_offset;
+	extent_run->size                  = size;
+	extent_run->physical_volume_index = physical_volume_index;
+	extent_run->physical_offset       = physical_offset;
+	extent_run->type                  = LIBVSLVM_EXTENT_RUN_TYPE_LINEAR;
 
-#if defined( HAVE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_logical_volume->read_write_lock,
+	if( libcdata_array_append_entry(
+	     internal_logical_volume->extent_runs_array,
+	     &entry_index,
+	     (intptr_t *) extent_run,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append extent run to array.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	read_count = libvslvm_internal_logical_volume_read_buffer_from_file_io_pool(
-		      internal_logical_volume,
-		      internal_logical_volume->physical_volume_file_io_pool,
-		      buffer,
-		      buffer_size,
-		      error );
-
-	if( read_count == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read buffer from logical volume.",
-		 function );
+	return( 1 );
 
-		read_count = -1;
-	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_logical_volume->read_write_lock,
-	     error ) != 1 )
+on_error:
+	if( extent_run != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
-		 function );
-
-		return( -1 );
+		libvslvm_extent_run_free(
+		 &extent_run,
+		 NULL );
 	}
-#endif
-	return( read_count );
+	return( -1 );
 }
 
-/* Reads (logical volume) data at a specific offset
- * Returns the number of bytes read or -1 on error
+/* Retrieves the extent run that contains a specific (logical volume) offset
+ * The extent runs are sorted by logical offset and do not overlap
+ * Returns 1 if successful, 0 if no such extent run or -1 on error
  */
-ssize_t libvslvm_logical_volume_read_buffer_at_offset(
-         libvslvm_logical_volume_t *logical_volume,
-         void *buffer,
-         size_t buffer_size,
-         off64_t offset,
-         libcerror_error_t **error )
+int libvslvm_internal_logical_volume_get_extent_run_at_offset(
+     libvslvm_internal_logical_volume_t *internal_logical_volume,
+     off64_t offset,
+     int *extent_run_index,
+     libvslvm_extent_run_t **extent_run,
+     libcerror_error_t **error )
 {
-	libvslvm_internal_logical_volume_t *internal_logical_volume = NULL;
-	static char *function                                       = "libvslvm_logical_volume_read_buffer_at_offset";
-	ssize_t read_count                                          = 0;
+	libvslvm_extent_run_t *safe_extent_run = NULL;
+	static char *function                  = "libvslvm_internal_logical_volume_get_extent_run_at_offset";
+	int lower_index                        = 0;
+	int middle_index                       = 0;
+	int number_of_extent_runs              = 0;
+	int upper_index                        = 0;
 
-	if( logical_volume == NULL )
+	if( internal_logical_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -744,153 +829,1290 @@ ssize_t libvslvm_logical_volume_read_buffer_at_offset(
 
 		return( -1 );
 	}
-	internal_logical_volume = (libvslvm_internal_logical_volume_t *) logical_volume;
-
-#if defined( HAVE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_logical_volume->read_write_lock,
-	     error ) != 1 )
+	if( extent_run_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_run == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent run.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_logical_volume->extent_runs_array,
+	     &number_of_extent_runs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extent runs.",
+		 function );
+
+		return( -1 );
+	}
+	upper_index = number_of_extent_runs;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( libcdata_array_get_entry_by_index(
+		     internal_logical_volume->extent_runs_array,
+		     middle_index,
+		     (intptr_t **) &safe_extent_run,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent run: %d.",
+			 function,
+			 middle_index );
+
+			return( -1 );
+		}
+		if( safe_extent_run == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing extent run: %d.",
+			 function,
+			 middle_index );
+
+			return( -1 );
+		}
+		if( offset < safe_extent_run->logical_offset )
+		{
+			upper_index = middle_index;
+		}
+		else if( (size64_t) ( offset - safe_extent_run->logical_offset ) >= safe_extent_run->size )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			*extent_run_index = middle_index;
+			*extent_run       = safe_extent_run;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the data range at or after a specific (logical volume) offset
+ * The data range consists of consecutive extent runs
+ * This function is not multi-thread safe acquire read lock before call
+ * Returns 1 if successful, 0 if no such data range or -1 on error
+ */
+int libvslvm_internal_logical_volume_get_data_range(
+     libvslvm_internal_logical_volume_t *internal_logical_volume,
+     off64_t offset,
+     off64_t *data_offset,
+     size64_t *data_size,
+     libcerror_error_t **error )
+{
+	libvslvm_extent_run_t *extent_run = NULL;
+	static char *function             = "libvslvm_internal_logical_volume_get_data_range";
+	off64_t range_end_offset          = 0;
+	int extent_run_index              = 0;
+	int lower_index                   = 0;
+	int middle_index                  = 0;
+	int number_of_extent_runs         = 0;
+	int upper_index                   = 0;
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_logical_volume->extent_runs_array,
+	     &number_of_extent_runs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extent runs.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine the first extent run that ends after the offset
+	 */
+	upper_index = number_of_extent_runs;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( libcdata_array_get_entry_by_index(
+		     internal_logical_volume->extent_runs_array,
+		     middle_index,
+		     (intptr_t **) &extent_run,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent run: %d.",
+			 function,
+			 middle_index );
+
+			return( -1 );
+		}
+		if( extent_run == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing extent run: %d.",
+			 function,
+			 middle_index );
+
+			return( -1 );
+		}
+		if( ( offset >= extent_run->logical_offset )
+		 && ( (size64_t) ( offset - extent_run->logical_offset ) >= extent_run->size ) )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	if( lower_index >= number_of_extent_runs )
+	{
+		return( 0 );
+	}
+	for( extent_run_index = lower_index;
+	     extent_run_index < number_of_extent_runs;
+	     extent_run_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_logical_volume->extent_runs_array,
+		     extent_run_index,
+		     (intptr_t **) &extent_run,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent run: %d.",
+			 function,
+			 extent_run_index );
+
+			return( -1 );
+		}
+		if( extent_run == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing extent run: %d.",
+			 function,
+			 extent_run_index );
+
+			return( -1 );
+		}
+		if( extent_run_index == lower_index )
+		{
+			if( offset < extent_run->logical_offset )
+			{
+				*data_offset = extent_run->logical_offset;
+			}
+			else
+			{
+				*data_offset = offset;
+			}
+		}
+		else if( extent_run->logical_offset != range_end_offset )
+		{
+			break;
+		}
+		range_end_offset = extent_run->logical_offset + (off64_t) extent_run->size;
+	}
+	*data_size = (size64_t) ( range_end_offset - *data_offset );
+
+	return( 1 );
+}
+
+/* Reads (logical volume) data at the current offset into a buffer directly from the extent runs
+ * This function bypasses the chunks vector and cache and is only used for linear logical volumes
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libvslvm_internal_logical_volume_read_buffer_from_extent_runs(
+         libvslvm_internal_logical_volume_t *internal_logical_volume,
+         libbfio_pool_t *physical_volume_file_io_pool,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libvslvm_extent_run_t *extent_run = NULL;
+	static char *function             = "libvslvm_internal_logical_volume_read_buffer_from_extent_runs";
+	off64_t physical_offset           = 0;
+	size64_t remaining_size           = 0;
+	size_t buffer_offset              = 0;
+	size_t read_size                  = 0;
+	ssize_t read_count                = 0;
+	int extent_run_index              = 0;
+	int result                        = 0;
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_size > 0 )
+	{
+		result = libvslvm_internal_logical_volume_get_extent_run_at_offset(
+		          internal_logical_volume,
+		          internal_logical_volume->current_offset,
+		          &extent_run_index,
+		          &extent_run,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent run at offset: 0x%08" PRIx64 ".",
+			 function,
+			 internal_logical_volume->current_offset );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		remaining_size  = extent_run->size - (size64_t) ( internal_logical_volume->current_offset - extent_run->logical_offset );
+		physical_offset = extent_run->physical_offset + ( internal_logical_volume->current_offset - extent_run->logical_offset );
+
+		read_size = buffer_size;
+
+		if( (size64_t) read_size > remaining_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		read_count = libbfio_pool_read_buffer_at_offset(
+		              physical_volume_file_io_pool,
+		              extent_run->physical_volume_index,
+		              &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+		              read_size,
+		              physical_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data from physical volume: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 extent_run->physical_volume_index,
+			 physical_offset,
+			 physical_offset );
+
+			return( -1 );
+		}
+		internal_logical_volume->current_offset += read_size;
+		buffer_offset                           += read_size;
+		buffer_size                             -= read_size;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Reads (logical volume) data at the current offset into a buffer using a Basic File IO (bfio) pool
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libvslvm_internal_logical_volume_read_buffer_from_file_io_pool(
+         libvslvm_internal_logical_volume_t *internal_logical_volume,
+         libbfio_pool_t *physical_volume_file_io_pool,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libvslvm_chunk_data_t *chunk_data = NULL;
+	static char *function             = "libvslvm_internal_logical_volume_read_buffer_from_file_io_pool";
+	off64_t element_data_offset       = 0;
+	size_t buffer_offset              = 0;
+	size_t read_size                  = 0;
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->current_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid logical volume - current offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size == 0 )
+	{
+		return( 0 );
+	}
+	if( (size64_t) internal_logical_volume->current_offset >= internal_logical_volume->size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) ( internal_logical_volume->current_offset + buffer_size ) > internal_logical_volume->size )
+	{
+		buffer_size = (size_t) ( internal_logical_volume->size - internal_logical_volume->current_offset );
+	}
+	if( internal_logical_volume->is_linear != 0 )
+	{
+		return( libvslvm_internal_logical_volume_read_buffer_from_extent_runs(
+		         internal_logical_volume,
+		         physical_volume_file_io_pool,
+		         buffer,
+		         buffer_size,
+		         error ) );
+	}
+	while( buffer_size > 0 )
+	{
+		internal_logical_volume->number_of_chunk_lookups += 1;
+
+		if( libfdata_vector_get_element_value_at_offset(
+		     internal_logical_volume->chunks_vector,
+		     (intptr_t *) physical_volume_file_io_pool,
+		     (libfdata_cache_t *) internal_logical_volume->chunks_cache,
+		     internal_logical_volume->current_offset,
+		     &element_data_offset,
+		     (intptr_t **) &chunk_data,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk data at offset: 0x%08" PRIx64 ".",
+			 function,
+			 internal_logical_volume->current_offset );
+
+			return( -1 );
+		}
+		if( chunk_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing chunk data.",
+			 function );
+
+			return( -1 );
+		}
+		read_size = chunk_data->data_size - (size_t) element_data_offset;
+
+		if( buffer_size < read_size )
+		{
+			read_size = buffer_size;
+		}
+		if( memory_copy(
+		     &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+		     &( chunk_data->data[ element_data_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy chunk data.",
+			 function );
+
+			return( -1 );
+		}
+		internal_logical_volume->current_offset += read_size;
+		buffer_offset                           += read_size;
+		buffer_size                             -= read_size;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Reads (logical volume) data at the current offset into a buffer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libvslvm_logical_volume_read_buffer(
+         libvslvm_logical_volume_t *logical_volume,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libvslvm_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                       = "libvslvm_logical_volume_read_buffer";
+	ssize_t read_count                                          = 0;
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_logical_volume = (libvslvm_internal_logical_volume_t *) logical_volume;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	read_count = libvslvm_internal_logical_volume_read_buffer_from_file_io_pool(
+		      internal_logical_volume,
+		      internal_logical_volume->physical_volume_file_io_pool,
+		      buffer,
+		      buffer_size,
+		      error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer from logical volume.",
+		 function );
+
+		read_count = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Reads (logical volume) data at a specific offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libvslvm_logical_volume_read_buffer_at_offset(
+         libvslvm_logical_volume_t *logical_volume,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libvslvm_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                       = "libvslvm_logical_volume_read_buffer_at_offset";
+	ssize_t read_count                                          = 0;
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_logical_volume = (libvslvm_internal_logical_volume_t *) logical_volume;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libvslvm_internal_logical_volume_seek_offset(
+	     internal_logical_volume,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libvslvm_internal_logical_volume_read_buffer_from_file_io_pool(
+		      internal_logical_volume,
+		      internal_logical_volume->physical_volume_file_io_pool,
+		      buffer,
+		      buffer_size,
+		      error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_logical_volume->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Seeks a certain offset of the (logical volume) data
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libvslvm_internal_logical_volume_seek_offset(
+         libvslvm_internal_logical_volume_t *internal_logical_volume,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libvslvm_internal_logical_volume_seek_offset";
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += internal_logical_volume->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) internal_logical_volume->size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_logical_volume->current_offset = offset;
+
+	return( offset );
+}
+
+/* Seeks a certain offset of the (logical volume) data
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libvslvm_logical_volume_seek_offset(
+         libvslvm_logical_volume_t *logical_volume,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libvslvm_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                       = "libvslvm_logical_volume_seek_offset";
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_logical_volume = (libvslvm_internal_logical_volume_t *) logical_volume;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	offset = libvslvm_internal_logical_volume_seek_offset(
+	          internal_logical_volume,
+	          offset,
+	          whence,
+	          error );
+
+	if( offset == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset.",
+		 function );
+
+		offset = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( offset );
+}
+
+/* Retrieves the current offset of the (logical volume) data
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_logical_volume_get_offset(
+     libvslvm_logical_volume_t *logical_volume,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libvslvm_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                       = "libvslvm_logical_volume_get_offset";
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_logical_volume = (libvslvm_internal_logical_volume_t *) logical_volume;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*offset = internal_logical_volume->current_offset;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( libvslvm_internal_logical_volume_seek_offset(
-	     internal_logical_volume,
-	     offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	return( 1 );
+}
+
+/* Retrieves the size
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_logical_volume_get_size(
+     libvslvm_logical_volume_t *logical_volume,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libvslvm_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                       = "libvslvm_logical_volume_get_size";
+
+	if( logical_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	read_count = libvslvm_internal_logical_volume_read_buffer_from_file_io_pool(
-		      internal_logical_volume,
-		      internal_logical_volume->physical_volume_file_io_pool,
-		      buffer,
-		      buffer_size,
-		      error );
+	internal_logical_volume = (libvslvm_internal_logical_volume_t *) logical_volume;
 
-	if( read_count == -1 )
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*size = internal_logical_volume->size;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the chunk cache statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_logical_volume_get_chunk_cache_statistics(
+     libvslvm_logical_volume_t *logical_volume,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error )
+{
+	libvslvm_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                       = "libvslvm_logical_volume_get_chunk_cache_statistics";
+	uint64_t number_of_chunk_misses                             = 0;
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_logical_volume = (libvslvm_internal_logical_volume_t *) logical_volume;
+
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	number_of_chunk_misses = internal_logical_volume->number_of_chunk_misses;
+
+	if( number_of_chunk_misses > internal_logical_volume->number_of_chunk_lookups )
+	{
+		number_of_chunk_misses = internal_logical_volume->number_of_chunk_lookups;
+	}
+	*number_of_hits   = internal_logical_volume->number_of_chunk_lookups - number_of_chunk_misses;
+	*number_of_misses = number_of_chunk_misses;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the physical volume file IO pool
+ * The file IO pool must contain the physical volume files in the same order as
+ * the file IO pool the handle was opened with. It is not managed by the logical volume
+ * and must remain valid while the logical volume is used
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_logical_volume_set_physical_volume_file_io_pool(
+     libvslvm_logical_volume_t *logical_volume,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error )
+{
+	libvslvm_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                       = "libvslvm_logical_volume_set_physical_volume_file_io_pool";
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_logical_volume = (libvslvm_internal_logical_volume_t *) logical_volume;
+
+	if( file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_logical_volume->physical_volume_file_io_pool = file_io_pool;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the physical location of a specific (logical volume) offset
+ * The physical location consists of the index of the physical volume in the volume group,
+ * which corresponds with the physical volume file IO pool entry, the offset relative to the
+ * start of the physical volume and the size of the data that is stored contiguously from the offset
+ * Returns 1 if successful, 0 if the offset is not mapped or -1 on error
+ */
+int libvslvm_logical_volume_get_physical_location(
+     libvslvm_logical_volume_t *logical_volume,
+     off64_t offset,
+     int *physical_volume_index,
+     off64_t *physical_volume_offset,
+     size64_t *contiguous_size,
+     libcerror_error_t **error )
+{
+	libvslvm_extent_run_t *extent_run                           = NULL;
+	libvslvm_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                       = "libvslvm_logical_volume_get_physical_location";
+	off64_t relative_offset                                     = 0;
+	int extent_run_index                                        = 0;
+	int result                                                  = 0;
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_logical_volume = (libvslvm_internal_logical_volume_t *) logical_volume;
+
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read buffer.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_logical_volume->read_write_lock,
-	     error ) != 1 )
+	if( physical_volume_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical volume index.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( read_count );
-
-on_error:
-#if defined( HAVE_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_write(
-	 internal_logical_volume->read_write_lock,
-	 NULL );
-#endif
-	return( -1 );
-}
-
-/* Seeks a certain offset of the (logical volume) data
- * This function is not multi-thread safe acquire write lock before call
- * Returns the offset if seek is successful or -1 on error
- */
-off64_t libvslvm_internal_logical_volume_seek_offset(
-         libvslvm_internal_logical_volume_t *internal_logical_volume,
-         off64_t offset,
-         int whence,
-         libcerror_error_t **error )
-{
-	static char *function = "libvslvm_internal_logical_volume_seek_offset";
-
-	if( internal_logical_volume == NULL )
+	if( physical_volume_offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid logical volume.",
+		 "%s: invalid physical volume offset.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( whence != SEEK_CUR )
-	 && ( whence != SEEK_END )
-	 && ( whence != SEEK_SET ) )
+	if( contiguous_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported whence.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid contiguous size.",
 		 function );
 
 		return( -1 );
 	}
-	if( whence == SEEK_CUR )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
 	{
-		offset += internal_logical_volume->current_offset;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
 	}
-	else if( whence == SEEK_END )
+#endif
+	result = libvslvm_internal_logical_volume_get_extent_run_at_offset(
+	          internal_logical_volume,
+	          offset,
+	          &extent_run_index,
+	          &extent_run,
+	          error );
+
+	if( result == -1 )
 	{
-		offset += (off64_t) internal_logical_volume->size;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extent run at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
 	}
-	if( offset < 0 )
+	else if( result != 0 )
+	{
+		relative_offset = offset - extent_run->logical_offset;
+
+		*physical_volume_index  = extent_run->physical_volume_index;
+		*physical_volume_offset = extent_run->physical_offset + relative_offset;
+		*contiguous_size        = extent_run->size - (size64_t) relative_offset;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid offset value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	internal_logical_volume->current_offset = offset;
-
-	return( offset );
+#endif
+	return( result );
 }
 
-/* Seeks a certain offset of the (logical volume) data
- * Returns the offset if seek is successful or -1 on error
+/* Retrieves the data at or after a specific (logical volume) offset
+ * The data offset is the start of the first data at or after the offset
+ * and the data size the size of the data that is contiguous from there
+ * Returns 1 if successful, 0 if there is no data at or after the offset or -1 on error
  */
-off64_t libvslvm_logical_volume_seek_offset(
-         libvslvm_logical_volume_t *logical_volume,
-         off64_t offset,
-         int whence,
-         libcerror_error_t **error )
+int libvslvm_logical_volume_seek_data(
+     libvslvm_logical_volume_t *logical_volume,
+     off64_t offset,
+     off64_t *data_offset,
+     size64_t *data_size,
+     libcerror_error_t **error )
 {
 	libvslvm_internal_logical_volume_t *internal_logical_volume = NULL;
-	static char *function                                       = "libvslvm_logical_volume_seek_offset";
+	static char *function                                       = "libvslvm_logical_volume_seek_data";
+	int result                                                  = 0;
 
 	if( logical_volume == NULL )
 	{
@@ -906,7 +2128,7 @@ off64_t libvslvm_logical_volume_seek_offset(
 	internal_logical_volume = (libvslvm_internal_logical_volume_t *) logical_volume;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_logical_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -914,31 +2136,32 @@ off64_t libvslvm_logical_volume_seek_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	offset = libvslvm_internal_logical_volume_seek_offset(
+	result = libvslvm_internal_logical_volume_get_data_range(
 	          internal_logical_volume,
 	          offset,
-	          whence,
+	          data_offset,
+	          data_size,
 	          error );
 
-	if( offset == -1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset.",
-		 function );
-
-		offset = -1;
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data range at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_logical_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -946,25 +2169,27 @@ off64_t libvslvm_logical_volume_seek_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( offset );
+	return( result );
 }
 
-/* Retrieves the current offset of the (logical volume) data
+/* Retrieves the number of extent runs
+ * An extent run is a range of the logical volume data that is stored contiguously on a single physical volume
  * Returns 1 if successful or -1 on error
  */
-int libvslvm_logical_volume_get_offset(
+int libvslvm_logical_volume_get_number_of_extent_runs(
      libvslvm_logical_volume_t *logical_volume,
-     off64_t *offset,
+     int *number_of_extent_runs,
      libcerror_error_t **error )
 {
 	libvslvm_internal_logical_volume_t *internal_logical_volume = NULL;
-	static char *function                                       = "libvslvm_logical_volume_get_offset";
+	static char *function                                       = "libvslvm_logical_volume_get_number_of_extent_runs";
+	int result                                                  = 1;
 
 	if( logical_volume == NULL )
 	{
@@ -979,17 +2204,6 @@ int libvslvm_logical_volume_get_offset(
 	}
 	internal_logical_volume = (libvslvm_internal_logical_volume_t *) logical_volume;
 
-	if( offset == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid offset.",
-		 function );
-
-		return( -1 );
-	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_logical_volume->read_write_lock,
@@ -1005,8 +2219,20 @@ int libvslvm_logical_volume_get_offset(
 		return( -1 );
 	}
 #endif
-	*offset = internal_logical_volume->current_offset;
+	if( libcdata_array_get_number_of_entries(
+	     internal_logical_volume->extent_runs_array,
+	     number_of_extent_runs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extent runs.",
+		 function );
 
+		result = -1;
+	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_logical_volume->read_write_lock,
@@ -1022,19 +2248,27 @@ int libvslvm_logical_volume_get_offset(
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the size
+/* Retrieves a specific extent run
+ * The physical volume index corresponds with the index of the physical volume in the volume group
  * Returns 1 if successful or -1 on error
  */
-int libvslvm_logical_volume_get_size(
+int libvslvm_logical_volume_get_extent_run_by_index(
      libvslvm_logical_volume_t *logical_volume,
+     int extent_run_index,
+     off64_t *logical_offset,
      size64_t *size,
+     int *physical_volume_index,
+     off64_t *physical_volume_offset,
+     uint8_t *extent_run_type,
      libcerror_error_t **error )
 {
+	libvslvm_extent_run_t *extent_run                           = NULL;
 	libvslvm_internal_logical_volume_t *internal_logical_volume = NULL;
-	static char *function                                       = "libvslvm_logical_volume_get_size";
+	static char *function                                       = "libvslvm_logical_volume_get_extent_run_by_index";
+	int result                                                  = 1;
 
 	if( logical_volume == NULL )
 	{
@@ -1049,6 +2283,17 @@ int libvslvm_logical_volume_get_size(
 	}
 	internal_logical_volume = (libvslvm_internal_logical_volume_t *) logical_volume;
 
+	if( logical_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical offset.",
+		 function );
+
+		return( -1 );
+	}
 	if( size == NULL )
 	{
 		libcerror_error_set(
@@ -1060,6 +2305,39 @@ int libvslvm_logical_volume_get_size(
 
 		return( -1 );
 	}
+	if( physical_volume_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical volume index.",
+		 function );
+
+		return( -1 );
+	}
+	if( physical_volume_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical volume offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_run_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent run type.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_logical_volume->read_write_lock,
@@ -1075,8 +2353,42 @@ int libvslvm_logical_volume_get_size(
 		return( -1 );
 	}
 #endif
-	*size = internal_logical_volume->size;
+	if( libcdata_array_get_entry_by_index(
+	     internal_logical_volume->extent_runs_array,
+	     extent_run_index,
+	     (intptr_t **) &extent_run,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extent run: %d.",
+		 function,
+		 extent_run_index );
+
+		result = -1;
+	}
+	else if( extent_run == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing extent run: %d.",
+		 function,
+		 extent_run_index );
 
+		result = -1;
+	}
+	else
+	{
+		*logical_offset         = extent_run->logical_offset;
+		*size                   = extent_run->size;
+		*physical_volume_index  = extent_run->physical_volume_index;
+		*physical_volume_offset = extent_run->physical_offset;
+		*extent_run_type        = extent_run->type;
+	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_logical_volume->read_write_lock,
@@ -1092,7 +2404,7 @@ int libvslvm_logical_volume_get_size(
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
 /* Retrieves the size of the ASCII formatted name
@@ -1539,7 +2851,7 @@ int libvslvm_logical_volume_get_segment(
  * Returns 1 if successful or -1 on error
  */
 int libvslvm_logical_volume_read_chunk_data(
-     intptr_t *data_handle LIBVSLVM_ATTRIBUTE_UNUSED,
+     libvslvm_internal_logical_volume_t *internal_logical_volume,
      libbfio_pool_t *file_io_pool,
      libfdata_vector_t *vector,
      libfdata_cache_t *cache,
@@ -1554,35 +2866,70 @@ int libvslvm_logical_volume_read_chunk_data(
 	libvslvm_chunk_data_t *chunk_data = NULL;
 	static char *function             = "libvslvm_logical_volume_read_chunk_data";
 
-	LIBVSLVM_UNREFERENCED_PARAMETER( data_handle );
 	LIBVSLVM_UNREFERENCED_PARAMETER( element_data_flags );
 	LIBVSLVM_UNREFERENCED_PARAMETER( read_flags );
 
-	if( element_data_size > (size64_t) SSIZE_MAX )
+	if( internal_logical_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid element data size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libvslvm_chunk_data_initialize(
-	     &chunk_data,
-	     (size_t) element_data_size,
-	     error ) != 1 )
+	if( element_data_size > (size64_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create chunk data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid element data size value exceeds maximum.",
 		 function );
 
 		goto on_error;
 	}
+	/* The chunks vector is only read with the read/write lock held for writing
+	 */
+	internal_logical_volume->number_of_chunk_misses += 1;
+
+	if( internal_logical_volume->chunk_data_pool != NULL )
+	{
+		if( libvslvm_chunk_data_pool_get_chunk_data(
+		     internal_logical_volume->chunk_data_pool,
+		     (size_t) element_data_size,
+		     &chunk_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk data from pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libvslvm_chunk_data_initialize(
+		     &chunk_data,
+		     (size_t) element_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk data.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( libvslvm_chunk_data_read_file_io_pool(
 	     chunk_data,
 	     file_io_pool,
@@ -25,9 +25,12 @@
 #include <common.h>
 #include <types.h>
 
+#include "libvslvm_chunk_data_pool.h"
+#include "libvslvm_extent_run.h"
 #include "libvslvm_extern.h"
 #include "libvslvm_io_handle.h"
 #include "libvslvm_libbfio.h"
+#include "libvslvm_libcdata.h"
 #include "libvslvm_libcerror.h"
 #include "libvslvm_libcthreads.h"
 #include "libvslvm_libfcache.h"
@@ -63,6 +66,19 @@ struct libvslvm_internal_logical_volume
 	 */
 	libfcache_cache_t *chunks_cache;
 
+	/* The chunk data pool, which is owned by the IO handle
+	 */
+	libvslvm_chunk_data_pool_t *chunk_data_pool;
+
+	/* The extent runs array
+	 */
+	libcdata_array_t *extent_runs_array;
+
+	/* Value to indicate the logical volume data is stored in a single extent run
+	 * and can be read without the chunks vector
+	 */
+	uint8_t is_linear;
+
 	/* The current offset
 	 */
 	off64_t current_offset;
@@ -71,6 +87,14 @@ struct libvslvm_internal_logical_volume
 	 */
 	size64_t size;
 
+	/* The number of chunk lookups in the chunks vector
+	 */
+	uint64_t number_of_chunk_lookups;
+
+	/* The number of chunk misses that required the chunk to be read
+	 */
+	uint64_t number_of_chunk_misses;
+
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -91,6 +115,35 @@ int libvslvm_logical_volume_free(
      libvslvm_logical_volume_t **logical_volume,
      libcerror_error_t **error );
 
+int libvslvm_internal_logical_volume_append_extent_run(
+     libvslvm_internal_logical_volume_t *internal_logical_volume,
+     off64_t logical_offset,
+     size64_t size,
+     int physical_volume_index,
+     off64_t physical_offset,
+     libcerror_error_t **error );
+
+int libvslvm_internal_logical_volume_get_extent_run_at_offset(
+     libvslvm_internal_logical_volume_t *internal_logical_volume,
+     off64_t offset,
+     int *extent_run_index,
+     libvslvm_extent_run_t **extent_run,
+     libcerror_error_t **error );
+
+int libvslvm_internal_logical_volume_get_data_range(
+     libvslvm_internal_logical_volume_t *internal_logical_volume,
+     off64_t offset,
+     off64_t *data_offset,
+     size64_t *data_size,
+     libcerror_error_t **error );
+
+ssize_t libvslvm_internal_logical_volume_read_buffer_from_extent_runs(
+         libvslvm_internal_logical_volume_t *internal_logical_volume,
+         libbfio_pool_t *physical_volume_file_io_pool,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
 ssize_t libvslvm_internal_logical_volume_read_buffer_from_file_io_pool(
          libvslvm_internal_logical_volume_t *internal_logical_volume,
          libbfio_pool_t *physical_volume_file_io_pool,
@@ -138,6 +191,53 @@ int libvslvm_logical_volume_get_size(
      size64_t *size,
      libcerror_error_t **error );
 
+LIBVSLVM_EXTERN \
+int libvslvm_logical_volume_get_chunk_cache_statistics(
+     libvslvm_logical_volume_t *logical_volume,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
+LIBVSLVM_EXTERN \
+int libvslvm_logical_volume_set_physical_volume_file_io_pool(
+     libvslvm_logical_volume_t *logical_volume,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error );
+
+LIBVSLVM_EXTERN \
+int libvslvm_logical_volume_get_physical_location(
+     libvslvm_logical_volume_t *logical_volume,
+     off64_t offset,
+     int *physical_volume_index,
+     off64_t *physical_volume_offset,
+     size64_t *contiguous_size,
+     libcerror_error_t **error );
+
+LIBVSLVM_EXTERN \
+int libvslvm_logical_volume_seek_data(
+     libvslvm_logical_volume_t *logical_volume,
+     off64_t offset,
+     off64_t *data_offset,
+     size64_t *data_size,
+     libcerror_error_t **error );
+
+LIBVSLVM_EXTERN \
+int libvslvm_logical_volume_get_number_of_extent_runs(
+     libvslvm_logical_volume_t *logical_volume,
+     int *number_of_extent_runs,
+     libcerror_error_t **error );
+
+LIBVSLVM_EXTERN \
+int libvslvm_logical_volume_get_extent_run_by_index(
+     libvslvm_logical_volume_t *logical_volume,
+     int extent_run_index,
+     off64_t *logical_offset,
+     size64_t *size,
+     int *physical_volume_index,
+     off64_t *physical_volume_offset,
+     uint8_t *extent_run_type,
+     libcerror_error_t **error );
+
 LIBVSLVM_EXTERN \
 int libvslvm_logical_volume_get_name_size(
      libvslvm_logical_volume_t *logical_volume,
@@ -178,7 +278,7 @@ int libvslvm_logical_volume_get_segment(
      libcerror_error_t **error );
 
 int libvslvm_logical_volume_read_chunk_data(
-     intptr_t *data_handle,
+     libvslvm_internal_logical_volume_t *internal_logical_volume,
      libbfio_pool_t *file_io_pool,
      libfdata_vector_t *vector,
      libfdata_cache_t *cache,
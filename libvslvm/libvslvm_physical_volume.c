@@ -24,13 +24,22 @@
 #include <memory.h>
 #include <types.h>
 
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
 #include "libvslvm_checksum.h"
 #include "libvslvm_data_area_descriptor.h"
+#include "libvslvm_definitions.h"
+#include "libvslvm_extent_run.h"
 #include "libvslvm_libbfio.h"
 #include "libvslvm_libcdata.h"
 #include "libvslvm_libcerror.h"
 #include "libvslvm_libcnotify.h"
+#include "libvslvm_logical_volume_values.h"
 #include "libvslvm_physical_volume.h"
+#include "libvslvm_segment.h"
+#include "libvslvm_stripe.h"
 #include "libvslvm_types.h"
 #include "libvslvm_unused.h"
 
@@ -133,6 +142,34 @@ int libvslvm_physical_volume_initialize(
 
 		goto on_error;
 	}
+	if( libcdata_array_initialize(
+	     &( internal_physical_volume->allocations_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create allocations array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( internal_physical_volume->unallocated_extent_runs_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create unallocated extent runs array.",
+		 function );
+
+		goto on_error;
+	}
 	*physical_volume= (libvslvm_physical_volume_t *) internal_physical_volume;
 
 	return( 1 );
@@ -140,6 +177,20 @@ int libvslvm_physical_volume_initialize(
 on_error:
 	if( internal_physical_volume != NULL )
 	{
+		if( internal_physical_volume->allocations_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_physical_volume->allocations_array ),
+			 NULL,
+			 NULL );
+		}
+		if( internal_physical_volume->metadata_area_descriptors_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_physical_volume->metadata_area_descriptors_array ),
+			 NULL,
+			 NULL );
+		}
 		if( internal_physical_volume->data_area_descriptors_array != NULL )
 		{
 			libcdata_array_free(
@@ -241,6 +292,60 @@ int libvslvm_internal_physical_volume_free(
 
 			result = -1;
 		}
+		if( libcdata_array_free(
+		     &( ( *internal_physical_volume )->allocations_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libvslvm_extent_run_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free allocations array.",
+			 function );
+
+			result = -1;
+		}
+		if( libcdata_array_free(
+		     &( ( *internal_physical_volume )->unallocated_extent_runs_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libvslvm_extent_run_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free unallocated extent runs array.",
+			 function );
+
+			result = -1;
+		}
+		if( libvslvm_logical_volume_values_free(
+		     &( ( *internal_physical_volume )->unallocated_volume_values ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free unallocated volume values.",
+			 function );
+
+			result = -1;
+		}
+		if( libvslvm_logical_volume_values_free(
+		     &( ( *internal_physical_volume )->data_area_volume_values ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free data area volume values.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *internal_physical_volume );
 
@@ -1061,21 +1166,90 @@ int libvslvm_physical_volume_get_data_area_descriptor(
 	return( 1 );
 }
 
+/* Retrieves a specific data area descriptor
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_internal_physical_volume_get_data_area_descriptor_by_index(
+     libvslvm_internal_physical_volume_t *internal_physical_volume,
+     int data_area_descriptor_index,
+     libvslvm_data_area_descriptor_t **data_area_descriptor,
+     libcerror_error_t **error )
+{
+	static char *function = "libvslvm_internal_physical_volume_get_data_area_descriptor_by_index";
+
+	if( internal_physical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_area_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data area descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_physical_volume->data_area_descriptors_array,
+	     data_area_descriptor_index,
+	     (intptr_t **) data_area_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data area descriptor: %d.",
+		 function,
+		 data_area_descriptor_index );
+
+		return( -1 );
+	}
+	if( *data_area_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing data area descriptor: %d.",
+		 function,
+		 data_area_descriptor_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the data area descriptor for a specific offset
+ * The offset is relative to the start of the physical volume data
+ * The data area descriptors are stored in order of their data offset
+ * hence the array is searched as a sorted interval index
  * Returns 1 if successful, 0 if no such data area descriptor or -1 on error
  */
 int libvslvm_physical_volume_get_data_area_descriptor_by_offset(
      libvslvm_physical_volume_t *physical_volume,
-     uint64_t offset LIBVSLVM_ATTRIBUTE_UNUSED,
+     uint64_t offset,
      libvslvm_data_area_descriptor_t **data_area_descriptor,
      libcerror_error_t **error )
 {
+	libvslvm_data_area_descriptor_t *safe_data_area_descriptor    = NULL;
 	libvslvm_internal_physical_volume_t *internal_physical_volume = NULL;
 	static char *function                                         = "libvslvm_physical_volume_get_data_area_descriptor_by_offset";
+	uint64_t data_offset                                          = 0;
 	int data_area_descriptor_index                                = 0;
+	int lower_index                                               = 0;
 	int number_of_data_area_descriptors                           = 0;
-
-	LIBVSLVM_UNREFERENCED_PARAMETER( offset )
+	int upper_index                                               = 0;
 
 	if( physical_volume == NULL )
 	{
@@ -1126,14 +1300,19 @@ int libvslvm_physical_volume_get_data_area_descriptor_by_offset(
 
 		return( -1 );
 	}
-	for( data_area_descriptor_index = 0;
-	     data_area_descriptor_index < number_of_data_area_descriptors;
-	     data_area_descriptor_index++ )
+	/* Determine the first data area descriptor with a data offset larger than the offset
+	 */
+	lower_index = 0;
+	upper_index = number_of_data_area_descriptors;
+
+	while( lower_index < upper_index )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     internal_physical_volume->data_area_descriptors_array,
+		data_area_descriptor_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( libvslvm_internal_physical_volume_get_data_area_descriptor_by_index(
+		     internal_physical_volume,
 		     data_area_descriptor_index,
-		     (intptr_t **) data_area_descriptor,
+		     &safe_data_area_descriptor,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1146,25 +1325,96 @@ int libvslvm_physical_volume_get_data_area_descriptor_by_offset(
 
 			return( -1 );
 		}
-		if( *data_area_descriptor == NULL )
+		if( safe_data_area_descriptor->data_offset <= offset )
+		{
+			lower_index = data_area_descriptor_index + 1;
+		}
+		else
+		{
+			upper_index = data_area_descriptor_index;
+		}
+	}
+	if( upper_index == 0 )
+	{
+		return( 0 );
+	}
+	if( libvslvm_internal_physical_volume_get_data_area_descriptor_by_index(
+	     internal_physical_volume,
+	     upper_index - 1,
+	     &safe_data_area_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data area descriptor: %d.",
+		 function,
+		 upper_index - 1 );
+
+		return( -1 );
+	}
+	/* Data area descriptors that follow a data area of size 0 share its data offset,
+	 * the first of these data area descriptors contains the offset
+	 */
+	data_offset = safe_data_area_descriptor->data_offset;
+
+	lower_index  = 0;
+	upper_index -= 1;
+
+	while( lower_index < upper_index )
+	{
+		data_area_descriptor_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( libvslvm_internal_physical_volume_get_data_area_descriptor_by_index(
+		     internal_physical_volume,
+		     data_area_descriptor_index,
+		     &safe_data_area_descriptor,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing data area descriptor: %d.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data area descriptor: %d.",
 			 function,
 			 data_area_descriptor_index );
 
 			return( -1 );
 		}
-		if( ( *data_area_descriptor )->size == 0 )
+		if( safe_data_area_descriptor->data_offset < data_offset )
 		{
-			return( 1 );
+			lower_index = data_area_descriptor_index + 1;
+		}
+		else
+		{
+			upper_index = data_area_descriptor_index;
 		}
-		offset -= ( *data_area_descriptor )->size;
 	}
-	return( 0 );
+	if( libvslvm_internal_physical_volume_get_data_area_descriptor_by_index(
+	     internal_physical_volume,
+	     lower_index,
+	     &safe_data_area_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data area descriptor: %d.",
+		 function,
+		 lower_index );
+
+		return( -1 );
+	}
+	if( ( safe_data_area_descriptor->size != 0 )
+	 && ( ( offset - safe_data_area_descriptor->data_offset ) >= safe_data_area_descriptor->size ) )
+	{
+		return( 0 );
+	}
+	*data_area_descriptor = safe_data_area_descriptor;
+
+	return( 1 );
 }
 
 /* Retrieves the number of metadata area descriptors
@@ -1252,31 +1502,24 @@ int libvslvm_physical_volume_get_metadata_area_descriptor(
 	return( 1 );
 }
 
-/* TODO move function into libvslvm_physical_volume_label.c */
-
-/* Reads a physical volume label
- * Returns 1 if successful, 0 if not found or -1 on error
+/* Appends an allocation
+ * An allocation maps a range of the physical volume onto a range of a logical volume
+ * The allocations are not sorted by physical volume offset until libvslvm_internal_physical_volume_sort_allocations is called
+ * For a striped allocation the logical volume offset is the offset of the segment that contains the stripe
+ * Returns 1 if successful or -1 on error
  */
-int libvslvm_internal_physical_volume_read_label_data(
+int libvslvm_internal_physical_volume_append_allocation(
      libvslvm_internal_physical_volume_t *internal_physical_volume,
-     const uint8_t *data,
-     size_t data_size,
+     off64_t physical_volume_offset,
+     size64_t size,
+     int logical_volume_index,
+     off64_t logical_volume_offset,
+     uint8_t allocation_type,
      libcerror_error_t **error )
 {
-	libvslvm_data_area_descriptor_t *data_area_descriptor = NULL;
-	static char *function                                 = "libvslvm_internal_physical_volume_read_label_data";
-	size_t data_offset                                    = 0;
-	uint64_t offset                                       = 0;
-	uint64_t size                                         = 0;
-	uint32_t calculated_checksum                          = 0;
-	uint32_t stored_checksum                              = 0;
-	int entry_index                                       = 0;
-	int result                                            = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint64_t value_64bit                                  = 0;
-	uint32_t value_32bit                                  = 0;
-#endif
+	libvslvm_extent_run_t *extent_run = NULL;
+	static char *function             = "libvslvm_internal_physical_volume_append_allocation";
+	int entry_index                   = 0;
 
 	if( internal_physical_volume == NULL )
 	{
@@ -1289,50 +1532,1284 @@ int libvslvm_internal_physical_volume_read_label_data(
 
 		return( -1 );
 	}
-	if( data == NULL )
+	if( physical_volume_offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid physical volume offset value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( data_size == 0 )
-	 || ( data_size > (size_t) SSIZE_MAX ) )
+	if( size > (size64_t) ( INT64_MAX - physical_volume_offset ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid data size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( logical_volume_index < 0 )
 	{
-		libcnotify_printf(
-		 "%s: physical volume label data:\n",
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid logical volume index value out of bounds.",
 		 function );
-		libcnotify_print_data(
-		 data,
-		 512,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+
+		return( -1 );
 	}
-#endif
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( logical_volume_offset < 0 )
 	{
-		libcnotify_printf(
-		 "%s: physical volume label header:\n",
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid logical volume offset value out of bounds.",
 		 function );
-		libcnotify_print_data(
-		 data,
-		 sizeof( vslvm_physical_volume_label_header_t ),
+
+		return( -1 );
+	}
+	if( ( allocation_type != LIBVSLVM_EXTENT_RUN_TYPE_LINEAR )
+	 && ( allocation_type != LIBVSLVM_EXTENT_RUN_TYPE_STRIPED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported allocation type.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 1 );
+	}
+	if( libvslvm_extent_run_initialize(
+	     &extent_run,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extent run.",
+		 function );
+
+		goto on_error;
+	}
+	extent_run->logical_offset        = logical_volume_offset;
+	extent_run->size                  = size;
+	extent_run->physical_volume_index = internal_physical_volume->volume_index;
+	extent_run->physical_offset       = physical_volume_offset;
+	extent_run->logical_volume_index  = logical_volume_index;
+	extent_run->type                  = allocation_type;
+
+	if( libcdata_array_append_entry(
+	     internal_physical_volume->allocations_array,
+	     &entry_index,
+	     (intptr_t *) extent_run,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append extent run to allocations array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( extent_run != NULL )
+	{
+		libvslvm_extent_run_free(
+		 &extent_run,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sorts the allocations by physical volume offset
+ * The allocations are sorted once after all of them have been appended
+ * Overlapping allocations can only originate from corrupted metadata and are considered an error
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_internal_physical_volume_sort_allocations(
+     libvslvm_internal_physical_volume_t *internal_physical_volume,
+     libcerror_error_t **error )
+{
+	libvslvm_extent_run_t **allocations    = NULL;
+	libvslvm_extent_run_t *allocation      = NULL;
+	libvslvm_extent_run_t *last_allocation = NULL;
+	static char *function                  = "libvslvm_internal_physical_volume_sort_allocations";
+	int allocation_index                   = 0;
+	int number_of_allocations              = 0;
+
+	if( internal_physical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_physical_volume->allocations_array,
+	     &number_of_allocations,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of allocations from array.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_allocations == 0 )
+	{
+		return( 1 );
+	}
+	if( (size_t) number_of_allocations > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libvslvm_extent_run_t * ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of allocations value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	allocations = (libvslvm_extent_run_t **) memory_allocate(
+	                                          sizeof( libvslvm_extent_run_t * ) * number_of_allocations );
+
+	if( allocations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create allocations.",
+		 function );
+
+		goto on_error;
+	}
+	for( allocation_index = 0;
+	     allocation_index < number_of_allocations;
+	     allocation_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_physical_volume->allocations_array,
+		     allocation_index,
+		     (intptr_t **) &allocation,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve allocation: %d.",
+			 function,
+			 allocation_index );
+
+			goto on_error;
+		}
+		if( allocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing allocation: %d.",
+			 function,
+			 allocation_index );
+
+			goto on_error;
+		}
+		allocations[ allocation_index ] = allocation;
+	}
+	qsort(
+	 allocations,
+	 (size_t) number_of_allocations,
+	 sizeof( libvslvm_extent_run_t * ),
+	 &libvslvm_extent_run_compare_references_by_physical_offset );
+
+	/* The allocations are stored back into the array in sorted order
+	 * the array keeps ownership of the extent runs
+	 */
+	for( allocation_index = 0;
+	     allocation_index < number_of_allocations;
+	     allocation_index++ )
+	{
+		allocation = allocations[ allocation_index ];
+
+		if( last_allocation != NULL )
+		{
+			if( allocation->physical_offset < ( last_allocation->physical_offset + (off64_t) last_allocation->size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid allocation of logical volume: %d at offset: 0x%08" PRIx64 " overlaps with allocation of logical volume: %d at offset: 0x%08" PRIx64 ".",
+				 function,
+				 allocation->logical_volume_index,
+				 allocation->physical_offset,
+				 last_allocation->logical_volume_index,
+				 last_allocation->physical_offset );
+
+				goto on_error;
+			}
+		}
+		if( libcdata_array_set_entry_by_index(
+		     internal_physical_volume->allocations_array,
+		     allocation_index,
+		     (intptr_t *) allocation,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set allocation: %d.",
+			 function,
+			 allocation_index );
+
+			goto on_error;
+		}
+		last_allocation = allocation;
+	}
+	memory_free(
+	 allocations );
+
+	return( 1 );
+
+on_error:
+	if( allocations != NULL )
+	{
+		memory_free(
+		 allocations );
+	}
+	return( -1 );
+}
+
+/* Appends a segment to volume values of the physical volume
+ * The segment consists of a single stripe that refers to the physical volume
+ * The data area offset is relative to the start of the physical volume data areas
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_internal_physical_volume_append_volume_segment(
+     libvslvm_internal_physical_volume_t *internal_physical_volume,
+     libvslvm_logical_volume_values_t *volume_values,
+     off64_t segment_offset,
+     off64_t data_area_offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libvslvm_segment_t *segment = NULL;
+	libvslvm_stripe_t *stripe   = NULL;
+	static char *function       = "libvslvm_internal_physical_volume_append_volume_segment";
+
+	if( internal_physical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvslvm_stripe_initialize(
+	     &stripe,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create stripe.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvslvm_internal_stripe_set_physical_volume_name(
+	     (libvslvm_internal_stripe_t *) stripe,
+	     internal_physical_volume->name,
+	     internal_physical_volume->name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set physical volume name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvslvm_stripe_set_data_area_offset(
+	     stripe,
+	     data_area_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data area offset.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvslvm_segment_initialize(
+	     &segment,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create segment.",
+		 function );
+
+		goto on_error;
+	}
+	( (libvslvm_internal_segment_t *) segment )->offset = segment_offset;
+	( (libvslvm_internal_segment_t *) segment )->size   = size;
+
+	if( libvslvm_segment_append_stripe(
+	     segment,
+	     stripe,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append stripe to segment.",
+		 function );
+
+		goto on_error;
+	}
+	stripe = NULL;
+
+	if( libvslvm_logical_volume_values_append_segment(
+	     volume_values,
+	     segment,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append segment to volume values.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( segment != NULL )
+	{
+		libvslvm_internal_segment_free(
+		 (libvslvm_internal_segment_t **) &segment,
+		 NULL );
+	}
+	if( stripe != NULL )
+	{
+		libvslvm_internal_stripe_free(
+		 (libvslvm_internal_stripe_t **) &stripe,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends an unallocated extent run
+ * The (logical) offset of the extent run is relative to the start of the unallocated space of the physical volume
+ * The data area offset is relative to the start of the physical volume data areas
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_internal_physical_volume_append_unallocated_extent_run(
+     libvslvm_internal_physical_volume_t *internal_physical_volume,
+     off64_t unallocated_offset,
+     off64_t physical_volume_offset,
+     off64_t data_area_offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libvslvm_extent_run_t *extent_run = NULL;
+	static char *function             = "libvslvm_internal_physical_volume_append_unallocated_extent_run";
+	int entry_index                   = 0;
+
+	if( internal_physical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvslvm_extent_run_initialize(
+	     &extent_run,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extent run.",
+		 function );
+
+		goto on_error;
+	}
+	extent_run->logical_offset        = unallocated_offset;
+	extent_run->size                  = size;
+	extent_run->physical_volume_index = internal_physical_volume->volume_index;
+	extent_run->physical_offset       = physical_volume_offset;
+	extent_run->logical_volume_index  = -1;
+	extent_run->type                  = LIBVSLVM_EXTENT_RUN_TYPE_UNALLOCATED;
+
+	if( libcdata_array_append_entry(
+	     internal_physical_volume->unallocated_extent_runs_array,
+	     &entry_index,
+	     (intptr_t *) extent_run,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append extent run to array.",
+		 function );
+
+		goto on_error;
+	}
+	extent_run = NULL;
+
+	if( internal_physical_volume->unallocated_volume_values == NULL )
+	{
+		return( 1 );
+	}
+	if( libvslvm_internal_physical_volume_append_volume_segment(
+	     internal_physical_volume,
+	     internal_physical_volume->unallocated_volume_values,
+	     unallocated_offset,
+	     data_area_offset,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append segment to unallocated volume values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( extent_run != NULL )
+	{
+		libvslvm_extent_run_free(
+		 &extent_run,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Builds the unallocated extent runs from the data areas and the allocations
+ * The data area volume values, that contain the data areas stored consecutively, are built as well
+ * The volume size is used for a data area that extends to the end of the physical volume
+ * Only whole extents of the data areas are considered
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_internal_physical_volume_build_unallocated_extent_runs(
+     libvslvm_internal_physical_volume_t *internal_physical_volume,
+     size64_t volume_size,
+     size64_t extent_size,
+     libcerror_error_t **error )
+{
+	libvslvm_data_area_descriptor_t *data_area_descriptor = NULL;
+	libvslvm_extent_run_t *allocation                     = NULL;
+	static char *function                                 = "libvslvm_internal_physical_volume_build_unallocated_extent_runs";
+	off64_t allocation_end_offset                         = 0;
+	off64_t data_area_end_offset                          = 0;
+	off64_t data_area_volume_offset                       = 0;
+	off64_t physical_volume_offset                        = 0;
+	off64_t unallocated_offset                            = 0;
+	size64_t data_area_size                               = 0;
+	int allocation_index                                  = 0;
+	int data_area_descriptor_index                        = 0;
+	int number_of_allocations                             = 0;
+	int number_of_data_area_descriptors                   = 0;
+
+	if( internal_physical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid volume size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_empty(
+	     internal_physical_volume->unallocated_extent_runs_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libvslvm_extent_run_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to empty unallocated extent runs array.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvslvm_logical_volume_values_free(
+	     &( internal_physical_volume->unallocated_volume_values ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free unallocated volume values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_physical_volume->name != NULL )
+	{
+		if( libvslvm_logical_volume_values_initialize(
+		     &( internal_physical_volume->unallocated_volume_values ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create unallocated volume values.",
+			 function );
+
+			return( -1 );
+		}
+		if( libvslvm_logical_volume_values_set_name(
+		     internal_physical_volume->unallocated_volume_values,
+		     "unallocated",
+		     12,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set unallocated volume values name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libvslvm_logical_volume_values_free(
+	     &( internal_physical_volume->data_area_volume_values ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free data area volume values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_physical_volume->name != NULL )
+	{
+		if( libvslvm_logical_volume_values_initialize(
+		     &( internal_physical_volume->data_area_volume_values ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create data area volume values.",
+			 function );
+
+			return( -1 );
+		}
+		if( libvslvm_logical_volume_values_set_name(
+		     internal_physical_volume->data_area_volume_values,
+		     "data_area",
+		     10,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set data area volume values name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_physical_volume->data_area_descriptors_array,
+	     &number_of_data_area_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data area descriptors from array.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_physical_volume->allocations_array,
+	     &number_of_allocations,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of allocations from array.",
+		 function );
+
+		return( -1 );
+	}
+	for( data_area_descriptor_index = 0;
+	     data_area_descriptor_index < number_of_data_area_descriptors;
+	     data_area_descriptor_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_physical_volume->data_area_descriptors_array,
+		     data_area_descriptor_index,
+		     (intptr_t **) &data_area_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data area descriptor: %d.",
+			 function,
+			 data_area_descriptor_index );
+
+			return( -1 );
+		}
+		if( data_area_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing data area descriptor: %d.",
+			 function,
+			 data_area_descriptor_index );
+
+			return( -1 );
+		}
+		if( data_area_descriptor->offset >= (uint64_t) volume_size )
+		{
+			continue;
+		}
+		physical_volume_offset = (off64_t) data_area_descriptor->offset;
+		data_area_size   = volume_size - data_area_descriptor->offset;
+
+		if( ( data_area_descriptor->size != 0 )
+		 && ( data_area_descriptor->size < data_area_size ) )
+		{
+			data_area_size = data_area_descriptor->size;
+		}
+		if( extent_size != 0 )
+		{
+			data_area_size -= data_area_size % extent_size;
+		}
+		data_area_end_offset = physical_volume_offset + (off64_t) data_area_size;
+
+		if( ( internal_physical_volume->data_area_volume_values != NULL )
+		 && ( data_area_size > 0 ) )
+		{
+			if( libvslvm_internal_physical_volume_append_volume_segment(
+			     internal_physical_volume,
+			     internal_physical_volume->data_area_volume_values,
+			     data_area_volume_offset,
+			     (off64_t) data_area_descriptor->data_offset,
+			     data_area_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append segment to data area volume values.",
+				 function );
+
+				return( -1 );
+			}
+			data_area_volume_offset += (off64_t) data_area_size;
+		}
+		/* The allocations are sorted by physical volume offset hence
+		 * the unallocated ranges are the gaps between them
+		 */
+		for( allocation_index = 0;
+		     allocation_index < number_of_allocations;
+		     allocation_index++ )
+		{
+			if( physical_volume_offset >= data_area_end_offset )
+			{
+				break;
+			}
+			if( libcdata_array_get_entry_by_index(
+			     internal_physical_volume->allocations_array,
+			     allocation_index,
+			     (intptr_t **) &allocation,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve allocation: %d.",
+				 function,
+				 allocation_index );
+
+				return( -1 );
+			}
+			if( allocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing allocation: %d.",
+				 function,
+				 allocation_index );
+
+				return( -1 );
+			}
+			allocation_end_offset = allocation->physical_offset + (off64_t) allocation->size;
+
+			if( allocation_end_offset <= physical_volume_offset )
+			{
+				continue;
+			}
+			if( allocation->physical_offset >= data_area_end_offset )
+			{
+				break;
+			}
+			if( allocation->physical_offset > physical_volume_offset )
+			{
+				if( libvslvm_internal_physical_volume_append_unallocated_extent_run(
+				     internal_physical_volume,
+				     unallocated_offset,
+				     physical_volume_offset,
+				     (off64_t) data_area_descriptor->data_offset + ( physical_volume_offset - (off64_t) data_area_descriptor->offset ),
+				     (size64_t) ( allocation->physical_offset - physical_volume_offset ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append unallocated extent run.",
+					 function );
+
+					return( -1 );
+				}
+				unallocated_offset += allocation->physical_offset - physical_volume_offset;
+			}
+			physical_volume_offset = allocation_end_offset;
+		}
+		if( physical_volume_offset < data_area_end_offset )
+		{
+			if( libvslvm_internal_physical_volume_append_unallocated_extent_run(
+			     internal_physical_volume,
+			     unallocated_offset,
+			     physical_volume_offset,
+			     (off64_t) data_area_descriptor->data_offset + ( physical_volume_offset - (off64_t) data_area_descriptor->offset ),
+			     (size64_t) ( data_area_end_offset - physical_volume_offset ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append unallocated extent run.",
+				 function );
+
+				return( -1 );
+			}
+			unallocated_offset += data_area_end_offset - physical_volume_offset;
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the logical volume location of a specific physical volume offset
+ * The allocations are sorted by physical volume offset and looked up using a binary search
+ * The contiguous size is the number of bytes, starting at the offset, that are stored contiguously in the logical volume
+ * or if the offset is not allocated, the number of bytes up to the next allocation or the end of the physical volume
+ * If the offset is part of a striped logical volume the logical volume offset is set to -1
+ * and the contiguous size is the number of bytes, starting at the offset, that are allocated to the logical volume
+ * Returns 1 if successful, 0 if the offset is not allocated to a logical volume or -1 on error
+ */
+int libvslvm_physical_volume_get_logical_location(
+     libvslvm_physical_volume_t *physical_volume,
+     off64_t offset,
+     int *logical_volume_index,
+     off64_t *logical_volume_offset,
+     size64_t *contiguous_size,
+     libcerror_error_t **error )
+{
+	libvslvm_extent_run_t *allocation                             = NULL;
+	libvslvm_internal_physical_volume_t *internal_physical_volume = NULL;
+	static char *function                                         = "libvslvm_physical_volume_get_logical_location";
+	off64_t relative_offset                                       = 0;
+	int lower_index                                               = 0;
+	int middle_index                                              = 0;
+	int number_of_allocations                                     = 0;
+	int upper_index                                               = 0;
+
+	if( physical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_physical_volume = (libvslvm_internal_physical_volume_t *) physical_volume;
+
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( logical_volume_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume index.",
+		 function );
+
+		return( -1 );
+	}
+	if( logical_volume_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( contiguous_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid contiguous size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_physical_volume->allocations_array,
+	     &number_of_allocations,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of allocations from array.",
+		 function );
+
+		return( -1 );
+	}
+	upper_index = number_of_allocations;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( libcdata_array_get_entry_by_index(
+		     internal_physical_volume->allocations_array,
+		     middle_index,
+		     (intptr_t **) &allocation,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve allocation: %d.",
+			 function,
+			 middle_index );
+
+			return( -1 );
+		}
+		if( allocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing allocation: %d.",
+			 function,
+			 middle_index );
+
+			return( -1 );
+		}
+		if( offset < allocation->physical_offset )
+		{
+			upper_index = middle_index;
+		}
+		else if( (size64_t) ( offset - allocation->physical_offset ) >= allocation->size )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			relative_offset = offset - allocation->physical_offset;
+
+			*logical_volume_index = allocation->logical_volume_index;
+
+			/* The stripe size is not known hence the logical volume offset
+			 * of a striped allocation cannot be determined
+			 */
+			if( allocation->type == LIBVSLVM_EXTENT_RUN_TYPE_STRIPED )
+			{
+				*logical_volume_offset = -1;
+			}
+			else
+			{
+				*logical_volume_offset = allocation->logical_offset + relative_offset;
+			}
+			*contiguous_size = allocation->size - (size64_t) relative_offset;
+
+			return( 1 );
+		}
+	}
+	/* The lower index now refers to the first allocation after the offset
+	 */
+	if( lower_index < number_of_allocations )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_physical_volume->allocations_array,
+		     lower_index,
+		     (intptr_t **) &allocation,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve allocation: %d.",
+			 function,
+			 lower_index );
+
+			return( -1 );
+		}
+		if( allocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing allocation: %d.",
+			 function,
+			 lower_index );
+
+			return( -1 );
+		}
+		*contiguous_size = (size64_t) ( allocation->physical_offset - offset );
+	}
+	else if( (size64_t) offset < internal_physical_volume->size )
+	{
+		*contiguous_size = internal_physical_volume->size - (size64_t) offset;
+	}
+	else
+	{
+		*contiguous_size = 0;
+	}
+	return( 0 );
+}
+
+/* Retrieves the number of unallocated extent runs
+ * An unallocated extent run is a range of whole extents of the physical volume data areas that is not used by a logical volume
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_physical_volume_get_number_of_unallocated_extent_runs(
+     libvslvm_physical_volume_t *physical_volume,
+     int *number_of_extent_runs,
+     libcerror_error_t **error )
+{
+	libvslvm_internal_physical_volume_t *internal_physical_volume = NULL;
+	static char *function                                         = "libvslvm_physical_volume_get_number_of_unallocated_extent_runs";
+
+	if( physical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_physical_volume = (libvslvm_internal_physical_volume_t *) physical_volume;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_physical_volume->unallocated_extent_runs_array,
+	     number_of_extent_runs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of unallocated extent runs from array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific unallocated extent run
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_physical_volume_get_unallocated_extent_run_by_index(
+     libvslvm_physical_volume_t *physical_volume,
+     int extent_run_index,
+     off64_t *offset,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libvslvm_extent_run_t *extent_run                             = NULL;
+	libvslvm_internal_physical_volume_t *internal_physical_volume = NULL;
+	static char *function                                         = "libvslvm_physical_volume_get_unallocated_extent_run_by_index";
+
+	if( physical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_physical_volume = (libvslvm_internal_physical_volume_t *) physical_volume;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_physical_volume->unallocated_extent_runs_array,
+	     extent_run_index,
+	     (intptr_t **) &extent_run,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve unallocated extent run: %d.",
+		 function,
+		 extent_run_index );
+
+		return( -1 );
+	}
+	if( extent_run == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing unallocated extent run: %d.",
+		 function,
+		 extent_run_index );
+
+		return( -1 );
+	}
+	*offset = extent_run->physical_offset;
+	*size   = extent_run->size;
+
+	return( 1 );
+}
+
+/* TODO move function into libvslvm_physical_volume_label.c */
+
+/* Reads a physical volume label
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libvslvm_internal_physical_volume_read_label_data(
+     libvslvm_internal_physical_volume_t *internal_physical_volume,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libvslvm_data_area_descriptor_t *data_area_descriptor = NULL;
+	static char *function                                 = "libvslvm_internal_physical_volume_read_label_data";
+	size_t data_offset                                    = 0;
+	uint64_t data_areas_size                              = 0;
+	uint64_t offset                                       = 0;
+	uint64_t size                                         = 0;
+	uint32_t calculated_checksum                          = 0;
+	uint32_t stored_checksum                              = 0;
+	int entry_index                                       = 0;
+	int result                                            = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint64_t value_64bit                                  = 0;
+	uint32_t value_32bit                                  = 0;
+#endif
+
+	if( internal_physical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: physical volume label data:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 512,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: physical volume label header:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 sizeof( vslvm_physical_volume_label_header_t ),
 		 0 );
 	}
 #endif
@@ -1584,6 +3061,24 @@ int libvslvm_internal_physical_volume_read_label_data(
 
 				goto on_error;
 			}
+			/* The data areas are consecutive in the physical volume data
+			 * a data area of size 0 extends to the end of the physical volume
+			 */
+			data_area_descriptor->data_offset = data_areas_size;
+
+			if( size > ( (uint64_t) INT64_MAX - data_areas_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid data area size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			data_areas_size += size;
+
 			if( libcdata_array_append_entry(
 			     internal_physical_volume->data_area_descriptors_array,
 			     &entry_index,
@@ -1735,6 +3230,9 @@ on_error:
 }
 
 /* Reads a physical volume label
+ * The physical volume label can be stored in one of the first 4 512-byte sectors,
+ * these are read at once and the label is searched for in memory
+ * A physical volume smaller than 2048 bytes is only searched up to its end
  * Returns 1 if successful, 0 if not found or -1 on error
  */
 int libvslvm_physical_volume_read_label_file_io_pool(
@@ -1744,10 +3242,11 @@ int libvslvm_physical_volume_read_label_file_io_pool(
      off64_t file_offset,
      libcerror_error_t **error )
 {
-	uint8_t physical_volume_label_data[ 512 ];
+	uint8_t label_data[ LIBVSLVM_PHYSICAL_VOLUME_LABEL_NUMBER_OF_SECTORS * LIBVSLVM_PHYSICAL_VOLUME_LABEL_SIZE ];
 
 	libvslvm_internal_physical_volume_t *internal_physical_volume = NULL;
 	static char *function                                         = "libvslvm_physical_volume_read_label_file_io_pool";
+	size_t label_data_offset                                      = 0;
 	ssize_t read_count                                            = 0;
 	int result                                                    = 0;
 
@@ -1768,49 +3267,82 @@ int libvslvm_physical_volume_read_label_file_io_pool(
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: reading physical volume label at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 "%s: reading physical volume label sectors at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
 		 function,
 		 file_offset,
 		 file_offset );
 	}
 #endif
+	/* A short read is not an error since the physical volume can be smaller
+	 * than the 4 sectors, only the sectors that were read are searched
+	 */
 	read_count = libbfio_pool_read_buffer_at_offset(
 	              file_io_pool,
 	              file_io_pool_entry,
-	              physical_volume_label_data,
-	              512,
+	              label_data,
+	              LIBVSLVM_PHYSICAL_VOLUME_LABEL_NUMBER_OF_SECTORS * LIBVSLVM_PHYSICAL_VOLUME_LABEL_SIZE,
 	              file_offset,
 	              error );
 
-	if( read_count != (ssize_t) 512 )
+	if( read_count < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read physical volume label at offset %" PRIi64 " (0x%08" PRIx64 ").",
+		 "%s: unable to read physical volume label sectors at offset %" PRIi64 " (0x%08" PRIx64 ").",
 		 function,
 		 file_offset,
 		 file_offset );
 
 		return( -1 );
 	}
-	result = libvslvm_internal_physical_volume_read_label_data(
-	          internal_physical_volume,
-	          physical_volume_label_data,
-	          512,
-	          error );
+	/* The physical volume label is stored on a 512-byte boundary
+	 */
+	for( label_data_offset = 0;
+	     ( label_data_offset + LIBVSLVM_PHYSICAL_VOLUME_LABEL_SIZE ) <= (size_t) read_count;
+	     label_data_offset += LIBVSLVM_PHYSICAL_VOLUME_LABEL_SIZE )
+	{
+		if( memory_compare(
+		     &( label_data[ label_data_offset ] ),
+		     vslvm_physical_volume_label_signature,
+		     8 ) != 0 )
+		{
+			continue;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: physical volume label found at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+			 function,
+			 file_offset + (off64_t) label_data_offset,
+			 file_offset + (off64_t) label_data_offset );
+		}
+#endif
+		result = libvslvm_internal_physical_volume_read_label_data(
+		          internal_physical_volume,
+		          &( label_data[ label_data_offset ] ),
+		          LIBVSLVM_PHYSICAL_VOLUME_LABEL_SIZE,
+		          error );
 
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read physical volume label.",
-		 function );
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read physical volume label at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset + (off64_t) label_data_offset,
+			 file_offset + (off64_t) label_data_offset );
 
-		return( -1 );
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			break;
+		}
 	}
 	return( result );
 }
@@ -1833,7 +3365,6 @@ int libvslvm_physical_volume_read_element_data(
 {
 	libvslvm_physical_volume_t *physical_volume = NULL;
 	static char *function                       = "libvslvm_physical_volume_read_element_data";
-	off64_t label_offset                        = 0;
 	int result                                  = 0;
 
 	LIBVSLVM_UNREFERENCED_PARAMETER( data_handle )
@@ -1854,36 +3385,24 @@ int libvslvm_physical_volume_read_element_data(
 
 		goto on_error;
 	}
-	/* The physical volume label can be stored in one of the first 4 sectors
-	 */
-	label_offset = 0;
+	result = libvslvm_physical_volume_read_label_file_io_pool(
+	          physical_volume,
+	          file_io_pool,
+	          file_io_pool_entry,
+	          physical_volume_offset,
+	          error );
 
-	while( label_offset < 2048 )
+	if( result == -1 )
 	{
-		result = libvslvm_physical_volume_read_label_file_io_pool(
-			  physical_volume,
-			  file_io_pool,
-			  file_io_pool_entry,
-			  physical_volume_offset + label_offset,
-			  error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read physical volume label at offset: %" PRIi64 ".",
-			 function,
-			 physical_volume_offset + label_offset );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read physical volume label at offset: %" PRIi64 ".",
+		 function,
+		 physical_volume_offset );
 
-			goto on_error;
-		}
-		else if( result != 0 )
-		{
-			break;
-		}
-		label_offset += 512;
+		goto on_error;
 	}
 	if( result != 1 )
 	{
@@ -31,6 +31,7 @@
 #include "libvslvm_libcdata.h"
 #include "libvslvm_libcerror.h"
 #include "libvslvm_libfdata.h"
+#include "libvslvm_logical_volume_values.h"
 #include "libvslvm_types.h"
 
 #if defined( __cplusplus )
@@ -67,6 +68,11 @@ struct libvslvm_internal_physical_volume
 	 */
 	size64_t size;
 
+	/* The index of the physical volume in the volume group
+	 * which corresponds with the physical volume file IO pool entry
+	 */
+	int volume_index;
+
 	/* The data area descriptors array
 	 */
 	libcdata_array_t *data_area_descriptors_array;
@@ -74,6 +80,26 @@ struct libvslvm_internal_physical_volume
 	/* The metadata area descriptors array
 	 */
 	libcdata_array_t *metadata_area_descriptors_array;
+
+	/* The allocations array
+	 * Contains the extent runs of the logical volumes stored on the physical volume sorted by physical volume offset
+	 * where a stripe of a striped segment is stored as a single extent run
+	 */
+	libcdata_array_t *allocations_array;
+
+	/* The unallocated extent runs array
+	 */
+	libcdata_array_t *unallocated_extent_runs_array;
+
+	/* The unallocated volume values
+	 * Contains a segment per unallocated extent run so that the unallocated space can be read as a logical volume
+	 */
+	libvslvm_logical_volume_values_t *unallocated_volume_values;
+
+	/* The data area volume values
+	 * Contains a segment per data area so that the data areas can be read as a logical volume
+	 */
+	libvslvm_logical_volume_values_t *data_area_volume_values;
 };
 
 int libvslvm_physical_volume_initialize(
@@ -169,6 +195,12 @@ int libvslvm_physical_volume_get_data_area_descriptor(
      libvslvm_data_area_descriptor_t **data_area_descriptor,
      libcerror_error_t **error );
 
+int libvslvm_internal_physical_volume_get_data_area_descriptor_by_index(
+     libvslvm_internal_physical_volume_t *internal_physical_volume,
+     int data_area_descriptor_index,
+     libvslvm_data_area_descriptor_t **data_area_descriptor,
+     libcerror_error_t **error );
+
 int libvslvm_physical_volume_get_data_area_descriptor_by_offset(
      libvslvm_physical_volume_t *physical_volume,
      uint64_t offset,
@@ -186,6 +218,64 @@ int libvslvm_physical_volume_get_metadata_area_descriptor(
      libvslvm_data_area_descriptor_t **data_area_descriptor,
      libcerror_error_t **error );
 
+int libvslvm_internal_physical_volume_append_allocation(
+     libvslvm_internal_physical_volume_t *internal_physical_volume,
+     off64_t physical_volume_offset,
+     size64_t size,
+     int logical_volume_index,
+     off64_t logical_volume_offset,
+     uint8_t allocation_type,
+     libcerror_error_t **error );
+
+int libvslvm_internal_physical_volume_sort_allocations(
+     libvslvm_internal_physical_volume_t *internal_physical_volume,
+     libcerror_error_t **error );
+
+int libvslvm_internal_physical_volume_append_volume_segment(
+     libvslvm_internal_physical_volume_t *internal_physical_volume,
+     libvslvm_logical_volume_values_t *volume_values,
+     off64_t segment_offset,
+     off64_t data_area_offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libvslvm_internal_physical_volume_append_unallocated_extent_run(
+     libvslvm_internal_physical_volume_t *internal_physical_volume,
+     off64_t unallocated_offset,
+     off64_t physical_volume_offset,
+     off64_t data_area_offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libvslvm_internal_physical_volume_build_unallocated_extent_runs(
+     libvslvm_internal_physical_volume_t *internal_physical_volume,
+     size64_t volume_size,
+     size64_t extent_size,
+     libcerror_error_t **error );
+
+LIBVSLVM_EXTERN \
+int libvslvm_physical_volume_get_logical_location(
+     libvslvm_physical_volume_t *physical_volume,
+     off64_t offset,
+     int *logical_volume_index,
+     off64_t *logical_volume_offset,
+     size64_t *contiguous_size,
+     libcerror_error_t **error );
+
+LIBVSLVM_EXTERN \
+int libvslvm_physical_volume_get_number_of_unallocated_extent_runs(
+     libvslvm_physical_volume_t *physical_volume,
+     int *number_of_extent_runs,
+     libcerror_error_t **error );
+
+LIBVSLVM_EXTERN \
+int libvslvm_physical_volume_get_unallocated_extent_run_by_index(
+     libvslvm_physical_volume_t *physical_volume,
+     int extent_run_index,
+     off64_t *offset,
+     size64_t *size,
+     libcerror_error_t **error );
+
 int libvslvm_internal_physical_volume_read_label_data(
      libvslvm_internal_physical_volume_t *internal_physical_volume,
      const uint8_t *data,
@@ -0,0 +1,632 @@
+/*
+ * String index functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libvslvm_definitions.h"
+#include "libvslvm_libcdata.h"
+#include "libvslvm_libcerror.h"
+#include "libvslvm_string_index.h"
+
+/* Creates a string index
+ * Make sure the value string_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_string_index_initialize(
+     libvslvm_string_index_t **string_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libvslvm_string_index_initialize";
+
+	if( string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid string index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*string_index = memory_allocate_structure(
+	                 libvslvm_string_index_t );
+
+	if( *string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create string index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *string_index,
+	     0,
+	     sizeof( libvslvm_string_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear string index.",
+		 function );
+
+		memory_free(
+		 *string_index );
+
+		*string_index = NULL;
+
+		return( -1 );
+	}
+	if( libcdata_btree_initialize(
+	     &( ( *string_index )->values_tree ),
+	     LIBVSLVM_INDEX_TREE_MAXIMUM_NUMBER_OF_SUB_NODES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create values tree.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *string_index != NULL )
+	{
+		memory_free(
+		 *string_index );
+
+		*string_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a string index
+ * The values referenced by the index are not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_string_index_free(
+     libvslvm_string_index_t **string_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libvslvm_string_index_free";
+	int result            = 1;
+
+	if( string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_index != NULL )
+	{
+		if( libcdata_btree_free(
+		     &( ( *string_index )->values_tree ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libvslvm_string_index_value_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free values tree.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *string_index );
+
+		*string_index = NULL;
+	}
+	return( result );
+}
+
+/* Frees a string index value
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_string_index_value_free(
+     libvslvm_string_index_value_t **string_index_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libvslvm_string_index_value_free";
+
+	if( string_index_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string index value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_index_value != NULL )
+	{
+		/* The key and value references are freed elsewhere
+		 */
+		memory_free(
+		 *string_index_value );
+
+		*string_index_value = NULL;
+	}
+	return( 1 );
+}
+
+/* Compares two string index values
+ * The values are ordered by hash, key length and key
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libvslvm_string_index_value_compare(
+     libvslvm_string_index_value_t *first_string_index_value,
+     libvslvm_string_index_value_t *second_string_index_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libvslvm_string_index_value_compare";
+	int result            = 0;
+
+	if( first_string_index_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first string index value.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_string_index_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second string index value.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_string_index_value->hash < second_string_index_value->hash )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_string_index_value->hash > second_string_index_value->hash )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	if( first_string_index_value->key_length < second_string_index_value->key_length )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_string_index_value->key_length > second_string_index_value->key_length )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	if( first_string_index_value->key_length > 0 )
+	{
+		result = memory_compare(
+		          first_string_index_value->key,
+		          second_string_index_value->key,
+		          first_string_index_value->key_length );
+
+		if( result < 0 )
+		{
+			return( LIBCDATA_COMPARE_LESS );
+		}
+		else if( result > 0 )
+		{
+			return( LIBCDATA_COMPARE_GREATER );
+		}
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
+/* Calculates the hash of a key
+ * The hash is a 32-bit Fowler-Noll-Vo (FNV-1a) hash
+ * Returns the hash
+ */
+uint32_t libvslvm_string_index_calculate_hash(
+          const char *key,
+          size_t key_length )
+{
+	size_t key_index = 0;
+	uint32_t hash    = 0x811c9dc5UL;
+
+	if( key == NULL )
+	{
+		return( 0 );
+	}
+	for( key_index = 0;
+	     key_index < key_length;
+	     key_index++ )
+	{
+		hash ^= (uint8_t) key[ key_index ];
+		hash *= 0x01000193UL;
+	}
+	return( hash );
+}
+
+/* Inserts a value into the string index
+ * Returns 1 if successful, 0 if a value with the same key already exists or -1 on error
+ */
+int libvslvm_string_index_insert_value(
+     libvslvm_string_index_t *string_index,
+     const char *key,
+     size_t key_length,
+     intptr_t *value,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *upper_node                  = NULL;
+	libvslvm_string_index_value_t *existing_value     = NULL;
+	libvslvm_string_index_value_t *string_index_value = NULL;
+	static char *function                             = "libvslvm_string_index_insert_value";
+	int result                                        = 0;
+	int value_index                                   = 0;
+
+	if( string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	string_index_value = memory_allocate_structure(
+	                      libvslvm_string_index_value_t );
+
+	if( string_index_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create string index value.",
+		 function );
+
+		goto on_error;
+	}
+	string_index_value->hash       = libvslvm_string_index_calculate_hash(
+	                                  key,
+	                                  key_length );
+	string_index_value->key        = key;
+	string_index_value->key_length = key_length;
+	string_index_value->value      = value;
+
+	result = libcdata_btree_insert_value(
+	          string_index->values_tree,
+	          &value_index,
+	          (intptr_t *) string_index_value,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libvslvm_string_index_value_compare,
+	          &upper_node,
+	          (intptr_t **) &existing_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert value into values tree.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		memory_free(
+		 string_index_value );
+	}
+	else
+	{
+		string_index_value->value_index = value_index;
+	}
+	return( result );
+
+on_error:
+	if( string_index_value != NULL )
+	{
+		memory_free(
+		 string_index_value );
+	}
+	return( -1 );
+}
+
+/* Removes a value from the string index
+ * The value is only removed if the key refers to the same value
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libvslvm_string_index_remove_value(
+     libvslvm_string_index_t *string_index,
+     const char *key,
+     size_t key_length,
+     intptr_t *value,
+     libcerror_error_t **error )
+{
+	libvslvm_string_index_value_t search_value;
+
+	libcdata_tree_node_t *upper_node              = NULL;
+	libvslvm_string_index_value_t *existing_value = NULL;
+	static char *function                         = "libvslvm_string_index_remove_value";
+	int result                                    = 0;
+	int value_index                               = 0;
+
+	if( string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	search_value.hash        = libvslvm_string_index_calculate_hash(
+	                            key,
+	                            key_length );
+	search_value.key         = key;
+	search_value.key_length  = key_length;
+	search_value.value       = NULL;
+	search_value.value_index = 0;
+
+	result = libcdata_btree_get_value_by_value(
+	          string_index->values_tree,
+	          (intptr_t *) &search_value,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libvslvm_string_index_value_compare,
+	          &upper_node,
+	          (intptr_t **) &existing_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from values tree.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( existing_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing existing value.",
+		 function );
+
+		return( -1 );
+	}
+	if( existing_value->value != value )
+	{
+		return( 0 );
+	}
+	value_index = existing_value->value_index;
+
+	if( libcdata_btree_remove_value(
+	     string_index->values_tree,
+	     upper_node,
+	     &value_index,
+	     (intptr_t *) existing_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove value from values tree.",
+		 function );
+
+		return( -1 );
+	}
+	memory_free(
+	 existing_value );
+
+	return( 1 );
+}
+
+/* Retrieves a value from the string index by its key
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libvslvm_string_index_get_value_by_key(
+     libvslvm_string_index_t *string_index,
+     const char *key,
+     size_t key_length,
+     intptr_t **value,
+     libcerror_error_t **error )
+{
+	libvslvm_string_index_value_t search_value;
+
+	libcdata_tree_node_t *upper_node              = NULL;
+	libvslvm_string_index_value_t *existing_value = NULL;
+	static char *function                         = "libvslvm_string_index_get_value_by_key";
+	int result                                    = 0;
+
+	if( string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	search_value.hash       = libvslvm_string_index_calculate_hash(
+	                           key,
+	                           key_length );
+	search_value.key        = key;
+	search_value.key_length = key_length;
+	search_value.value      = NULL;
+
+	result = libcdata_btree_get_value_by_value(
+	          string_index->values_tree,
+	          (intptr_t *) &search_value,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libvslvm_string_index_value_compare,
+	          &upper_node,
+	          (intptr_t **) &existing_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from values tree.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( existing_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing existing value.",
+			 function );
+
+			return( -1 );
+		}
+		*value = existing_value->value;
+	}
+	return( result );
+}
+
@@ -0,0 +1,117 @@
+/*
+ * String index functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSLVM_STRING_INDEX_H )
+#define _LIBVSLVM_STRING_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvslvm_libcdata.h"
+#include "libvslvm_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libvslvm_string_index_value libvslvm_string_index_value_t;
+
+struct libvslvm_string_index_value
+{
+	/* The hash of the key
+	 */
+	uint32_t hash;
+
+	/* The key
+	 * Note that the key is a reference to a string owned by the value
+	 */
+	const char *key;
+
+	/* The key length
+	 */
+	size_t key_length;
+
+	/* The value
+	 */
+	intptr_t *value;
+
+	/* The index of the value in the values tree
+	 */
+	int value_index;
+};
+
+typedef struct libvslvm_string_index libvslvm_string_index_t;
+
+struct libvslvm_string_index
+{
+	/* The values tree
+	 */
+	libcdata_btree_t *values_tree;
+};
+
+int libvslvm_string_index_initialize(
+     libvslvm_string_index_t **string_index,
+     libcerror_error_t **error );
+
+int libvslvm_string_index_free(
+     libvslvm_string_index_t **string_index,
+     libcerror_error_t **error );
+
+int libvslvm_string_index_value_free(
+     libvslvm_string_index_value_t **string_index_value,
+     libcerror_error_t **error );
+
+int libvslvm_string_index_value_compare(
+     libvslvm_string_index_value_t *first_string_index_value,
+     libvslvm_string_index_value_t *second_string_index_value,
+     libcerror_error_t **error );
+
+uint32_t libvslvm_string_index_calculate_hash(
+          const char *key,
+          size_t key_length );
+
+int libvslvm_string_index_insert_value(
+     libvslvm_string_index_t *string_index,
+     const char *key,
+     size_t key_length,
+     intptr_t *value,
+     libcerror_error_t **error );
+
+int libvslvm_string_index_remove_value(
+     libvslvm_string_index_t *string_index,
+     const char *key,
+     size_t key_length,
+     intptr_t *value,
+     libcerror_error_t **error );
+
+int libvslvm_string_index_get_value_by_key(
+     libvslvm_string_index_t *string_index,
+     const char *key,
+     size_t key_length,
+     intptr_t **value,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSLVM_STRING_INDEX_H ) */
+
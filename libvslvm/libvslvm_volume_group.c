@@ -21,8 +21,11 @@
 
 #include <common.h>
 #include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
+#include "libvslvm_definitions.h"
+#include "libvslvm_extent_run.h"
 #include "libvslvm_io_handle.h"
 #include "libvslvm_libbfio.h"
 #include "libvslvm_libcdata.h"
@@ -30,6 +33,7 @@
 #include "libvslvm_logical_volume.h"
 #include "libvslvm_logical_volume_values.h"
 #include "libvslvm_physical_volume.h"
+#include "libvslvm_string_index.h"
 #include "libvslvm_types.h"
 #include "libvslvm_volume_group.h"
 
@@ -111,6 +115,32 @@ int libvslvm_volume_group_initialize(
 
 		goto on_error;
 	}
+	if( libvslvm_string_index_initialize(
+	     &( internal_volume_group->physical_volumes_name_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create physical volumes name index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvslvm_string_index_initialize(
+	     &( internal_volume_group->physical_volumes_identifier_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create physical volumes identifier index.",
+		 function );
+
+		goto on_error;
+	}
 	if( libcdata_array_initialize(
 	     &( internal_volume_group->logical_volumes_array ),
 	     0,
@@ -125,6 +155,32 @@ int libvslvm_volume_group_initialize(
 
 		goto on_error;
 	}
+	if( libvslvm_string_index_initialize(
+	     &( internal_volume_group->logical_volumes_name_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create logical volumes name index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvslvm_string_index_initialize(
+	     &( internal_volume_group->logical_volumes_identifier_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create logical volumes identifier index.",
+		 function );
+
+		goto on_error;
+	}
 	*volume_group = (libvslvm_volume_group_t *) internal_volume_group;
 
 	return( 1 );
@@ -132,6 +188,31 @@ int libvslvm_volume_group_initialize(
 on_error:
 	if( internal_volume_group != NULL )
 	{
+		if( internal_volume_group->logical_volumes_name_index != NULL )
+		{
+			libvslvm_string_index_free(
+			 &( internal_volume_group->logical_volumes_name_index ),
+			 NULL );
+		}
+		if( internal_volume_group->logical_volumes_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_volume_group->logical_volumes_array ),
+			 NULL,
+			 NULL );
+		}
+		if( internal_volume_group->physical_volumes_identifier_index != NULL )
+		{
+			libvslvm_string_index_free(
+			 &( internal_volume_group->physical_volumes_identifier_index ),
+			 NULL );
+		}
+		if( internal_volume_group->physical_volumes_name_index != NULL )
+		{
+			libvslvm_string_index_free(
+			 &( internal_volume_group->physical_volumes_name_index ),
+			 NULL );
+		}
 		if( internal_volume_group->physical_volumes_array != NULL )
 		{
 			libcdata_array_free(
@@ -202,6 +283,58 @@ int libvslvm_internal_volume_group_free(
 			memory_free(
 			 ( *internal_volume_group )->name );
 		}
+		if( libvslvm_string_index_free(
+		     &( ( *internal_volume_group )->physical_volumes_name_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free physical volumes name index.",
+			 function );
+
+			result = -1;
+		}
+		if( libvslvm_string_index_free(
+		     &( ( *internal_volume_group )->physical_volumes_identifier_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free physical volumes identifier index.",
+			 function );
+
+			result = -1;
+		}
+		if( libvslvm_string_index_free(
+		     &( ( *internal_volume_group )->logical_volumes_name_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free logical volumes name index.",
+			 function );
+
+			result = -1;
+		}
+		if( libvslvm_string_index_free(
+		     &( ( *internal_volume_group )->logical_volumes_identifier_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free logical volumes identifier index.",
+			 function );
+
+			result = -1;
+		}
 		if( libcdata_array_free(
 		     &( ( *internal_volume_group )->physical_volumes_array ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libvslvm_internal_physical_volume_free,
@@ -888,9 +1021,7 @@ int libvslvm_volume_group_get_physical_volume_by_name(
 {
 	libvslvm_internal_volume_group_t *internal_volume_group = NULL;
 	static char *function                                   = "libvslvm_volume_group_get_physical_volume_by_name";
-	int number_of_volumes                                   = 0;
 	int result                                              = 0;
-	int volume_index                                        = 0;
 
 	if( volume_group == NULL )
 	{
@@ -927,66 +1058,95 @@ int libvslvm_volume_group_get_physical_volume_by_name(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     internal_volume_group->physical_volumes_array,
-	     &number_of_volumes,
-	     error ) != 1 )
+	result = libvslvm_string_index_get_value_by_key(
+	          internal_volume_group->physical_volumes_name_index,
+	          volume_name,
+	          volume_name_length,
+	          (intptr_t **) physical_volume,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements from physical volumes array.",
+		 "%s: unable to retrieve physical volume from name index.",
 		 function );
 
 		return( -1 );
 	}
-	for( volume_index = 0;
-	     volume_index < number_of_volumes;
-	     volume_index++ )
+	return( result );
+}
+
+/* Retrieves the physical volume for an ASCII encoded volume identifier
+ * Returns 1 if successful, 0 if no such physical volume or -1 on error
+ */
+int libvslvm_volume_group_get_physical_volume_by_identifier(
+     libvslvm_volume_group_t *volume_group,
+     const char *volume_identifier,
+     size_t volume_identifier_length,
+     libvslvm_physical_volume_t **physical_volume,
+     libcerror_error_t **error )
+{
+	libvslvm_internal_volume_group_t *internal_volume_group = NULL;
+	static char *function                                   = "libvslvm_volume_group_get_physical_volume_by_identifier";
+	int result                                              = 0;
+
+	if( volume_group == NULL )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     internal_volume_group->physical_volumes_array,
-		     volume_index,
-		     (intptr_t **) physical_volume,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve physical volume: %d.",
-			 function,
-			 volume_index );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume group.",
+		 function );
 
-			return( -1 );
-		}
-		result = libvslvm_physical_volume_compare_by_name(
-		          *physical_volume,
-		          volume_name,
-		          volume_name_length,
-		          error );
+		return( -1 );
+	}
+	internal_volume_group = (libvslvm_internal_volume_group_t *) volume_group;
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to compare name of physical volume: %d.",
-			 function,
-			 volume_index );
+	if( physical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical volume.",
+		 function );
 
-			return( -1 );
-		}
-		else if( result != 0 )
-		{
-			return( 1 );
-		}
+		return( -1 );
+	}
+	if( *physical_volume != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid physical volume value already set.",
+		 function );
+
+		return( -1 );
 	}
-	*physical_volume = NULL;
+	result = libvslvm_string_index_get_value_by_key(
+	          internal_volume_group->physical_volumes_identifier_index,
+	          volume_identifier,
+	          volume_identifier_length,
+	          (intptr_t **) physical_volume,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve physical volume from identifier index.",
+		 function );
 
-	return( 0 );
+		return( -1 );
+	}
+	return( result );
 }
 
 /* Appends a physical volume
@@ -997,9 +1157,11 @@ int libvslvm_volume_group_append_physical_volume(
      libvslvm_physical_volume_t *physical_volume,
      libcerror_error_t **error )
 {
-	libvslvm_internal_volume_group_t *internal_volume_group = NULL;
-	static char *function                                   = "libvslvm_volume_group_append_physical_volume";
-	int entry_index                                         = 0;
+	libvslvm_internal_physical_volume_t *internal_physical_volume = NULL;
+	libvslvm_internal_volume_group_t *internal_volume_group       = NULL;
+	static char *function                                         = "libvslvm_volume_group_append_physical_volume";
+	int entry_index                                               = 0;
+	int result                                                    = 0;
 
 	if( volume_group == NULL )
 	{
@@ -1040,7 +1202,83 @@ int libvslvm_volume_group_append_physical_volume(
 
 		return( -1 );
 	}
+	internal_physical_volume = (libvslvm_internal_physical_volume_t *) physical_volume;
+
+	internal_physical_volume->volume_index = entry_index;
+
+	/* If multiple physical volumes share the same name or identifier
+	 * the first one is kept in the index
+	 */
+	if( ( internal_physical_volume->name != NULL )
+	 && ( internal_physical_volume->name_size > 1 ) )
+	{
+		result = libvslvm_string_index_insert_value(
+		          internal_volume_group->physical_volumes_name_index,
+		          internal_physical_volume->name,
+		          internal_physical_volume->name_size - 1,
+		          (intptr_t *) physical_volume,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert physical volume into name index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_physical_volume->identifier[ 0 ] != 0 )
+	{
+		if( libvslvm_string_index_insert_value(
+		     internal_volume_group->physical_volumes_identifier_index,
+		     internal_physical_volume->identifier,
+		     narrow_string_length(
+		      internal_physical_volume->identifier ),
+		     (intptr_t *) physical_volume,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert physical volume into identifier index.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	return( 1 );
+
+on_error:
+	/* Remove the physical volume from the name index and the array
+	 * since it is freed by the caller on error
+	 */
+	if( result == 1 )
+	{
+		libvslvm_string_index_remove_value(
+		 internal_volume_group->physical_volumes_name_index,
+		 internal_physical_volume->name,
+		 internal_physical_volume->name_size - 1,
+		 (intptr_t *) physical_volume,
+		 NULL );
+	}
+	libcdata_array_set_entry_by_index(
+	 internal_volume_group->physical_volumes_array,
+	 entry_index,
+	 NULL,
+	 NULL );
+
+	libcdata_array_resize(
+	 internal_volume_group->physical_volumes_array,
+	 entry_index,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libvslvm_internal_physical_volume_free,
+	 NULL );
+
+	return( -1 );
 }
 
 /* Retrieves the number of logical volumes
@@ -1168,17 +1406,20 @@ int libvslvm_volume_group_get_logical_volume(
 	return( 1 );
 }
 
-/* Appends a logical volume
- * Returns 1 if successful or -1 on error
+/* Retrieves the logical volume for an ASCII encoded volume name
+ * Returns 1 if successful, 0 if no such logical volume or -1 on error
  */
-int libvslvm_volume_group_append_logical_volume(
+int libvslvm_volume_group_get_logical_volume_by_name(
      libvslvm_volume_group_t *volume_group,
-     libvslvm_logical_volume_values_t *logical_volume_values,
+     const char *volume_name,
+     size_t volume_name_length,
+     libvslvm_logical_volume_t **logical_volume,
      libcerror_error_t **error )
 {
 	libvslvm_internal_volume_group_t *internal_volume_group = NULL;
-	static char *function                                   = "libvslvm_volume_group_append_logical_volume";
-	int entry_index                                         = 0;
+	libvslvm_logical_volume_values_t *logical_volume_values = NULL;
+	static char *function                                   = "libvslvm_volume_group_get_logical_volume_by_name";
+	int result                                              = 0;
 
 	if( volume_group == NULL )
 	{
@@ -1193,28 +1434,63 @@ int libvslvm_volume_group_append_logical_volume(
 	}
 	internal_volume_group = (libvslvm_internal_volume_group_t *) volume_group;
 
-	if( logical_volume_values == NULL )
+	if( logical_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid logical volume values.",
+		 "%s: invalid logical volume.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_append_entry(
-	     internal_volume_group->logical_volumes_array,
-	     &entry_index,
-	     (intptr_t *) logical_volume_values,
+	if( *logical_volume != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid logical volume value already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = libvslvm_string_index_get_value_by_key(
+	          internal_volume_group->logical_volumes_name_index,
+	          volume_name,
+	          volume_name_length,
+	          (intptr_t **) &logical_volume_values,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume values from name index.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libvslvm_logical_volume_initialize(
+	     logical_volume,
+	     internal_volume_group->io_handle,
+	     volume_group,
+	     internal_volume_group->physical_volume_file_io_pool,
+	     logical_volume_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append logical volume to array.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create logical volume.",
 		 function );
 
 		return( -1 );
@@ -1222,3 +1498,1386 @@ int libvslvm_volume_group_append_logical_volume(
 	return( 1 );
 }
 
+/* Retrieves the logical volume for an ASCII encoded volume identifier
+ * Returns 1 if successful, 0 if no such logical volume or -1 on error
+ */
+int libvslvm_volume_group_get_logical_volume_by_identifier(
+     libvslvm_volume_group_t *volume_group,
+     const char *volume_identifier,
+     size_t volume_identifier_length,
+     libvslvm_logical_volume_t **logical_volume,
+     libcerror_error_t **error )
+{
+	libvslvm_internal_volume_group_t *internal_volume_group = NULL;
+	libvslvm_logical_volume_values_t *logical_volume_values = NULL;
+	static char *function                                   = "libvslvm_volume_group_get_logical_volume_by_identifier";
+	int result                                              = 0;
+
+	if( volume_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume group.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_group = (libvslvm_internal_volume_group_t *) volume_group;
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( *logical_volume != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid logical volume value already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = libvslvm_string_index_get_value_by_key(
+	          internal_volume_group->logical_volumes_identifier_index,
+	          volume_identifier,
+	          volume_identifier_length,
+	          (intptr_t **) &logical_volume_values,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume values from identifier index.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libvslvm_logical_volume_initialize(
+	     logical_volume,
+	     internal_volume_group->io_handle,
+	     volume_group,
+	     internal_volume_group->physical_volume_file_io_pool,
+	     logical_volume_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the values of a specific logical volume
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_internal_volume_group_get_logical_volume_values_by_index(
+     libvslvm_internal_volume_group_t *internal_volume_group,
+     int volume_index,
+     libvslvm_logical_volume_values_t **logical_volume_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libvslvm_internal_volume_group_get_logical_volume_values_by_index";
+
+	if( internal_volume_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume group.",
+		 function );
+
+		return( -1 );
+	}
+	if( logical_volume_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_volume_group->logical_volumes_array,
+	     volume_index,
+	     (intptr_t **) logical_volume_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume: %d values.",
+		 function,
+		 volume_index );
+
+		return( -1 );
+	}
+	if( *logical_volume_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing logical volume: %d values.",
+		 function,
+		 volume_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the ASCII formatted name of a specific logical volume
+ * The logical volume itself is not created
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_volume_group_get_logical_volume_name_size_by_index(
+     libvslvm_volume_group_t *volume_group,
+     int volume_index,
+     size_t *name_size,
+     libcerror_error_t **error )
+{
+	libvslvm_internal_volume_group_t *internal_volume_group = NULL;
+	libvslvm_logical_volume_values_t *logical_volume_values = NULL;
+	static char *function                                   = "libvslvm_volume_group_get_logical_volume_name_size_by_index";
+
+	if( volume_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume group.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_group = (libvslvm_internal_volume_group_t *) volume_group;
+
+	if( libvslvm_internal_volume_group_get_logical_volume_values_by_index(
+	     internal_volume_group,
+	     volume_index,
+	     &logical_volume_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume: %d values.",
+		 function,
+		 volume_index );
+
+		return( -1 );
+	}
+	if( libvslvm_logical_volume_values_get_name_size(
+	     logical_volume_values,
+	     name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the ASCII formatted name of a specific logical volume
+ * The logical volume itself is not created
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_volume_group_get_logical_volume_name_by_index(
+     libvslvm_volume_group_t *volume_group,
+     int volume_index,
+     char *name,
+     size_t name_size,
+     libcerror_error_t **error )
+{
+	libvslvm_internal_volume_group_t *internal_volume_group = NULL;
+	libvslvm_logical_volume_values_t *logical_volume_values = NULL;
+	static char *function                                   = "libvslvm_volume_group_get_logical_volume_name_by_index";
+
+	if( volume_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume group.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_group = (libvslvm_internal_volume_group_t *) volume_group;
+
+	if( libvslvm_internal_volume_group_get_logical_volume_values_by_index(
+	     internal_volume_group,
+	     volume_index,
+	     &logical_volume_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume: %d values.",
+		 function,
+		 volume_index );
+
+		return( -1 );
+	}
+	if( libvslvm_logical_volume_values_get_name(
+	     logical_volume_values,
+	     name,
+	     name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the ASCII formatted identifier of a specific logical volume
+ * The logical volume itself is not created
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_volume_group_get_logical_volume_identifier_size_by_index(
+     libvslvm_volume_group_t *volume_group,
+     int volume_index,
+     size_t *identifier_size,
+     libcerror_error_t **error )
+{
+	libvslvm_internal_volume_group_t *internal_volume_group = NULL;
+	libvslvm_logical_volume_values_t *logical_volume_values = NULL;
+	static char *function                                   = "libvslvm_volume_group_get_logical_volume_identifier_size_by_index";
+
+	if( volume_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume group.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_group = (libvslvm_internal_volume_group_t *) volume_group;
+
+	if( libvslvm_internal_volume_group_get_logical_volume_values_by_index(
+	     internal_volume_group,
+	     volume_index,
+	     &logical_volume_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume: %d values.",
+		 function,
+		 volume_index );
+
+		return( -1 );
+	}
+	if( libvslvm_logical_volume_values_get_identifier_size(
+	     logical_volume_values,
+	     identifier_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the ASCII formatted identifier of a specific logical volume
+ * The logical volume itself is not created
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_volume_group_get_logical_volume_identifier_by_index(
+     libvslvm_volume_group_t *volume_group,
+     int volume_index,
+     char *identifier,
+     size_t identifier_size,
+     libcerror_error_t **error )
+{
+	libvslvm_internal_volume_group_t *internal_volume_group = NULL;
+	libvslvm_logical_volume_values_t *logical_volume_values = NULL;
+	static char *function                                   = "libvslvm_volume_group_get_logical_volume_identifier_by_index";
+
+	if( volume_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume group.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_group = (libvslvm_internal_volume_group_t *) volume_group;
+
+	if( libvslvm_internal_volume_group_get_logical_volume_values_by_index(
+	     internal_volume_group,
+	     volume_index,
+	     &logical_volume_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume: %d values.",
+		 function,
+		 volume_index );
+
+		return( -1 );
+	}
+	if( libvslvm_logical_volume_values_get_identifier(
+	     logical_volume_values,
+	     identifier,
+	     identifier_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of segments of a specific logical volume
+ * The logical volume itself is not created
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_volume_group_get_logical_volume_number_of_segments_by_index(
+     libvslvm_volume_group_t *volume_group,
+     int volume_index,
+     int *number_of_segments,
+     libcerror_error_t **error )
+{
+	libvslvm_internal_volume_group_t *internal_volume_group = NULL;
+	libvslvm_logical_volume_values_t *logical_volume_values = NULL;
+	static char *function                                   = "libvslvm_volume_group_get_logical_volume_number_of_segments_by_index";
+
+	if( volume_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume group.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_group = (libvslvm_internal_volume_group_t *) volume_group;
+
+	if( libvslvm_internal_volume_group_get_logical_volume_values_by_index(
+	     internal_volume_group,
+	     volume_index,
+	     &logical_volume_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume: %d values.",
+		 function,
+		 volume_index );
+
+		return( -1 );
+	}
+	if( libvslvm_logical_volume_values_get_number_of_segments(
+	     logical_volume_values,
+	     number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of segments.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific segment of a specific logical volume
+ * The logical volume itself is not created
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_volume_group_get_logical_volume_segment_by_index(
+     libvslvm_volume_group_t *volume_group,
+     int volume_index,
+     int segment_index,
+     libvslvm_segment_t **segment,
+     libcerror_error_t **error )
+{
+	libvslvm_internal_volume_group_t *internal_volume_group = NULL;
+	libvslvm_logical_volume_values_t *logical_volume_values = NULL;
+	static char *function                                   = "libvslvm_volume_group_get_logical_volume_segment_by_index";
+
+	if( volume_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume group.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_group = (libvslvm_internal_volume_group_t *) volume_group;
+
+	if( libvslvm_internal_volume_group_get_logical_volume_values_by_index(
+	     internal_volume_group,
+	     volume_index,
+	     &logical_volume_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume: %d values.",
+		 function,
+		 volume_index );
+
+		return( -1 );
+	}
+	if( libvslvm_logical_volume_values_get_segment(
+	     logical_volume_values,
+	     segment_index,
+	     segment,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment: %d.",
+		 function,
+		 segment_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the unallocated volume of a specific physical volume
+ * The unallocated volume contains the unallocated extent runs of the physical volume
+ * stored consecutively and can be read as a logical volume
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_volume_group_get_unallocated_volume(
+     libvslvm_volume_group_t *volume_group,
+     int physical_volume_index,
+     libvslvm_logical_volume_t **logical_volume,
+     libcerror_error_t **error )
+{
+	libvslvm_internal_physical_volume_t *internal_physical_volume = NULL;
+	libvslvm_internal_volume_group_t *internal_volume_group       = NULL;
+	static char *function                                         = "libvslvm_volume_group_get_unallocated_volume";
+
+	if( volume_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume group.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_group = (libvslvm_internal_volume_group_t *) volume_group;
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( *logical_volume != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid logical volume value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_volume_group->physical_volumes_array,
+	     physical_volume_index,
+	     (intptr_t **) &internal_physical_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve physical volume: %d.",
+		 function,
+		 physical_volume_index );
+
+		return( -1 );
+	}
+	if( internal_physical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing physical volume: %d.",
+		 function,
+		 physical_volume_index );
+
+		return( -1 );
+	}
+	if( internal_physical_volume->unallocated_volume_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid physical volume: %d - missing unallocated volume values.",
+		 function,
+		 physical_volume_index );
+
+		return( -1 );
+	}
+	if( libvslvm_logical_volume_initialize(
+	     logical_volume,
+	     internal_volume_group->io_handle,
+	     volume_group,
+	     internal_volume_group->physical_volume_file_io_pool,
+	     internal_physical_volume->unallocated_volume_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create unallocated volume.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the data area volume of a specific physical volume
+ * The data area volume contains the whole extents of the data areas of the physical volume
+ * stored consecutively and can be read as a logical volume
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_volume_group_get_data_area_volume(
+     libvslvm_volume_group_t *volume_group,
+     int physical_volume_index,
+     libvslvm_logical_volume_t **logical_volume,
+     libcerror_error_t **error )
+{
+	libvslvm_internal_physical_volume_t *internal_physical_volume = NULL;
+	libvslvm_internal_volume_group_t *internal_volume_group       = NULL;
+	static char *function                                         = "libvslvm_volume_group_get_data_area_volume";
+
+	if( volume_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume group.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_group = (libvslvm_internal_volume_group_t *) volume_group;
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( *logical_volume != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid logical volume value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_volume_group->physical_volumes_array,
+	     physical_volume_index,
+	     (intptr_t **) &internal_physical_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve physical volume: %d.",
+		 function,
+		 physical_volume_index );
+
+		return( -1 );
+	}
+	if( internal_physical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing physical volume: %d.",
+		 function,
+		 physical_volume_index );
+
+		return( -1 );
+	}
+	if( internal_physical_volume->data_area_volume_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid physical volume: %d - missing data area volume values.",
+		 function,
+		 physical_volume_index );
+
+		return( -1 );
+	}
+	if( libvslvm_logical_volume_initialize(
+	     logical_volume,
+	     internal_volume_group->io_handle,
+	     volume_group,
+	     internal_volume_group->physical_volume_file_io_pool,
+	     internal_physical_volume->data_area_volume_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data area volume.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the data of the logical volumes stored on a specific physical volume in one sequential sweep
+ * The physical volume data is read from the file IO handle if set, otherwise from the file IO pool
+ * Returns 1 if successful, 0 if the sweep was stopped or -1 on error
+ */
+int libvslvm_internal_volume_group_sweep_physical_volume(
+     libvslvm_internal_volume_group_t *internal_volume_group,
+     int physical_volume_index,
+     libbfio_pool_t *file_io_pool,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *buffer,
+     size_t buffer_size,
+     int (*write_callback)(
+            intptr_t *callback_data,
+            int logical_volume_index,
+            off64_t logical_volume_offset,
+            const uint8_t *buffer,
+            size_t buffer_size,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error )
+{
+	libvslvm_extent_run_t *allocation                             = NULL;
+	libvslvm_internal_physical_volume_t *internal_physical_volume = NULL;
+	static char *function                                         = "libvslvm_internal_volume_group_sweep_physical_volume";
+	size64_t allocation_offset                                    = 0;
+	size_t read_size                                              = 0;
+	ssize_t read_count                                            = 0;
+	int allocation_index                                          = 0;
+	int number_of_allocations                                     = 0;
+	int result                                                    = 1;
+
+	if( internal_volume_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume group.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_io_pool == NULL )
+	 && ( file_io_handle == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool and file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write callback.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_volume_group->physical_volumes_array,
+	     physical_volume_index,
+	     (intptr_t **) &internal_physical_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve physical volume: %d.",
+		 function,
+		 physical_volume_index );
+
+		return( -1 );
+	}
+	if( internal_physical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing physical volume: %d.",
+		 function,
+		 physical_volume_index );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_physical_volume->allocations_array,
+	     &number_of_allocations,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of physical volume: %d allocations.",
+		 function,
+		 physical_volume_index );
+
+		return( -1 );
+	}
+	/* The allocations are sorted by physical volume offset
+	 */
+	for( allocation_index = 0;
+	     ( result == 1 ) && ( allocation_index < number_of_allocations );
+	     allocation_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_physical_volume->allocations_array,
+		     allocation_index,
+		     (intptr_t **) &allocation,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve physical volume: %d allocation: %d.",
+			 function,
+			 physical_volume_index,
+			 allocation_index );
+
+			return( -1 );
+		}
+		if( allocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing physical volume: %d allocation: %d.",
+			 function,
+			 physical_volume_index,
+			 allocation_index );
+
+			return( -1 );
+		}
+		if( allocation->type != LIBVSLVM_EXTENT_RUN_TYPE_LINEAR )
+		{
+			continue;
+		}
+		allocation_offset = 0;
+
+		while( allocation_offset < allocation->size )
+		{
+			if( ( internal_volume_group->io_handle != NULL )
+			 && ( internal_volume_group->io_handle->abort != 0 ) )
+			{
+				result = 0;
+
+				break;
+			}
+			read_size = buffer_size;
+
+			if( (size64_t) read_size > ( allocation->size - allocation_offset ) )
+			{
+				read_size = (size_t) ( allocation->size - allocation_offset );
+			}
+			if( file_io_handle != NULL )
+			{
+				read_count = libbfio_handle_read_buffer_at_offset(
+				              file_io_handle,
+				              buffer,
+				              read_size,
+				              allocation->physical_offset + (off64_t) allocation_offset,
+				              error );
+			}
+			else
+			{
+				read_count = libbfio_pool_read_buffer_at_offset(
+				              file_io_pool,
+				              internal_physical_volume->volume_index,
+				              buffer,
+				              read_size,
+				              allocation->physical_offset + (off64_t) allocation_offset,
+				              error );
+			}
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read physical volume: %d data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 physical_volume_index,
+				 allocation->physical_offset + (off64_t) allocation_offset,
+				 allocation->physical_offset + (off64_t) allocation_offset );
+
+				return( -1 );
+			}
+			result = write_callback(
+			          callback_data,
+			          allocation->logical_volume_index,
+			          allocation->logical_offset + (off64_t) allocation_offset,
+			          buffer,
+			          read_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write logical volume: %d data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 allocation->logical_volume_index,
+				 allocation->logical_offset + (off64_t) allocation_offset,
+				 allocation->logical_offset + (off64_t) allocation_offset );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			allocation_offset += read_size;
+		}
+	}
+	return( result );
+}
+
+/* Reads the data of the logical volumes in one sequential sweep per physical volume
+ * The allocations of each physical volume are read in order of their physical volume offset
+ * and every block of data is passed to the write callback together with the index and offset
+ * of the logical volume it belongs to. At most buffer size bytes of data are buffered at a time
+ * Only linear allocations are read, the data of striped allocations is not stored contiguously
+ * in the logical volume and is not passed to the write callback
+ * This function is not multi-thread safe
+ * Returns 1 if successful, 0 if the sweep was stopped or -1 on error
+ */
+int libvslvm_volume_group_sweep_logical_volumes(
+     libvslvm_volume_group_t *volume_group,
+     size_t buffer_size,
+     int (*write_callback)(
+            intptr_t *callback_data,
+            int logical_volume_index,
+            off64_t logical_volume_offset,
+            const uint8_t *buffer,
+            size_t buffer_size,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error )
+{
+	libvslvm_internal_volume_group_t *internal_volume_group = NULL;
+	uint8_t *buffer                                         = NULL;
+	static char *function                                   = "libvslvm_volume_group_sweep_logical_volumes";
+	int number_of_physical_volumes                          = 0;
+	int physical_volume_index                               = 0;
+	int result                                              = 1;
+
+	if( volume_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume group.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_group = (libvslvm_internal_volume_group_t *) volume_group;
+
+	if( internal_volume_group->physical_volume_file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume group - missing physical volume file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write callback.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_volume_group->physical_volumes_array,
+	     &number_of_physical_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of physical volumes from array.",
+		 function );
+
+		goto on_error;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * buffer_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	for( physical_volume_index = 0;
+	     ( result == 1 ) && ( physical_volume_index < number_of_physical_volumes );
+	     physical_volume_index++ )
+	{
+		result = libvslvm_internal_volume_group_sweep_physical_volume(
+		          internal_volume_group,
+		          physical_volume_index,
+		          internal_volume_group->physical_volume_file_io_pool,
+		          NULL,
+		          buffer,
+		          buffer_size,
+		          write_callback,
+		          callback_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to sweep physical volume: %d.",
+			 function,
+			 physical_volume_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 buffer );
+
+	return( result );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
+/* Reads the data of the logical volumes stored on a specific physical volume in one sequential sweep
+ * The physical volume data is read from the file IO handle instead of the physical volume file IO pool
+ * so that different physical volumes can be swept concurrently, each with its own file IO handle
+ * The write callback is called from the thread that calls this function
+ * Returns 1 if successful, 0 if the sweep was stopped or -1 on error
+ */
+int libvslvm_volume_group_sweep_physical_volume_file_io_handle(
+     libvslvm_volume_group_t *volume_group,
+     int physical_volume_index,
+     libbfio_handle_t *file_io_handle,
+     size_t buffer_size,
+     int (*write_callback)(
+            intptr_t *callback_data,
+            int logical_volume_index,
+            off64_t logical_volume_offset,
+            const uint8_t *buffer,
+            size_t buffer_size,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error )
+{
+	libvslvm_internal_volume_group_t *internal_volume_group = NULL;
+	uint8_t *buffer                                         = NULL;
+	static char *function                                   = "libvslvm_volume_group_sweep_physical_volume_file_io_handle";
+	int result                                              = 0;
+
+	if( volume_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume group.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_group = (libvslvm_internal_volume_group_t *) volume_group;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write callback.",
+		 function );
+
+		return( -1 );
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * buffer_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		return( -1 );
+	}
+	result = libvslvm_internal_volume_group_sweep_physical_volume(
+	          internal_volume_group,
+	          physical_volume_index,
+	          NULL,
+	          file_io_handle,
+	          buffer,
+	          buffer_size,
+	          write_callback,
+	          callback_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to sweep physical volume: %d.",
+		 function,
+		 physical_volume_index );
+	}
+	memory_free(
+	 buffer );
+
+	return( result );
+}
+
+/* Appends a logical volume
+ * Returns 1 if successful or -1 on error
+ */
+int libvslvm_volume_group_append_logical_volume(
+     libvslvm_volume_group_t *volume_group,
+     libvslvm_logical_volume_values_t *logical_volume_values,
+     libcerror_error_t **error )
+{
+	libvslvm_internal_volume_group_t *internal_volume_group = NULL;
+	static char *function                                   = "libvslvm_volume_group_append_logical_volume";
+	int entry_index                                         = 0;
+	int result                                              = 0;
+
+	if( volume_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume group.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_group = (libvslvm_internal_volume_group_t *) volume_group;
+
+	if( logical_volume_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_append_entry(
+	     internal_volume_group->logical_volumes_array,
+	     &entry_index,
+	     (intptr_t *) logical_volume_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append logical volume to array.",
+		 function );
+
+		return( -1 );
+	}
+	/* If multiple logical volumes share the same name or identifier
+	 * the first one is kept in the index
+	 */
+	if( ( logical_volume_values->name != NULL )
+	 && ( logical_volume_values->name_size > 1 ) )
+	{
+		result = libvslvm_string_index_insert_value(
+		          internal_volume_group->logical_volumes_name_index,
+		          logical_volume_values->name,
+		          logical_volume_values->name_size - 1,
+		          (intptr_t *) logical_volume_values,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert logical volume into name index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( logical_volume_values->identifier[ 0 ] != 0 )
+	{
+		if( libvslvm_string_index_insert_value(
+		     internal_volume_group->logical_volumes_identifier_index,
+		     logical_volume_values->identifier,
+		     narrow_string_length(
+		      logical_volume_values->identifier ),
+		     (intptr_t *) logical_volume_values,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert logical volume into identifier index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	/* Remove the logical volume values from the name index and the array
+	 * since they are freed by the caller on error
+	 */
+	if( result == 1 )
+	{
+		libvslvm_string_index_remove_value(
+		 internal_volume_group->logical_volumes_name_index,
+		 logical_volume_values->name,
+		 logical_volume_values->name_size - 1,
+		 (intptr_t *) logical_volume_values,
+		 NULL );
+	}
+	libcdata_array_set_entry_by_index(
+	 internal_volume_group->logical_volumes_array,
+	 entry_index,
+	 NULL,
+	 NULL );
+
+	libcdata_array_resize(
+	 internal_volume_group->logical_volumes_array,
+	 entry_index,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libvslvm_logical_volume_values_free,
+	 NULL );
+
+	return( -1 );
+}
+
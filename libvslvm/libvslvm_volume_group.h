@@ -32,6 +32,7 @@
 #include "libvslvm_libcerror.h"
 #include "libvslvm_logical_volume_values.h"
 #include "libvslvm_physical_volume.h"
+#include "libvslvm_string_index.h"
 #include "libvslvm_types.h"
 
 #if defined( __cplusplus )
@@ -86,9 +87,25 @@ struct libvslvm_internal_volume_group
 	 */
 	libcdata_array_t *physical_volumes_array;
 
+	/* The physical volumes name index
+	 */
+	libvslvm_string_index_t *physical_volumes_name_index;
+
+	/* The physical volumes identifier index
+	 */
+	libvslvm_string_index_t *physical_volumes_identifier_index;
+
 	/* The logical volumes array
 	 */
 	libcdata_array_t *logical_volumes_array;
+
+	/* The logical volumes name index
+	 */
+	libvslvm_string_index_t *logical_volumes_name_index;
+
+	/* The logical volumes identifier index
+	 */
+	libvslvm_string_index_t *logical_volumes_identifier_index;
 };
 
 int libvslvm_volume_group_initialize(
@@ -181,6 +198,14 @@ int libvslvm_volume_group_get_physical_volume_by_name(
      libvslvm_physical_volume_t **physical_volume,
      libcerror_error_t **error );
 
+LIBVSLVM_EXTERN \
+int libvslvm_volume_group_get_physical_volume_by_identifier(
+     libvslvm_volume_group_t *volume_group,
+     const char *volume_identifier,
+     size_t volume_identifier_length,
+     libvslvm_physical_volume_t **physical_volume,
+     libcerror_error_t **error );
+
 int libvslvm_volume_group_append_physical_volume(
      libvslvm_volume_group_t *volume_group,
      libvslvm_physical_volume_t *physical_volume,
@@ -199,6 +224,134 @@ int libvslvm_volume_group_get_logical_volume(
      libvslvm_logical_volume_t **logical_volume,
      libcerror_error_t **error );
 
+LIBVSLVM_EXTERN \
+int libvslvm_volume_group_get_logical_volume_by_name(
+     libvslvm_volume_group_t *volume_group,
+     const char *volume_name,
+     size_t volume_name_length,
+     libvslvm_logical_volume_t **logical_volume,
+     libcerror_error_t **error );
+
+LIBVSLVM_EXTERN \
+int libvslvm_volume_group_get_logical_volume_by_identifier(
+     libvslvm_volume_group_t *volume_group,
+     const char *volume_identifier,
+     size_t volume_identifier_length,
+     libvslvm_logical_volume_t **logical_volume,
+     libcerror_error_t **error );
+
+int libvslvm_internal_volume_group_get_logical_volume_values_by_index(
+     libvslvm_internal_volume_group_t *internal_volume_group,
+     int volume_index,
+     libvslvm_logical_volume_values_t **logical_volume_values,
+     libcerror_error_t **error );
+
+LIBVSLVM_EXTERN \
+int libvslvm_volume_group_get_logical_volume_name_size_by_index(
+     libvslvm_volume_group_t *volume_group,
+     int volume_index,
+     size_t *name_size,
+     libcerror_error_t **error );
+
+LIBVSLVM_EXTERN \
+int libvslvm_volume_group_get_logical_volume_name_by_index(
+     libvslvm_volume_group_t *volume_group,
+     int volume_index,
+     char *name,
+     size_t name_size,
+     libcerror_error_t **error );
+
+LIBVSLVM_EXTERN \
+int libvslvm_volume_group_get_logical_volume_identifier_size_by_index(
+     libvslvm_volume_group_t *volume_group,
+     int volume_index,
+     size_t *identifier_size,
+     libcerror_error_t **error );
+
+LIBVSLVM_EXTERN \
+int libvslvm_volume_group_get_logical_volume_identifier_by_index(
+     libvslvm_volume_group_t *volume_group,
+     int volume_index,
+     char *identifier,
+     size_t identifier_size,
+     libcerror_error_t **error );
+
+LIBVSLVM_EXTERN \
+int libvslvm_volume_group_get_logical_volume_number_of_segments_by_index(
+     libvslvm_volume_group_t *volume_group,
+     int volume_index,
+     int *number_of_segments,
+     libcerror_error_t **error );
+
+LIBVSLVM_EXTERN \
+int libvslvm_volume_group_get_logical_volume_segment_by_index(
+     libvslvm_volume_group_t *volume_group,
+     int volume_index,
+     int segment_index,
+     libvslvm_segment_t **segment,
+     libcerror_error_t **error );
+
+LIBVSLVM_EXTERN \
+int libvslvm_volume_group_get_unallocated_volume(
+     libvslvm_volume_group_t *volume_group,
+     int physical_volume_index,
+     libvslvm_logical_volume_t **logical_volume,
+     libcerror_error_t **error );
+
+LIBVSLVM_EXTERN \
+int libvslvm_volume_group_get_data_area_volume(
+     libvslvm_volume_group_t *volume_group,
+     int physical_volume_index,
+     libvslvm_logical_volume_t **logical_volume,
+     libcerror_error_t **error );
+
+int libvslvm_internal_volume_group_sweep_physical_volume(
+     libvslvm_internal_volume_group_t *internal_volume_group,
+     int physical_volume_index,
+     libbfio_pool_t *file_io_pool,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *buffer,
+     size_t buffer_size,
+     int (*write_callback)(
+            intptr_t *callback_data,
+            int logical_volume_index,
+            off64_t logical_volume_offset,
+            const uint8_t *buffer,
+            size_t buffer_size,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
+LIBVSLVM_EXTERN \
+int libvslvm_volume_group_sweep_logical_volumes(
+     libvslvm_volume_group_t *volume_group,
+     size_t buffer_size,
+     int (*write_callback)(
+            intptr_t *callback_data,
+            int logical_volume_index,
+            off64_t logical_volume_offset,
+            const uint8_t *buffer,
+            size_t buffer_size,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
+LIBVSLVM_EXTERN \
+int libvslvm_volume_group_sweep_physical_volume_file_io_handle(
+     libvslvm_volume_group_t *volume_group,
+     int physical_volume_index,
+     libbfio_handle_t *file_io_handle,
+     size_t buffer_size,
+     int (*write_callback)(
+            intptr_t *callback_data,
+            int logical_volume_index,
+            off64_t logical_volume_offset,
+            const uint8_t *buffer,
+            size_t buffer_size,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
 int libvslvm_volume_group_append_logical_volume(
      libvslvm_volume_group_t *volume_group,
      libvslvm_logical_volume_values_t *logical_volume_values,
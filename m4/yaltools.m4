@@ -93,6 +93,14 @@ AC_DEFUN([AX_VSLVMTOOLS_CHECK_LOCAL],
     [AC_CHECK_FUNCS([clock_gettime getegid geteuid time])
   ])
 
+  dnl Headers and functions included in vslvmtools/export_handle.c and vslvmtools/mount_handle.c
+  AS_IF(
+    [test "x$ac_cv_enable_winapi" = xno],
+    [AC_CHECK_HEADERS([fcntl.h linux/fs.h sys/ioctl.h])
+
+    AC_CHECK_FUNCS([copy_file_range ftruncate open pwrite])
+  ])
+
   AX_TOOLS_CHECK_ENABLE_MINGW_BINMODE
 ])
 
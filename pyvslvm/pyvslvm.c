@@ -39,6 +39,7 @@
 #include "pyvslvm_physical_volume.h"
 #include "pyvslvm_physical_volumes.h"
 #include "pyvslvm_python.h"
+#include "pyvslvm_read_requests.h"
 #include "pyvslvm_segment.h"
 #include "pyvslvm_segments.h"
 #include "pyvslvm_stripe.h"
@@ -93,6 +94,20 @@ PyMethodDef pyvslvm_module_methods[] = {
 	  "\n"
 	  "Opens a handle using a file-like object." },
 
+	{ "read_buffers_at_offsets",
+	  (PyCFunction) pyvslvm_read_buffers_at_offsets,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_buffers_at_offsets(read_requests, number_of_threads=4) -> List\n"
+	  "\n"
+	  "Reads the data of multiple read requests using a pool of native threads\n"
+	  "with the GIL released. Every read request is a tuple of a logical volume,\n"
+	  "an offset and either a size or a writable buffer object, such as a\n"
+	  "bytearray or memoryview. Retrieves a list with the data read for a size\n"
+	  "or the number of bytes read into a buffer object per read request.\n"
+	  "Read requests of the same logical volume are read one at a time. Different\n"
+	  "logical volumes are read concurrently if the physical volume files were\n"
+	  "opened by name, with file objects they share the file objects." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
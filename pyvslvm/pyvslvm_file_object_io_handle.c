@@ -23,11 +23,32 @@
 #include <memory.h>
 #include <types.h>
 
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_SYS_IOCTL_H )
+#include <sys/ioctl.h>
+#endif
+
+#if defined( HAVE_LINUX_FS_H )
+#include <linux/fs.h>
+#endif
+
 #include "pyvslvm_error.h"
 #include "pyvslvm_file_object_io_handle.h"
 #include "pyvslvm_integer.h"
 #include "pyvslvm_libbfio.h"
 #include "pyvslvm_libcerror.h"
+#include "pyvslvm_libcthreads.h"
 #include "pyvslvm_python.h"
 
 /* Creates a file object IO handle
@@ -104,6 +125,24 @@ int pyvslvm_file_object_io_handle_initialize(
 	}
 	( *file_object_io_handle )->file_object = file_object;
 
+#if defined( HAVE_PYVSLVM_FILE_OBJECT_FILE_DESCRIPTOR )
+	( *file_object_io_handle )->file_descriptor = -1;
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *file_object_io_handle )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	Py_IncRef(
 	 ( *file_object_io_handle )->file_object );
 
@@ -213,6 +252,7 @@ int pyvslvm_file_object_io_handle_free(
 {
 	static char *function      = "pyvslvm_file_object_io_handle_free";
 	PyGILState_STATE gil_state = 0;
+	int result                 = 1;
 
 	if( file_object_io_handle == NULL )
 	{
@@ -227,6 +267,28 @@ int pyvslvm_file_object_io_handle_free(
 	}
 	if( *file_object_io_handle != NULL )
 	{
+#if defined( HAVE_PYVSLVM_FILE_OBJECT_FILE_DESCRIPTOR )
+		if( ( *file_object_io_handle )->file_descriptor != -1 )
+		{
+			close(
+			 ( *file_object_io_handle )->file_descriptor );
+		}
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *file_object_io_handle )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		gil_state = PyGILState_Ensure();
 
 		Py_DecRef(
@@ -240,7 +302,7 @@ int pyvslvm_file_object_io_handle_free(
 		PyGILState_Release(
 		 gil_state );
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Clones (duplicates) the file object IO handle and its attributes
@@ -317,7 +379,12 @@ int pyvslvm_file_object_io_handle_open(
      int access_flags,
      libcerror_error_t **error )
 {
-	static char *function = "pyvslvm_file_object_io_handle_open";
+	static char *function      = "pyvslvm_file_object_io_handle_open";
+
+#if defined( HAVE_PYVSLVM_FILE_OBJECT_FILE_DESCRIPTOR )
+	PyGILState_STATE gil_state = 0;
+	int result                 = 0;
+#endif
 
 	if( file_object_io_handle == NULL )
 	{
@@ -364,13 +431,220 @@ int pyvslvm_file_object_io_handle_open(
 
 		return( -1 );
 	}
-	/* No need to do anything here, because the file object is already open
+	/* No need to open the file object, because it is already open
+	 */
+#if defined( HAVE_PYVSLVM_FILE_OBJECT_FILE_DESCRIPTOR )
+	if( file_object_io_handle->file_descriptor == -1 )
+	{
+		gil_state = PyGILState_Ensure();
+
+		result = pyvslvm_file_object_io_handle_open_file_descriptor(
+		          file_object_io_handle,
+		          error );
+
+		PyGILState_Release(
+		 gil_state );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file descriptor of file object.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	file_object_io_handle->access_flags   = access_flags;
+	file_object_io_handle->current_offset = 0;
+
+	return( 1 );
+}
+
+#if defined( HAVE_PYVSLVM_FILE_OBJECT_FILE_DESCRIPTOR )
+
+/* Retrieves the file descriptor of the file object
+ * Make sure to hold the GIL state before calling this function
+ * Returns 1 if successful, 0 if the file object has no file descriptor or -1 on error
+ */
+int pyvslvm_file_object_get_file_descriptor(
+     PyObject *file_object,
+     int *file_descriptor,
+     libcerror_error_t **error )
+{
+	PyObject *method_name = NULL;
+	static char *function = "pyvslvm_file_object_get_file_descriptor";
+	int result            = 0;
+
+	if( file_object == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file object.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#if PY_MAJOR_VERSION >= 3
+	method_name = PyUnicode_FromString(
+	               "fileno" );
+#else
+	method_name = PyString_FromString(
+	               "fileno" );
+#endif
+	PyErr_Clear();
+
+	/* Determine if the file object has the fileno method
+	 */
+	result = PyObject_HasAttr(
+	          file_object,
+	          method_name );
+
+	Py_DecRef(
+	 method_name );
+
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+	/* File like objects, such as io.BytesIO, can raise an exception
+	 * to indicate they are not backed by a file descriptor
+	 */
+	*file_descriptor = PyObject_AsFileDescriptor(
+	                    file_object );
+
+	if( *file_descriptor == -1 )
+	{
+		PyErr_Clear();
+
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Opens the file descriptor of the file object IO handle
+ * The file descriptor is only used if it refers to a regular file or block device
+ * and is duplicated so that it remains valid independent of the file object
+ * Make sure to hold the GIL state before calling this function
+ * Returns 1 if successful, 0 if the file object cannot be read by file descriptor or -1 on error
+ */
+int pyvslvm_file_object_io_handle_open_file_descriptor(
+     pyvslvm_file_object_io_handle_t *file_object_io_handle,
+     libcerror_error_t **error )
+{
+	struct stat file_statistics;
+
+	static char *function = "pyvslvm_file_object_io_handle_open_file_descriptor";
+	size64_t size         = 0;
+	int file_descriptor   = -1;
+	int result            = 0;
+
+	if( file_object_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file object IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_object_io_handle->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file object IO handle - file descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = pyvslvm_file_object_get_file_descriptor(
+	          file_object_io_handle->file_object,
+	          &file_descriptor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file descriptor of file object.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		return( 0 );
+	}
+	if( S_ISREG( file_statistics.st_mode ) )
+	{
+		size = (size64_t) file_statistics.st_size;
+	}
+#if defined( HAVE_IOCTL ) && defined( BLKGETSIZE64 )
+	else if( S_ISBLK( file_statistics.st_mode ) )
+	{
+		if( ioctl(
+		     file_descriptor,
+		     BLKGETSIZE64,
+		     &size ) == -1 )
+		{
+			return( 0 );
+		}
+	}
+#endif
+	else
+	{
+		return( 0 );
+	}
+	/* The duplicate shares the file offset with the file object
+	 * therefore it is only accessed by pread. The duplicate is created
+	 * close-on-exec so that it does not leak into child processes
 	 */
-	file_object_io_handle->access_flags = access_flags;
+	file_descriptor = fcntl(
+	                   file_descriptor,
+	                   F_DUPFD_CLOEXEC,
+	                   0 );
+
+	if( file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	file_object_io_handle->file_descriptor = file_descriptor;
+	file_object_io_handle->current_offset  = 0;
+	file_object_io_handle->size            = size;
 
 	return( 1 );
 }
 
+#endif /* defined( HAVE_PYVSLVM_FILE_OBJECT_FILE_DESCRIPTOR ) */
+
 /* Closes the file object IO handle
  * Returns 0 if successful or -1 on error
  */
@@ -404,6 +678,26 @@ int pyvslvm_file_object_io_handle_close(
 	}
 	/* Do not close the file object, have Python deal with it
 	 */
+#if defined( HAVE_PYVSLVM_FILE_OBJECT_FILE_DESCRIPTOR )
+	if( file_object_io_handle->file_descriptor != -1 )
+	{
+		if( close(
+		     file_object_io_handle->file_descriptor ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file descriptor.",
+			 function );
+
+			file_object_io_handle->file_descriptor = -1;
+
+			return( -1 );
+		}
+		file_object_io_handle->file_descriptor = -1;
+	}
+#endif
 	file_object_io_handle->access_flags = 0;
 
 	return( 0 );
@@ -614,6 +908,9 @@ on_error:
 }
 
 /* Reads a buffer from the file object IO handle
+ * The file object is positioned at the current offset and read while holding
+ * the mutex and the GIL state, since other threads can access the file object
+ * in between separate Python method calls
  * Returns the number of bytes read if successful, or -1 on error
  */
 ssize_t pyvslvm_file_object_io_handle_read(
@@ -637,8 +934,91 @@ ssize_t pyvslvm_file_object_io_handle_read(
 
 		return( -1 );
 	}
+#if defined( HAVE_PYVSLVM_FILE_OBJECT_FILE_DESCRIPTOR )
+	if( file_object_io_handle->file_descriptor != -1 )
+	{
+		/* Read directly from the file descriptor without acquiring the GIL
+		 */
+		if( buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( size > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		read_count = pread(
+		              file_object_io_handle->file_descriptor,
+		              buffer,
+		              size,
+		              (off_t) file_object_io_handle->current_offset );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from file descriptor.",
+			 function );
+
+			return( -1 );
+		}
+		file_object_io_handle->current_offset += (off64_t) read_count;
+
+		return( read_count );
+	}
+#endif
+	/* Make sure to grab the mutex before acquiring the GIL state
+	 * otherwise a thread waiting for the mutex can hold the GIL state
+	 */
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     file_object_io_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	gil_state = PyGILState_Ensure();
 
+	if( pyvslvm_file_object_seek_offset(
+	     file_object_io_handle->file_object,
+	     file_object_io_handle->current_offset,
+	     SEEK_SET,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " in file object.",
+		 function,
+		 file_object_io_handle->current_offset );
+
+		goto on_error;
+	}
 	read_count = pyvslvm_file_object_read_buffer(
 	              file_object_io_handle->file_object,
 	              buffer,
@@ -656,15 +1036,37 @@ ssize_t pyvslvm_file_object_io_handle_read(
 
 		goto on_error;
 	}
+	file_object_io_handle->current_offset += (off64_t) read_count;
+
 	PyGILState_Release(
 	 gil_state );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     file_object_io_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	return( read_count );
 
 on_error:
 	PyGILState_Release(
 	 gil_state );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 file_object_io_handle->mutex,
+	 NULL );
+#endif
 	return( -1 );
 }
 
@@ -822,8 +1224,39 @@ ssize_t pyvslvm_file_object_io_handle_write(
 
 		return( -1 );
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     file_object_io_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	gil_state = PyGILState_Ensure();
 
+	if( pyvslvm_file_object_seek_offset(
+	     file_object_io_handle->file_object,
+	     file_object_io_handle->current_offset,
+	     SEEK_SET,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " in file object.",
+		 function,
+		 file_object_io_handle->current_offset );
+
+		goto on_error;
+	}
 	write_count = pyvslvm_file_object_write_buffer(
 	               file_object_io_handle->file_object,
 	               buffer,
@@ -841,15 +1274,37 @@ ssize_t pyvslvm_file_object_io_handle_write(
 
 		goto on_error;
 	}
+	file_object_io_handle->current_offset += (off64_t) write_count;
+
 	PyGILState_Release(
 	 gil_state );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     file_object_io_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	return( write_count );
 
 on_error:
 	PyGILState_Release(
 	 gil_state );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 file_object_io_handle->mutex,
+	 NULL );
+#endif
 	return( -1 );
 }
 
@@ -1130,6 +1585,7 @@ on_error:
 }
 
 /* Seeks a certain offset within the file object IO handle
+ * The file object itself is only positioned when it is read or written
  * Returns the offset if the seek is successful or -1 on error
  */
 off64_t pyvslvm_file_object_io_handle_seek_offset(
@@ -1138,8 +1594,8 @@ off64_t pyvslvm_file_object_io_handle_seek_offset(
          int whence,
          libcerror_error_t **error )
 {
-	static char *function      = "pyvslvm_file_object_io_handle_seek_offset";
-	PyGILState_STATE gil_state = 0;
+	static char *function = "pyvslvm_file_object_io_handle_seek_offset";
+	size64_t size         = 0;
 
 	if( file_object_io_handle == NULL )
 	{
@@ -1152,47 +1608,54 @@ off64_t pyvslvm_file_object_io_handle_seek_offset(
 
 		return( -1 );
 	}
-	gil_state = PyGILState_Ensure();
+	if( whence == SEEK_CUR )
+	{
+		offset += file_object_io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		if( pyvslvm_file_object_io_handle_get_size(
+		     file_object_io_handle,
+		     &size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of file object.",
+			 function );
 
-	if( pyvslvm_file_object_seek_offset(
-	     file_object_io_handle->file_object,
-	     offset,
-	     whence,
-	     error ) != 1 )
+			return( -1 );
+		}
+		offset += (off64_t) size;
+	}
+	else if( whence != SEEK_SET )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek in file object.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( pyvslvm_file_object_get_offset(
-	     file_object_io_handle->file_object,
-	     &offset,
-	     error ) != 1 )
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to retrieve current offset in file object.",
-		 function );
+		 "%s: unable to seek offset: %" PRIi64 " in file object.",
+		 function,
+		 offset );
 
-		goto on_error;
+		return( -1 );
 	}
-	PyGILState_Release(
-	 gil_state );
+	file_object_io_handle->current_offset = offset;
 
 	return( offset );
-
-on_error:
-	PyGILState_Release(
-	 gil_state );
-
-	return( -1 );
 }
 
 /* Function to determine if a file exists
@@ -1401,6 +1864,40 @@ int pyvslvm_file_object_io_handle_get_size(
 
 		return( -1 );
 	}
+#if defined( HAVE_PYVSLVM_FILE_OBJECT_FILE_DESCRIPTOR )
+	if( file_object_io_handle->file_descriptor != -1 )
+	{
+		if( size == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid size.",
+			 function );
+
+			return( -1 );
+		}
+		*size = file_object_io_handle->size;
+
+		return( 1 );
+	}
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     file_object_io_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	gil_state = PyGILState_Ensure();
 
 #if PY_MAJOR_VERSION >= 3
@@ -1508,6 +2005,21 @@ int pyvslvm_file_object_io_handle_get_size(
 	PyGILState_Release(
 	 gil_state );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     file_object_io_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	return( 1 );
 
 on_error:
@@ -1519,6 +2031,11 @@ on_error:
 	PyGILState_Release(
 	 gil_state );
 
-	return( 1 );
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 file_object_io_handle->mutex,
+	 NULL );
+#endif
+	return( -1 );
 }
 
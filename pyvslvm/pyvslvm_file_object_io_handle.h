@@ -27,12 +27,19 @@
 
 #include "pyvslvm_libbfio.h"
 #include "pyvslvm_libcerror.h"
+#include "pyvslvm_libcthreads.h"
 #include "pyvslvm_python.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* Reading the file object by its file descriptor requires close, fcntl with F_DUPFD_CLOEXEC, fstat and pread
+ */
+#if defined( HAVE_CLOSE ) && defined( HAVE_FCNTL ) && defined( HAVE_FCNTL_H ) && defined( HAVE_FSTAT ) && defined( HAVE_PREAD ) && !defined( WINAPI )
+#define HAVE_PYVSLVM_FILE_OBJECT_FILE_DESCRIPTOR
+#endif
+
 typedef struct pyvslvm_file_object_io_handle pyvslvm_file_object_io_handle_t;
 
 struct pyvslvm_file_object_io_handle
@@ -44,6 +51,27 @@ struct pyvslvm_file_object_io_handle
 	/* The access flags
 	 */
 	int access_flags;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+#if defined( HAVE_PYVSLVM_FILE_OBJECT_FILE_DESCRIPTOR )
+	/* The (duplicated) file descriptor of the file object
+	 * or -1 if the file object is read by calling its Python methods
+	 */
+	int file_descriptor;
+
+	/* The size when reading by file descriptor
+	 */
+	size64_t size;
+#endif
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that serializes seeking and reading the Python file object
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
 };
 
 int pyvslvm_file_object_io_handle_initialize(
@@ -70,6 +98,19 @@ int pyvslvm_file_object_io_handle_open(
      int access_flags,
      libcerror_error_t **error );
 
+#if defined( HAVE_PYVSLVM_FILE_OBJECT_FILE_DESCRIPTOR )
+
+int pyvslvm_file_object_get_file_descriptor(
+     PyObject *file_object,
+     int *file_descriptor,
+     libcerror_error_t **error );
+
+int pyvslvm_file_object_io_handle_open_file_descriptor(
+     pyvslvm_file_object_io_handle_t *file_object_io_handle,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_PYVSLVM_FILE_OBJECT_FILE_DESCRIPTOR ) */
+
 int pyvslvm_file_object_io_handle_close(
      pyvslvm_file_object_io_handle_t *file_object_io_handle,
      libcerror_error_t **error );
@@ -94,7 +94,9 @@ PyMethodDef pyvslvm_handle_object_methods[] = {
 	  METH_VARARGS | METH_KEYWORDS,
 	  "open_physical_volume_files_as_file_objects(file_objects) -> None\n"
 	  "\n"
-	  "Opens physical volume files using a list of file-like objects." },
+	  "Opens physical volume files using a list of file-like objects.\n"
+	  "File-like objects that refer to a regular file or block device\n"
+	  "are read using their file descriptor." },
 
 	{ "close",
 	  (PyCFunction) pyvslvm_handle_close,
@@ -235,9 +237,10 @@ int pyvslvm_handle_init(
 
 		return( -1 );
 	}
-	pyvslvm_handle->handle         = NULL;
-	pyvslvm_handle->file_io_handle = NULL;
-	pyvslvm_handle->file_io_pool   = NULL;
+	pyvslvm_handle->handle             = NULL;
+	pyvslvm_handle->file_io_handle     = NULL;
+	pyvslvm_handle->file_io_pool       = NULL;
+	pyvslvm_handle->clone_file_io_pool = 0;
 
 	if( libvslvm_handle_initialize(
 	     &( pyvslvm_handle->handle ),
@@ -1091,19 +1094,31 @@ PyObject *pyvslvm_handle_open_physical_volume_files(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
+	/* The file IO pool is created here instead of by libvslvm, so that
+	 * it can be cloned to read logical volumes concurrently
+	 */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libvslvm_handle_open_physical_volume_files_wide(
-	          pyvslvm_handle->handle,
+	result = libbfio_file_pool_open_wide(
+	          &( pyvslvm_handle->file_io_pool ),
 	          filenames,
 	          number_of_filenames,
+	          LIBBFIO_OPEN_READ,
 	          &error );
 #else
-	result = libvslvm_handle_open_physical_volume_files(
-	          pyvslvm_handle->handle,
+	result = libbfio_file_pool_open(
+	          &( pyvslvm_handle->file_io_pool ),
 	          filenames,
 	          number_of_filenames,
+	          LIBBFIO_OPEN_READ,
 	          &error );
 #endif
+	if( result == 1 )
+	{
+		result = libvslvm_handle_open_physical_volume_files_file_io_pool(
+		          pyvslvm_handle->handle,
+		          pyvslvm_handle->file_io_pool,
+		          &error );
+	}
 	Py_END_ALLOW_THREADS
 
 	if( result != 1 )
@@ -1119,6 +1134,7 @@ PyObject *pyvslvm_handle_open_physical_volume_files(
 
 		goto on_error;
 	}
+	pyvslvm_handle->clone_file_io_pool = 1;
 	for( filename_index = 0;
 	     filename_index < number_of_filenames;
 	     filename_index++ )
@@ -1164,6 +1180,15 @@ on_error:
 		PyMem_Free(
 		 filenames );
 	}
+	if( pyvslvm_handle->file_io_pool != NULL )
+	{
+		libbfio_pool_close_all(
+		 pyvslvm_handle->file_io_pool,
+		 NULL );
+		libbfio_pool_free(
+		 &( pyvslvm_handle->file_io_pool ),
+		 NULL );
+	}
 	return( NULL );
 }
 
@@ -1344,6 +1369,8 @@ PyObject *pyvslvm_handle_close(
 			return( NULL );
 		}
 	}
+	pyvslvm_handle->clone_file_io_pool = 0;
+
 	Py_IncRef(
 	 Py_None );
 
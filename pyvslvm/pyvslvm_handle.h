@@ -53,6 +53,12 @@ struct pyvslvm_handle
 	/* The file IO pool
 	 */
 	libbfio_pool_t *file_io_pool;
+
+	/* Value to indicate the file IO pool is cloned for every logical volume
+	 * This is only the case for physical volume files opened by name, since
+	 * the clones of file objects share the same Python file object
+	 */
+	uint8_t clone_file_io_pool;
 };
 
 extern PyMethodDef pyvslvm_handle_object_methods[];
@@ -28,10 +28,12 @@
 
 #include "pyvslvm_error.h"
 #include "pyvslvm_integer.h"
+#include "pyvslvm_libbfio.h"
 #include "pyvslvm_libcerror.h"
 #include "pyvslvm_libvslvm.h"
 #include "pyvslvm_logical_volume.h"
 #include "pyvslvm_python.h"
+#include "pyvslvm_read_requests.h"
 #include "pyvslvm_segment.h"
 #include "pyvslvm_segments.h"
 #include "pyvslvm_unused.h"
@@ -55,6 +57,44 @@ PyMethodDef pyvslvm_logical_volume_object_methods[] = {
 	  "\n"
 	  "Reads a buffer of data at a specific offset." },
 
+	{ "read_buffer_into",
+	  (PyCFunction) pyvslvm_logical_volume_read_buffer_into,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_buffer_into(buffer) -> Integer\n"
+	  "\n"
+	  "Reads data into a writable buffer object, such as a bytearray or memoryview,\n"
+	  "and returns the number of bytes read." },
+
+	{ "read_buffer_at_offset_into",
+	  (PyCFunction) pyvslvm_logical_volume_read_buffer_at_offset_into,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_buffer_at_offset_into(buffer, offset) -> Integer\n"
+	  "\n"
+	  "Reads data at a specific offset into a writable buffer object, such as\n"
+	  "a bytearray or memoryview, and returns the number of bytes read." },
+
+#if PY_MAJOR_VERSION >= 3
+	{ "read_buffer_at_offset_async",
+	  (PyCFunction) pyvslvm_logical_volume_read_buffer_at_offset_async,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_buffer_at_offset_async(size, offset) -> Future\n"
+	  "\n"
+	  "Reads a buffer of data at a specific offset asynchronously. Returns an\n"
+	  "awaitable future of the running asyncio event loop that resolves to\n"
+	  "the data read." },
+
+	{ "read_buffer_at_offset_into_async",
+	  (PyCFunction) pyvslvm_logical_volume_read_buffer_at_offset_into_async,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_buffer_at_offset_into_async(buffer, offset) -> Future\n"
+	  "\n"
+	  "Reads data at a specific offset into a writable buffer object asynchronously.\n"
+	  "Returns an awaitable future of the running asyncio event loop that resolves\n"
+	  "to the number of bytes read. The buffer object cannot be resized until\n"
+	  "the future is done." },
+
+#endif /* PY_MAJOR_VERSION >= 3 */
+
 	{ "seek_offset",
 	  (PyCFunction) pyvslvm_logical_volume_seek_offset,
 	  METH_VARARGS | METH_KEYWORDS,
@@ -78,6 +118,20 @@ PyMethodDef pyvslvm_logical_volume_object_methods[] = {
 	  "\n"
 	  "Reads a buffer of data." },
 
+	{ "readinto",
+	  (PyCFunction) pyvslvm_logical_volume_read_buffer_into,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "readinto(buffer) -> Integer\n"
+	  "\n"
+	  "Reads data into a writable buffer object." },
+
+	{ "read_at_offset_into",
+	  (PyCFunction) pyvslvm_logical_volume_read_buffer_at_offset_into,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_at_offset_into(buffer, offset) -> Integer\n"
+	  "\n"
+	  "Reads data at a specific offset into a writable buffer object." },
+
 	{ "seek",
 	  (PyCFunction) pyvslvm_logical_volume_seek_offset,
 	  METH_VARARGS | METH_KEYWORDS,
@@ -138,6 +192,23 @@ PyMethodDef pyvslvm_logical_volume_object_methods[] = {
 	  "\n"
 	  "Retrieves a sequence object of the segments." },
 
+	/* Functions to access the extent runs */
+
+	{ "get_number_of_extent_runs",
+	  (PyCFunction) pyvslvm_logical_volume_get_number_of_extent_runs,
+	  METH_NOARGS,
+	  "get_number_of_extent_runs() -> Integer\n"
+	  "\n"
+	  "Retrieves the number of extent runs." },
+
+	{ "get_extent_run",
+	  (PyCFunction) pyvslvm_logical_volume_get_extent_run,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_extent_run(extent_run_index) -> Tuple( Integer, Integer, Integer, Integer, Integer )\n"
+	  "\n"
+	  "Retrieves a specific extent run as a tuple of the logical offset, size,\n"
+	  "physical volume index, physical volume offset and type." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -174,6 +245,12 @@ PyGetSetDef pyvslvm_logical_volume_object_get_set_definitions[] = {
 	  "The segments.",
 	  NULL },
 
+	{ "number_of_extent_runs",
+	  (getter) pyvslvm_logical_volume_get_number_of_extent_runs,
+	  (setter) 0,
+	  "The number of extent runs.",
+	  NULL },
+
 	/* Sentinel */
 	{ NULL, NULL, NULL, NULL, NULL }
 };
@@ -274,10 +351,12 @@ PyTypeObject pyvslvm_logical_volume_type_object = {
 };
 
 /* Creates a new logical volume object
+ * The logical volume object takes over management of the file IO pool
  * Returns a Python object if successful or NULL on error
  */
 PyObject *pyvslvm_logical_volume_new(
            libvslvm_logical_volume_t *logical_volume,
+           libbfio_pool_t *file_io_pool,
            pyvslvm_volume_group_t *volume_group_object )
 {
 	pyvslvm_logical_volume_t *pyvslvm_logical_volume = NULL;
@@ -316,6 +395,7 @@ PyObject *pyvslvm_logical_volume_new(
 		goto on_error;
 	}
 	pyvslvm_logical_volume->logical_volume      = logical_volume;
+	pyvslvm_logical_volume->file_io_pool        = file_io_pool;
 	pyvslvm_logical_volume->volume_group_object = volume_group_object;
 
 	Py_IncRef(
@@ -352,6 +432,7 @@ int pyvslvm_logical_volume_init(
 	/* Make sure libvslvm logical volume is set to NULL
 	 */
 	pyvslvm_logical_volume->logical_volume = NULL;
+	pyvslvm_logical_volume->file_io_pool   = NULL;
 
 	return( 0 );
 }
@@ -417,6 +498,24 @@ void pyvslvm_logical_volume_free(
 		libcerror_error_free(
 		 &error );
 	}
+	/* The file IO pool is freed after the logical volume that uses it
+	 */
+	if( pyvslvm_logical_volume->file_io_pool != NULL )
+	{
+		if( libbfio_pool_free(
+		     &( pyvslvm_logical_volume->file_io_pool ),
+		     &error ) != 1 )
+		{
+			pyvslvm_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to free libbfio file IO pool.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
 	if( pyvslvm_logical_volume->volume_group_object != NULL )
 	{
 		Py_DecRef(
@@ -670,6 +769,308 @@ PyObject *pyvslvm_logical_volume_read_buffer_at_offset(
 	return( string_object );
 }
 
+/* Reads data at the current offset into a writable buffer object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyvslvm_logical_volume_read_buffer_into(
+           pyvslvm_logical_volume_t *pyvslvm_logical_volume,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	Py_buffer buffer_view;
+
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyvslvm_logical_volume_read_buffer_into";
+	static char *keyword_list[] = { "buffer", NULL };
+	ssize_t read_count          = 0;
+
+	if( pyvslvm_logical_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid pyvslvm logical volume.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "w*",
+	     keyword_list,
+	     &buffer_view ) == 0 )
+	{
+		return( NULL );
+	}
+	/* The buffer object cannot be resized or released while it is exported
+	 * hence it is safe to read into it without holding the GIL
+	 */
+	Py_BEGIN_ALLOW_THREADS
+
+	read_count = libvslvm_logical_volume_read_buffer(
+	              pyvslvm_logical_volume->logical_volume,
+	              (uint8_t *) buffer_view.buf,
+	              (size_t) buffer_view.len,
+	              &error );
+
+	Py_END_ALLOW_THREADS
+
+	PyBuffer_Release(
+	 &buffer_view );
+
+	if( read_count <= -1 )
+	{
+		pyvslvm_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( pyvslvm_integer_signed_new_from_64bit(
+	         (int64_t) read_count ) );
+}
+
+/* Reads data at a specific offset into a writable buffer object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyvslvm_logical_volume_read_buffer_at_offset_into(
+           pyvslvm_logical_volume_t *pyvslvm_logical_volume,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	Py_buffer buffer_view;
+
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyvslvm_logical_volume_read_buffer_at_offset_into";
+	static char *keyword_list[] = { "buffer", "offset", NULL };
+	off64_t read_offset         = 0;
+	ssize_t read_count          = 0;
+
+	if( pyvslvm_logical_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid pyvslvm logical volume.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "w*L",
+	     keyword_list,
+	     &buffer_view,
+	     &read_offset ) == 0 )
+	{
+		return( NULL );
+	}
+	if( read_offset < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid argument read offset value less than zero.",
+		 function );
+
+		PyBuffer_Release(
+		 &buffer_view );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	read_count = libvslvm_logical_volume_read_buffer_at_offset(
+	              pyvslvm_logical_volume->logical_volume,
+	              (uint8_t *) buffer_view.buf,
+	              (size_t) buffer_view.len,
+	              (off64_t) read_offset,
+	              &error );
+
+	Py_END_ALLOW_THREADS
+
+	PyBuffer_Release(
+	 &buffer_view );
+
+	if( read_count <= -1 )
+	{
+		pyvslvm_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( pyvslvm_integer_signed_new_from_64bit(
+	         (int64_t) read_count ) );
+}
+
+#if PY_MAJOR_VERSION >= 3
+
+/* Reads a buffer of data at a specific offset asynchronously
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyvslvm_logical_volume_read_buffer_at_offset_async(
+           pyvslvm_logical_volume_t *pyvslvm_logical_volume,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	pyvslvm_read_request_t *read_request = NULL;
+	static char *function                = "pyvslvm_logical_volume_read_buffer_at_offset_async";
+	static char *keyword_list[]          = { "size", "offset", NULL };
+	off64_t read_offset                  = 0;
+	Py_ssize_t read_size                 = 0;
+
+	if( pyvslvm_logical_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid pyvslvm logical volume.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "nL",
+	     keyword_list,
+	     &read_size,
+	     &read_offset ) == 0 )
+	{
+		return( NULL );
+	}
+	if( ( read_size < 0 )
+	 || ( read_size > (Py_ssize_t) INT_MAX ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid argument read size value out of bounds.",
+		 function );
+
+		return( NULL );
+	}
+	if( read_offset < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid argument read offset value less than zero.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyvslvm_read_request_initialize(
+	     &read_request,
+	     (PyObject *) pyvslvm_logical_volume,
+	     read_offset ) != 1 )
+	{
+		return( NULL );
+	}
+	read_request->string_object = PyBytes_FromStringAndSize(
+	                               NULL,
+	                               read_size );
+
+	if( read_request->string_object == NULL )
+	{
+		pyvslvm_read_requests_free(
+		 read_request,
+		 1 );
+
+		return( NULL );
+	}
+	read_request->buffer      = (uint8_t *) PyBytes_AsString(
+	                                         read_request->string_object );
+	read_request->buffer_size = (size_t) read_size;
+
+	/* The read request is freed when it completes or on error
+	 */
+	return( pyvslvm_read_request_submit(
+	         read_request ) );
+}
+
+/* Reads data at a specific offset into a writable buffer object asynchronously
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyvslvm_logical_volume_read_buffer_at_offset_into_async(
+           pyvslvm_logical_volume_t *pyvslvm_logical_volume,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	pyvslvm_read_request_t *read_request = NULL;
+	PyObject *buffer_object              = NULL;
+	static char *function                = "pyvslvm_logical_volume_read_buffer_at_offset_into_async";
+	static char *keyword_list[]          = { "buffer", "offset", NULL };
+	off64_t read_offset                  = 0;
+
+	if( pyvslvm_logical_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid pyvslvm logical volume.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "OL",
+	     keyword_list,
+	     &buffer_object,
+	     &read_offset ) == 0 )
+	{
+		return( NULL );
+	}
+	if( read_offset < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid argument read offset value less than zero.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyvslvm_read_request_initialize(
+	     &read_request,
+	     (PyObject *) pyvslvm_logical_volume,
+	     read_offset ) != 1 )
+	{
+		return( NULL );
+	}
+	/* The buffer view is held until the read request completes
+	 * so that the buffer object cannot be resized or released while it is read into
+	 */
+	if( PyObject_GetBuffer(
+	     buffer_object,
+	     &( read_request->buffer_view ),
+	     PyBUF_WRITABLE ) != 0 )
+	{
+		pyvslvm_read_requests_free(
+		 read_request,
+		 1 );
+
+		return( NULL );
+	}
+	read_request->has_buffer_view = 1;
+	read_request->buffer          = (uint8_t *) read_request->buffer_view.buf;
+	read_request->buffer_size     = (size_t) read_request->buffer_view.len;
+
+	/* The read request is freed when it completes or on error
+	 */
+	return( pyvslvm_read_request_submit(
+	         read_request ) );
+}
+
+#endif /* PY_MAJOR_VERSION >= 3 */
+
 /* Seeks a certain offset in the data
  * Returns a Python object if successful or NULL on error
  */
@@ -1280,3 +1681,225 @@ PyObject *pyvslvm_logical_volume_get_segments(
 	return( segments_object );
 }
 
+/* Retrieves the number of extent runs
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyvslvm_logical_volume_get_number_of_extent_runs(
+           pyvslvm_logical_volume_t *pyvslvm_logical_volume,
+           PyObject *arguments PYVSLVM_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error  = NULL;
+	PyObject *integer_object  = NULL;
+	static char *function     = "pyvslvm_logical_volume_get_number_of_extent_runs";
+	int number_of_extent_runs = 0;
+	int result                = 0;
+
+	PYVSLVM_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyvslvm_logical_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libvslvm_logical_volume_get_number_of_extent_runs(
+	          pyvslvm_logical_volume->logical_volume,
+	          &number_of_extent_runs,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyvslvm_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of extent runs.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+#if PY_MAJOR_VERSION >= 3
+	integer_object = PyLong_FromLong(
+	                  (long) number_of_extent_runs );
+#else
+	integer_object = PyInt_FromLong(
+	                  (long) number_of_extent_runs );
+#endif
+	return( integer_object );
+}
+
+/* Retrieves a specific extent run by index
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyvslvm_logical_volume_get_extent_run_by_index(
+           PyObject *pyvslvm_logical_volume,
+           int extent_run_index )
+{
+	libcerror_error_t *error       = NULL;
+	PyObject *integer_object       = NULL;
+	PyObject *tuple_object         = NULL;
+	static char *function          = "pyvslvm_logical_volume_get_extent_run_by_index";
+	off64_t logical_offset         = 0;
+	off64_t physical_volume_offset = 0;
+	size64_t size                  = 0;
+	uint8_t extent_run_type        = 0;
+	int physical_volume_index      = 0;
+	int result                     = 0;
+
+	if( pyvslvm_logical_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libvslvm_logical_volume_get_extent_run_by_index(
+	          ( (pyvslvm_logical_volume_t *) pyvslvm_logical_volume )->logical_volume,
+	          extent_run_index,
+	          &logical_offset,
+	          &size,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &extent_run_type,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyvslvm_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve extent run: %d.",
+		 function,
+		 extent_run_index );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	tuple_object = PyTuple_New(
+	                5 );
+
+	if( tuple_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create tuple object.",
+		 function );
+
+		goto on_error;
+	}
+	integer_object = pyvslvm_integer_signed_new_from_64bit(
+	                  (int64_t) logical_offset );
+
+	/* Note that PyTuple_SetItem steals the reference to the integer object
+	 */
+	if( PyTuple_SetItem(
+	     tuple_object,
+	     0,
+	     integer_object ) != 0 )
+	{
+		goto on_error;
+	}
+	integer_object = pyvslvm_integer_unsigned_new_from_64bit(
+	                  (uint64_t) size );
+
+	if( PyTuple_SetItem(
+	     tuple_object,
+	     1,
+	     integer_object ) != 0 )
+	{
+		goto on_error;
+	}
+#if PY_MAJOR_VERSION >= 3
+	integer_object = PyLong_FromLong(
+	                  (long) physical_volume_index );
+#else
+	integer_object = PyInt_FromLong(
+	                  (long) physical_volume_index );
+#endif
+	if( PyTuple_SetItem(
+	     tuple_object,
+	     2,
+	     integer_object ) != 0 )
+	{
+		goto on_error;
+	}
+	integer_object = pyvslvm_integer_signed_new_from_64bit(
+	                  (int64_t) physical_volume_offset );
+
+	if( PyTuple_SetItem(
+	     tuple_object,
+	     3,
+	     integer_object ) != 0 )
+	{
+		goto on_error;
+	}
+#if PY_MAJOR_VERSION >= 3
+	integer_object = PyLong_FromLong(
+	                  (long) extent_run_type );
+#else
+	integer_object = PyInt_FromLong(
+	                  (long) extent_run_type );
+#endif
+	if( PyTuple_SetItem(
+	     tuple_object,
+	     4,
+	     integer_object ) != 0 )
+	{
+		goto on_error;
+	}
+	return( tuple_object );
+
+on_error:
+	if( tuple_object != NULL )
+	{
+		Py_DecRef(
+		 tuple_object );
+	}
+	return( NULL );
+}
+
+/* Retrieves a specific extent run
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyvslvm_logical_volume_get_extent_run(
+           pyvslvm_logical_volume_t *pyvslvm_logical_volume,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *tuple_object      = NULL;
+	static char *keyword_list[] = { "extent_run_index", NULL };
+	int extent_run_index        = 0;
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &extent_run_index ) == 0 )
+	{
+		return( NULL );
+	}
+	tuple_object = pyvslvm_logical_volume_get_extent_run_by_index(
+	                (PyObject *) pyvslvm_logical_volume,
+	                extent_run_index );
+
+	return( tuple_object );
+}
+
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "pyvslvm_libbfio.h"
 #include "pyvslvm_libvslvm.h"
 #include "pyvslvm_python.h"
 #include "pyvslvm_volume_group.h"
@@ -45,6 +46,13 @@ struct pyvslvm_logical_volume
 	 */
 	libvslvm_logical_volume_t *logical_volume;
 
+	/* The physical volume file IO pool of the logical volume
+	 * This is a clone of the file IO pool of the handle, so that reads
+	 * of different logical volumes do not share its lock, or NULL if
+	 * the logical volume reads from the file IO pool of the handle
+	 */
+	libbfio_pool_t *file_io_pool;
+
 	/* The pyvslvm volume group object
 	 */
 	pyvslvm_volume_group_t *volume_group_object;
@@ -55,6 +63,7 @@ extern PyTypeObject pyvslvm_logical_volume_type_object;
 
 PyObject *pyvslvm_logical_volume_new(
            libvslvm_logical_volume_t *logical_volume,
+           libbfio_pool_t *file_io_pool,
            pyvslvm_volume_group_t *volume_group_object );
 
 int pyvslvm_logical_volume_init(
@@ -73,6 +82,30 @@ PyObject *pyvslvm_logical_volume_read_buffer_at_offset(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyvslvm_logical_volume_read_buffer_into(
+           pyvslvm_logical_volume_t *pyvslvm_logical_volume,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyvslvm_logical_volume_read_buffer_at_offset_into(
+           pyvslvm_logical_volume_t *pyvslvm_logical_volume,
+           PyObject *arguments,
+           PyObject *keywords );
+
+#if PY_MAJOR_VERSION >= 3
+
+PyObject *pyvslvm_logical_volume_read_buffer_at_offset_async(
+           pyvslvm_logical_volume_t *pyvslvm_logical_volume,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyvslvm_logical_volume_read_buffer_at_offset_into_async(
+           pyvslvm_logical_volume_t *pyvslvm_logical_volume,
+           PyObject *arguments,
+           PyObject *keywords );
+
+#endif /* PY_MAJOR_VERSION >= 3 */
+
 PyObject *pyvslvm_logical_volume_seek_offset(
            pyvslvm_logical_volume_t *pyvslvm_logical_volume,
            PyObject *arguments,
@@ -111,6 +144,19 @@ PyObject *pyvslvm_logical_volume_get_segments(
            pyvslvm_logical_volume_t *pyvslvm_logical_volume,
            PyObject *arguments );
 
+PyObject *pyvslvm_logical_volume_get_number_of_extent_runs(
+           pyvslvm_logical_volume_t *pyvslvm_logical_volume,
+           PyObject *arguments );
+
+PyObject *pyvslvm_logical_volume_get_extent_run_by_index(
+           PyObject *pyvslvm_logical_volume,
+           int extent_run_index );
+
+PyObject *pyvslvm_logical_volume_get_extent_run(
+           pyvslvm_logical_volume_t *pyvslvm_logical_volume,
+           PyObject *arguments,
+           PyObject *keywords );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,1250 @@
+/*
+ * Read requests functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyvslvm_error.h"
+#include "pyvslvm_integer.h"
+#include "pyvslvm_libcerror.h"
+#include "pyvslvm_libcthreads.h"
+#include "pyvslvm_libvslvm.h"
+#include "pyvslvm_logical_volume.h"
+#include "pyvslvm_python.h"
+#include "pyvslvm_read_requests.h"
+#include "pyvslvm_unused.h"
+
+/* Reads the data of a read request
+ * Callback function for the read thread pool
+ * Make sure not to hold the GIL state when calling this function
+ * Returns 1 if successful or -1 on error
+ */
+int pyvslvm_read_request_read(
+     pyvslvm_read_request_t *read_request,
+     void *arguments PYVSLVM_ATTRIBUTE_UNUSED )
+{
+	PYVSLVM_UNREFERENCED_PARAMETER( arguments )
+
+	if( read_request == NULL )
+	{
+		return( -1 );
+	}
+	if( read_request->buffer_size == 0 )
+	{
+		read_request->read_count = 0;
+
+		return( 1 );
+	}
+	/* The error is stored in the read request and raised by the thread that holds the GIL
+	 */
+	read_request->read_count = libvslvm_logical_volume_read_buffer_at_offset(
+	                            read_request->logical_volume,
+	                            read_request->buffer,
+	                            read_request->buffer_size,
+	                            read_request->offset,
+	                            &( read_request->error ) );
+
+	if( read_request->read_count == -1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the data of the read requests
+ * The read requests are divided over a thread pool if multi-threading is supported
+ * and more than 1 thread is requested, otherwise they are read in order
+ * Read requests of the same logical volume are serialized by the lock of the logical volume.
+ * Read requests of different logical volumes only run concurrently if every logical volume
+ * has its own physical volume file IO pool, otherwise they are serialized by the pool lock
+ * The result of every read request is stored in the read request
+ * Make sure not to hold the GIL state when calling this function
+ * Returns 1 if successful or -1 on error
+ */
+int pyvslvm_read_requests_read(
+     pyvslvm_read_request_t *read_requests,
+     int number_of_read_requests,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *read_thread_pool = NULL;
+#endif
+
+	static char *function                       = "pyvslvm_read_requests_read";
+	int read_request_index                      = 0;
+
+	if( ( read_requests == NULL )
+	 && ( number_of_read_requests > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read requests.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_read_requests < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of read requests value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of threads value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( number_of_threads > 1 )
+	 && ( number_of_read_requests > 1 ) )
+	{
+		if( number_of_threads > number_of_read_requests )
+		{
+			number_of_threads = number_of_read_requests;
+		}
+		if( libcthreads_thread_pool_create(
+		     &read_thread_pool,
+		     NULL,
+		     number_of_threads,
+		     number_of_read_requests,
+		     (int (*)(intptr_t *, void *)) &pyvslvm_read_request_read,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create read thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( read_request_index = 0;
+		     read_request_index < number_of_read_requests;
+		     read_request_index++ )
+		{
+			if( libcthreads_thread_pool_push(
+			     read_thread_pool,
+			     (intptr_t *) &( read_requests[ read_request_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to push read request: %d onto read thread pool.",
+				 function,
+				 read_request_index );
+
+				goto on_error;
+			}
+		}
+		/* Joining waits until all pushed read requests have been read
+		 */
+		if( libcthreads_thread_pool_join(
+		     &read_thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join read thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	for( read_request_index = 0;
+	     read_request_index < number_of_read_requests;
+	     read_request_index++ )
+	{
+		pyvslvm_read_request_read(
+		 &( read_requests[ read_request_index ] ),
+		 NULL );
+	}
+	return( 1 );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+on_error:
+	/* The buffers of the read requests that were pushed are in use
+	 * until the read thread pool has been joined
+	 */
+	if( read_thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &read_thread_pool,
+		 NULL );
+	}
+	return( -1 );
+#endif
+}
+
+/* Frees the read requests and releases the Python objects they reference
+ * Make sure to hold the GIL state before calling this function
+ */
+void pyvslvm_read_requests_free(
+      pyvslvm_read_request_t *read_requests,
+      int number_of_read_requests )
+{
+	int read_request_index = 0;
+
+	if( read_requests == NULL )
+	{
+		return;
+	}
+	for( read_request_index = 0;
+	     read_request_index < number_of_read_requests;
+	     read_request_index++ )
+	{
+		if( read_requests[ read_request_index ].has_buffer_view != 0 )
+		{
+			PyBuffer_Release(
+			 &( read_requests[ read_request_index ].buffer_view ) );
+		}
+		if( read_requests[ read_request_index ].string_object != NULL )
+		{
+			Py_DecRef(
+			 read_requests[ read_request_index ].string_object );
+		}
+		if( read_requests[ read_request_index ].logical_volume_object != NULL )
+		{
+			Py_DecRef(
+			 read_requests[ read_request_index ].logical_volume_object );
+		}
+		if( read_requests[ read_request_index ].error != NULL )
+		{
+			libcerror_error_free(
+			 &( read_requests[ read_request_index ].error ) );
+		}
+		if( read_requests[ read_request_index ].future != NULL )
+		{
+			Py_DecRef(
+			 read_requests[ read_request_index ].future );
+		}
+		if( read_requests[ read_request_index ].event_loop != NULL )
+		{
+			Py_DecRef(
+			 read_requests[ read_request_index ].event_loop );
+		}
+	}
+	PyMem_Free(
+	 read_requests );
+}
+
+/* Creates a read request
+ * Make sure the value read_request is referencing, is set to NULL
+ * Make sure to hold the GIL state before calling this function
+ * Returns 1 if successful or -1 on error
+ */
+int pyvslvm_read_request_initialize(
+     pyvslvm_read_request_t **read_request,
+     PyObject *logical_volume_object,
+     off64_t offset )
+{
+	static char *function = "pyvslvm_read_request_initialize";
+
+	if( read_request == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid read request.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_request != NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid read request value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( PyObject_TypeCheck(
+	     logical_volume_object,
+	     &pyvslvm_logical_volume_type_object ) == 0 )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: unsupported logical volume object.",
+		 function );
+
+		return( -1 );
+	}
+	*read_request = (pyvslvm_read_request_t *) PyMem_Malloc(
+	                                            sizeof( pyvslvm_read_request_t ) );
+
+	if( *read_request == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create read request.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *read_request,
+	     0,
+	     sizeof( pyvslvm_read_request_t ) ) == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to clear read request.",
+		 function );
+
+		PyMem_Free(
+		 *read_request );
+
+		*read_request = NULL;
+
+		return( -1 );
+	}
+	Py_IncRef(
+	 logical_volume_object );
+
+	( *read_request )->logical_volume_object = logical_volume_object;
+	( *read_request )->logical_volume        = ( (pyvslvm_logical_volume_t *) logical_volume_object )->logical_volume;
+	( *read_request )->offset                = offset;
+
+	return( 1 );
+}
+
+/* Retrieves the result of a read request that was read successfully
+ * The result is the string object with the data read or, if the data was read
+ * into a buffer object, the number of bytes read
+ * Make sure to hold the GIL state before calling this function
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyvslvm_read_request_get_result(
+           pyvslvm_read_request_t *read_request )
+{
+	PyObject *result_object = NULL;
+	static char *function   = "pyvslvm_read_request_get_result";
+	int result              = 0;
+
+	if( read_request == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid read request.",
+		 function );
+
+		return( NULL );
+	}
+	if( read_request->has_buffer_view != 0 )
+	{
+		result_object = pyvslvm_integer_signed_new_from_64bit(
+		                 (int64_t) read_request->read_count );
+
+		return( result_object );
+	}
+	/* Need to resize the string here in case the size was not fully read.
+	 */
+#if PY_MAJOR_VERSION >= 3
+	result = _PyBytes_Resize(
+	          &( read_request->string_object ),
+	          (Py_ssize_t) read_request->read_count );
+#else
+	result = _PyString_Resize(
+	          &( read_request->string_object ),
+	          (Py_ssize_t) read_request->read_count );
+#endif
+	/* The string object is freed and set to NULL if the resize failed
+	 */
+	if( result != 0 )
+	{
+		return( NULL );
+	}
+	result_object = read_request->string_object;
+
+	read_request->string_object = NULL;
+
+	return( result_object );
+}
+
+#if PY_MAJOR_VERSION >= 3
+
+/* The method definition of the callback that sets the result of a future
+ */
+static PyMethodDef pyvslvm_read_request_set_future_result_method_definition = {
+	"_set_future_result",
+	(PyCFunction) pyvslvm_read_request_set_future_result,
+	METH_VARARGS,
+	"_set_future_result(future, value, is_exception) -> None\n"
+	"\n"
+	"Sets the result or exception of a future that is not done." };
+
+/* Sets the result or exception of a future
+ * Callback function that is scheduled on the event loop of the future
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyvslvm_read_request_set_future_result(
+           PyObject *self PYVSLVM_ATTRIBUTE_UNUSED,
+           PyObject *arguments )
+{
+	PyObject *future_object = NULL;
+	PyObject *method_result = NULL;
+	PyObject *value_object  = NULL;
+	int is_done             = 0;
+	int is_exception        = 0;
+
+	PYVSLVM_UNREFERENCED_PARAMETER( self )
+
+	if( PyArg_ParseTuple(
+	     arguments,
+	     "OOp",
+	     &future_object,
+	     &value_object,
+	     &is_exception ) == 0 )
+	{
+		return( NULL );
+	}
+	/* The future is done if it was cancelled while the data was being read
+	 */
+	method_result = PyObject_CallMethod(
+	                 future_object,
+	                 "done",
+	                 NULL );
+
+	if( method_result == NULL )
+	{
+		return( NULL );
+	}
+	is_done = PyObject_IsTrue(
+	           method_result );
+
+	Py_DecRef(
+	 method_result );
+
+	if( is_done == -1 )
+	{
+		return( NULL );
+	}
+	else if( is_done == 0 )
+	{
+		method_result = PyObject_CallMethod(
+		                 future_object,
+		                 ( is_exception != 0 ) ? "set_exception" : "set_result",
+		                 "O",
+		                 value_object );
+
+		if( method_result == NULL )
+		{
+			return( NULL );
+		}
+		Py_DecRef(
+		 method_result );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Completes an asynchronous read request
+ * The result or exception is passed to the future on the thread of its event loop
+ * Make sure to hold the GIL state before calling this function
+ */
+void pyvslvm_read_request_complete(
+      pyvslvm_read_request_t *read_request )
+{
+	PyObject *callback_object     = NULL;
+	PyObject *exception_traceback = NULL;
+	PyObject *exception_type      = NULL;
+	PyObject *method_result       = NULL;
+	PyObject *value_object        = NULL;
+	static char *function         = "pyvslvm_read_request_complete";
+	int is_exception              = 0;
+
+	if( read_request == NULL )
+	{
+		return;
+	}
+	if( read_request->read_count >= 0 )
+	{
+		value_object = pyvslvm_read_request_get_result(
+		                read_request );
+	}
+	else
+	{
+		pyvslvm_error_raise(
+		 read_request->error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+	}
+	if( value_object == NULL )
+	{
+		/* Pass the exception that was raised on to the future
+		 */
+		PyErr_Fetch(
+		 &exception_type,
+		 &value_object,
+		 &exception_traceback );
+
+		PyErr_NormalizeException(
+		 &exception_type,
+		 &value_object,
+		 &exception_traceback );
+
+		if( exception_traceback != NULL )
+		{
+			PyException_SetTraceback(
+			 value_object,
+			 exception_traceback );
+
+			Py_DecRef(
+			 exception_traceback );
+		}
+		if( exception_type != NULL )
+		{
+			Py_DecRef(
+			 exception_type );
+		}
+		is_exception = 1;
+	}
+	if( value_object == NULL )
+	{
+		return;
+	}
+	callback_object = PyCFunction_New(
+	                   &pyvslvm_read_request_set_future_result_method_definition,
+	                   NULL );
+
+	if( callback_object != NULL )
+	{
+		method_result = PyObject_CallMethod(
+		                 read_request->event_loop,
+		                 "call_soon_threadsafe",
+		                 "OOOO",
+		                 callback_object,
+		                 read_request->future,
+		                 value_object,
+		                 ( is_exception != 0 ) ? Py_True : Py_False );
+
+		Py_DecRef(
+		 callback_object );
+	}
+	if( method_result != NULL )
+	{
+		Py_DecRef(
+		 method_result );
+	}
+	else
+	{
+		/* The event loop was closed before the read request completed
+		 * hence there is no one left to pass the result to
+		 */
+		PyErr_Clear();
+	}
+	Py_DecRef(
+	 value_object );
+}
+
+/* Reads and completes an asynchronous read request
+ * Callback function for the asynchronous read thread pool
+ * Make sure not to hold the GIL state when calling this function
+ * Returns 1 if successful or -1 on error
+ */
+int pyvslvm_read_request_read_async(
+     pyvslvm_read_request_t *read_request,
+     void *arguments PYVSLVM_ATTRIBUTE_UNUSED )
+{
+	PyGILState_STATE gil_state = 0;
+	int result                 = 0;
+
+	PYVSLVM_UNREFERENCED_PARAMETER( arguments )
+
+	if( read_request == NULL )
+	{
+		return( -1 );
+	}
+	result = pyvslvm_read_request_read(
+	          read_request,
+	          NULL );
+
+	/* The GIL is only held to pass the result to the event loop
+	 */
+	gil_state = PyGILState_Ensure();
+
+	pyvslvm_read_request_complete(
+	 read_request );
+
+	pyvslvm_read_requests_free(
+	 read_request,
+	 1 );
+
+	PyGILState_Release(
+	 gil_state );
+
+	return( result );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* The thread pool that reads the asynchronous read requests
+ * It is created on the first asynchronous read request and joined when the interpreter exits
+ * Access is serialized by the GIL
+ */
+static libcthreads_thread_pool_t *pyvslvm_read_requests_thread_pool = NULL;
+
+/* The method definition of the function that joins the asynchronous read thread pool
+ */
+static PyMethodDef pyvslvm_read_requests_join_thread_pool_method_definition = {
+	"_join_thread_pool",
+	(PyCFunction) pyvslvm_read_requests_join_thread_pool,
+	METH_NOARGS,
+	"_join_thread_pool() -> None\n"
+	"\n"
+	"Joins the thread pool that reads asynchronous read requests." };
+
+/* Joins the asynchronous read thread pool
+ * Registered with the atexit module when the thread pool is created
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyvslvm_read_requests_join_thread_pool(
+           PyObject *self PYVSLVM_ATTRIBUTE_UNUSED,
+           PyObject *arguments PYVSLVM_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error               = NULL;
+	libcthreads_thread_pool_t *thread_pool = NULL;
+	static char *function                  = "pyvslvm_read_requests_join_thread_pool";
+	int result                             = 1;
+
+	PYVSLVM_UNREFERENCED_PARAMETER( self )
+	PYVSLVM_UNREFERENCED_PARAMETER( arguments )
+
+	thread_pool = pyvslvm_read_requests_thread_pool;
+
+	pyvslvm_read_requests_thread_pool = NULL;
+
+	if( thread_pool != NULL )
+	{
+		/* The GIL is released since the threads need it to complete the queued read requests
+		 */
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libcthreads_thread_pool_join(
+		          &thread_pool,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyvslvm_error_raise(
+			 error,
+			 PyExc_RuntimeError,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			return( NULL );
+		}
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Retrieves the asynchronous read thread pool
+ * The thread pool is created if it does not exist
+ * Make sure to hold the GIL state before calling this function
+ * Returns 1 if successful or -1 on error
+ */
+int pyvslvm_read_requests_get_thread_pool(
+     libcthreads_thread_pool_t **thread_pool,
+     libcerror_error_t **error )
+{
+	PyObject *atexit_module   = NULL;
+	PyObject *callback_object = NULL;
+	PyObject *method_result   = NULL;
+	static char *function     = "pyvslvm_read_requests_get_thread_pool";
+
+	if( thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( pyvslvm_read_requests_thread_pool == NULL )
+	{
+		/* Make sure the thread pool is joined before the interpreter is finalized
+		 */
+		atexit_module = PyImport_ImportModule(
+		                 "atexit" );
+
+		if( atexit_module != NULL )
+		{
+			callback_object = PyCFunction_New(
+			                   &pyvslvm_read_requests_join_thread_pool_method_definition,
+			                   NULL );
+		}
+		if( callback_object != NULL )
+		{
+			method_result = PyObject_CallMethod(
+			                 atexit_module,
+			                 "register",
+			                 "O",
+			                 callback_object );
+
+			Py_DecRef(
+			 callback_object );
+		}
+		if( atexit_module != NULL )
+		{
+			Py_DecRef(
+			 atexit_module );
+		}
+		if( method_result == NULL )
+		{
+			pyvslvm_error_fetch(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to register thread pool with atexit.",
+			 function );
+
+			return( -1 );
+		}
+		Py_DecRef(
+		 method_result );
+
+		if( libcthreads_thread_pool_create(
+		     &pyvslvm_read_requests_thread_pool,
+		     NULL,
+		     PYVSLVM_READ_REQUESTS_NUMBER_OF_THREADS,
+		     PYVSLVM_READ_REQUESTS_MAXIMUM_NUMBER_OF_VALUES,
+		     (int (*)(intptr_t *, void *)) &pyvslvm_read_request_read_async,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*thread_pool = pyvslvm_read_requests_thread_pool;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Submits an asynchronous read request
+ * The read request is read on the asynchronous read thread pool and the returned
+ * future of the running event loop is completed when the data has been read
+ * The read request is freed by this function or when it completes
+ * Make sure to hold the GIL state before calling this function
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyvslvm_read_request_submit(
+           pyvslvm_read_request_t *read_request )
+{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool = NULL;
+#endif
+
+	libcerror_error_t *error               = NULL;
+	PyObject *asyncio_module               = NULL;
+	PyObject *future_object                = NULL;
+	static char *function                  = "pyvslvm_read_request_submit";
+	int result                             = 0;
+
+	if( read_request == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid read request.",
+		 function );
+
+		return( NULL );
+	}
+	asyncio_module = PyImport_ImportModule(
+	                  "asyncio" );
+
+	if( asyncio_module == NULL )
+	{
+		goto on_error;
+	}
+	/* get_running_loop raises RuntimeError if there is no running event loop
+	 */
+	read_request->event_loop = PyObject_CallMethod(
+	                            asyncio_module,
+	                            "get_running_loop",
+	                            NULL );
+
+	Py_DecRef(
+	 asyncio_module );
+
+	if( read_request->event_loop == NULL )
+	{
+		goto on_error;
+	}
+	read_request->future = PyObject_CallMethod(
+	                        read_request->event_loop,
+	                        "create_future",
+	                        NULL );
+
+	if( read_request->future == NULL )
+	{
+		goto on_error;
+	}
+	future_object = read_request->future;
+
+	Py_IncRef(
+	 future_object );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( pyvslvm_read_requests_get_thread_pool(
+	     &thread_pool,
+	     &error ) != 1 )
+	{
+		pyvslvm_error_raise(
+		 error,
+		 PyExc_RuntimeError,
+		 "%s: unable to retrieve thread pool.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	/* The GIL is released since pushing blocks while the queue is full
+	 * and the threads need the GIL to complete the queued read requests
+	 */
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libcthreads_thread_pool_push(
+	          thread_pool,
+	          (intptr_t *) read_request,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyvslvm_error_raise(
+		 error,
+		 PyExc_RuntimeError,
+		 "%s: unable to push read request onto thread pool.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+#else
+	/* Without multi-threading support the data is read directly
+	 * and the future is completed the next iteration of the event loop
+	 */
+	Py_BEGIN_ALLOW_THREADS
+
+	result = pyvslvm_read_request_read(
+	          read_request,
+	          NULL );
+
+	Py_END_ALLOW_THREADS
+
+	pyvslvm_read_request_complete(
+	 read_request );
+
+	pyvslvm_read_requests_free(
+	 read_request,
+	 1 );
+#endif
+	return( future_object );
+
+on_error:
+	if( future_object != NULL )
+	{
+		Py_DecRef(
+		 future_object );
+	}
+	pyvslvm_read_requests_free(
+	 read_request,
+	 1 );
+
+	return( NULL );
+}
+
+#endif /* PY_MAJOR_VERSION >= 3 */
+
+/* Reads the data of multiple logical volume read requests
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyvslvm_read_buffers_at_offsets(
+           PyObject *self PYVSLVM_ATTRIBUTE_UNUSED,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	pyvslvm_read_request_t *read_requests = NULL;
+	libcerror_error_t *error              = NULL;
+	PyObject *buffer_object               = NULL;
+	PyObject *list_object                 = NULL;
+	PyObject *logical_volume_object       = NULL;
+	PyObject *read_request_object         = NULL;
+	PyObject *read_requests_object        = NULL;
+	PyObject *result_object               = NULL;
+	PyObject *sequence_object             = NULL;
+	static char *function                 = "pyvslvm_read_buffers_at_offsets";
+	static char *keyword_list[]           = { "read_requests", "number_of_threads", NULL };
+	Py_ssize_t sequence_size              = 0;
+	int64_t read_size                     = 0;
+	off64_t read_offset                   = 0;
+	int number_of_read_requests           = 0;
+	int number_of_threads                 = 4;
+	int read_request_index                = 0;
+	int result                            = 0;
+
+	PYVSLVM_UNREFERENCED_PARAMETER( self )
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O|i",
+	     keyword_list,
+	     &read_requests_object,
+	     &number_of_threads ) == 0 )
+	{
+		return( NULL );
+	}
+	if( number_of_threads < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid number of threads value less than zero.",
+		 function );
+
+		return( NULL );
+	}
+	sequence_object = PySequence_Fast(
+	                   read_requests_object,
+	                   "invalid read requests - not a sequence" );
+
+	if( sequence_object == NULL )
+	{
+		return( NULL );
+	}
+	sequence_size = PySequence_Fast_GET_SIZE(
+	                 sequence_object );
+
+	if( sequence_size > (Py_ssize_t) INT_MAX )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid number of read requests value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_read_requests = (int) sequence_size;
+
+	if( number_of_read_requests > 0 )
+	{
+		read_requests = (pyvslvm_read_request_t *) PyMem_Malloc(
+		                                            sizeof( pyvslvm_read_request_t ) * number_of_read_requests );
+
+		if( read_requests == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to create read requests.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     read_requests,
+		     0,
+		     sizeof( pyvslvm_read_request_t ) * number_of_read_requests ) == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to clear read requests.",
+			 function );
+
+			PyMem_Free(
+			 read_requests );
+
+			read_requests = NULL;
+
+			goto on_error;
+		}
+	}
+	for( read_request_index = 0;
+	     read_request_index < number_of_read_requests;
+	     read_request_index++ )
+	{
+		read_request_object = PySequence_Fast_GET_ITEM(
+		                       sequence_object,
+		                       (Py_ssize_t) read_request_index );
+
+		if( PyTuple_Check(
+		     read_request_object ) == 0 )
+		{
+			PyErr_Format(
+			 PyExc_TypeError,
+			 "%s: invalid read request: %d - not a tuple.",
+			 function,
+			 read_request_index );
+
+			goto on_error;
+		}
+		if( PyArg_ParseTuple(
+		     read_request_object,
+		     "OLO",
+		     &logical_volume_object,
+		     &read_offset,
+		     &buffer_object ) == 0 )
+		{
+			goto on_error;
+		}
+		if( PyObject_TypeCheck(
+		     logical_volume_object,
+		     &pyvslvm_logical_volume_type_object ) == 0 )
+		{
+			PyErr_Format(
+			 PyExc_TypeError,
+			 "%s: invalid read request: %d - unsupported logical volume object.",
+			 function,
+			 read_request_index );
+
+			goto on_error;
+		}
+		if( read_offset < 0 )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: invalid read request: %d - offset value less than zero.",
+			 function,
+			 read_request_index );
+
+			goto on_error;
+		}
+		Py_IncRef(
+		 logical_volume_object );
+
+		read_requests[ read_request_index ].logical_volume_object = logical_volume_object;
+		read_requests[ read_request_index ].logical_volume        = ( (pyvslvm_logical_volume_t *) logical_volume_object )->logical_volume;
+		read_requests[ read_request_index ].offset                = read_offset;
+
+		if( PyObject_CheckBuffer(
+		     buffer_object ) != 0 )
+		{
+			/* The buffer object cannot be resized or released while it is exported
+			 */
+			if( PyObject_GetBuffer(
+			     buffer_object,
+			     &( read_requests[ read_request_index ].buffer_view ),
+			     PyBUF_WRITABLE ) != 0 )
+			{
+				goto on_error;
+			}
+			read_requests[ read_request_index ].has_buffer_view = 1;
+			read_requests[ read_request_index ].buffer          = (uint8_t *) read_requests[ read_request_index ].buffer_view.buf;
+			read_requests[ read_request_index ].buffer_size     = (size_t) read_requests[ read_request_index ].buffer_view.len;
+		}
+		else
+		{
+			if( pyvslvm_integer_signed_copy_to_64bit(
+			     buffer_object,
+			     &read_size,
+			     &error ) != 1 )
+			{
+				pyvslvm_error_raise(
+				 error,
+				 PyExc_TypeError,
+				 "%s: invalid read request: %d - unsupported size or buffer object.",
+				 function,
+				 read_request_index );
+
+				libcerror_error_free(
+				 &error );
+
+				goto on_error;
+			}
+			if( ( read_size < 0 )
+			 || ( read_size > (int64_t) INT_MAX ) )
+			{
+				PyErr_Format(
+				 PyExc_ValueError,
+				 "%s: invalid read request: %d - size value out of bounds.",
+				 function,
+				 read_request_index );
+
+				goto on_error;
+			}
+#if PY_MAJOR_VERSION >= 3
+			read_requests[ read_request_index ].string_object = PyBytes_FromStringAndSize(
+			                                                     NULL,
+			                                                     (Py_ssize_t) read_size );
+#else
+			read_requests[ read_request_index ].string_object = PyString_FromStringAndSize(
+			                                                     NULL,
+			                                                     (Py_ssize_t) read_size );
+#endif
+			if( read_requests[ read_request_index ].string_object == NULL )
+			{
+				goto on_error;
+			}
+#if PY_MAJOR_VERSION >= 3
+			read_requests[ read_request_index ].buffer = (uint8_t *) PyBytes_AsString(
+			                                                          read_requests[ read_request_index ].string_object );
+#else
+			read_requests[ read_request_index ].buffer = (uint8_t *) PyString_AsString(
+			                                                          read_requests[ read_request_index ].string_object );
+#endif
+			read_requests[ read_request_index ].buffer_size = (size_t) read_size;
+		}
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = pyvslvm_read_requests_read(
+	          read_requests,
+	          number_of_read_requests,
+	          number_of_threads,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyvslvm_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	list_object = PyList_New(
+	               (Py_ssize_t) number_of_read_requests );
+
+	if( list_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create list object.",
+		 function );
+
+		goto on_error;
+	}
+	for( read_request_index = 0;
+	     read_request_index < number_of_read_requests;
+	     read_request_index++ )
+	{
+		if( read_requests[ read_request_index ].read_count < 0 )
+		{
+			pyvslvm_error_raise(
+			 read_requests[ read_request_index ].error,
+			 PyExc_IOError,
+			 "%s: unable to read data of read request: %d.",
+			 function,
+			 read_request_index );
+
+			goto on_error;
+		}
+		result_object = pyvslvm_read_request_get_result(
+		                 &( read_requests[ read_request_index ] ) );
+
+		if( result_object == NULL )
+		{
+			goto on_error;
+		}
+		/* PyList_SetItem steals the reference
+		 */
+		PyList_SetItem(
+		 list_object,
+		 (Py_ssize_t) read_request_index,
+		 result_object );
+	}
+	pyvslvm_read_requests_free(
+	 read_requests,
+	 number_of_read_requests );
+
+	Py_DecRef(
+	 sequence_object );
+
+	return( list_object );
+
+on_error:
+	if( list_object != NULL )
+	{
+		Py_DecRef(
+		 list_object );
+	}
+	if( read_requests != NULL )
+	{
+		pyvslvm_read_requests_free(
+		 read_requests,
+		 number_of_read_requests );
+	}
+	Py_DecRef(
+	 sequence_object );
+
+	return( NULL );
+}
+
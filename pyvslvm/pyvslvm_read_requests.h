@@ -0,0 +1,160 @@
+/*
+ * Read requests functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYVSLVM_READ_REQUESTS_H )
+#define _PYVSLVM_READ_REQUESTS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyvslvm_libcerror.h"
+#include "pyvslvm_libcthreads.h"
+#include "pyvslvm_libvslvm.h"
+#include "pyvslvm_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of threads of the thread pool that reads asynchronous read requests
+ */
+#define PYVSLVM_READ_REQUESTS_NUMBER_OF_THREADS		4
+
+/* The maximum number of asynchronous read requests that can be queued
+ */
+#define PYVSLVM_READ_REQUESTS_MAXIMUM_NUMBER_OF_VALUES	1024
+
+typedef struct pyvslvm_read_request pyvslvm_read_request_t;
+
+struct pyvslvm_read_request
+{
+	/* The logical volume object
+	 */
+	PyObject *logical_volume_object;
+
+	/* The logical volume
+	 */
+	libvslvm_logical_volume_t *logical_volume;
+
+	/* The offset
+	 */
+	off64_t offset;
+
+	/* The string object, used when the data is not read into a buffer object
+	 */
+	PyObject *string_object;
+
+	/* The buffer view of the buffer object
+	 */
+	Py_buffer buffer_view;
+
+	/* Value to indicate the buffer view is set
+	 */
+	uint8_t has_buffer_view;
+
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The read count
+	 */
+	ssize_t read_count;
+
+	/* The read error
+	 */
+	libcerror_error_t *error;
+
+	/* The event loop, used by asynchronous read requests
+	 */
+	PyObject *event_loop;
+
+	/* The future, used by asynchronous read requests
+	 */
+	PyObject *future;
+};
+
+int pyvslvm_read_request_read(
+     pyvslvm_read_request_t *read_request,
+     void *arguments );
+
+int pyvslvm_read_requests_read(
+     pyvslvm_read_request_t *read_requests,
+     int number_of_read_requests,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+void pyvslvm_read_requests_free(
+      pyvslvm_read_request_t *read_requests,
+      int number_of_read_requests );
+
+int pyvslvm_read_request_initialize(
+     pyvslvm_read_request_t **read_request,
+     PyObject *logical_volume_object,
+     off64_t offset );
+
+PyObject *pyvslvm_read_request_get_result(
+           pyvslvm_read_request_t *read_request );
+
+#if PY_MAJOR_VERSION >= 3
+
+PyObject *pyvslvm_read_request_set_future_result(
+           PyObject *self,
+           PyObject *arguments );
+
+void pyvslvm_read_request_complete(
+      pyvslvm_read_request_t *read_request );
+
+int pyvslvm_read_request_read_async(
+     pyvslvm_read_request_t *read_request,
+     void *arguments );
+
+PyObject *pyvslvm_read_request_submit(
+           pyvslvm_read_request_t *read_request );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+PyObject *pyvslvm_read_requests_join_thread_pool(
+           PyObject *self,
+           PyObject *arguments );
+
+int pyvslvm_read_requests_get_thread_pool(
+     libcthreads_thread_pool_t **thread_pool,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#endif /* PY_MAJOR_VERSION >= 3 */
+
+PyObject *pyvslvm_read_buffers_at_offsets(
+           PyObject *self,
+           PyObject *arguments,
+           PyObject *keywords );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYVSLVM_READ_REQUESTS_H ) */
+
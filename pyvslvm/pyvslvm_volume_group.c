@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H )
@@ -28,6 +29,9 @@
 #endif
 
 #include "pyvslvm_error.h"
+#include "pyvslvm_handle.h"
+#include "pyvslvm_integer.h"
+#include "pyvslvm_libbfio.h"
 #include "pyvslvm_libcerror.h"
 #include "pyvslvm_libvslvm.h"
 #include "pyvslvm_logical_volume.h"
@@ -38,6 +42,16 @@
 #include "pyvslvm_unused.h"
 #include "pyvslvm_volume_group.h"
 
+#if !defined( LIBVSLVM_HAVE_BFIO )
+
+LIBVSLVM_EXTERN \
+int libvslvm_logical_volume_set_physical_volume_file_io_pool(
+     libvslvm_logical_volume_t *logical_volume,
+     libbfio_pool_t *file_io_pool,
+     libvslvm_error_t **error );
+
+#endif /* !defined( LIBVSLVM_HAVE_BFIO ) */
+
 PyMethodDef pyvslvm_volume_group_object_methods[] = {
 
 	/* Functions to access the volume group values */
@@ -102,6 +116,17 @@ PyMethodDef pyvslvm_volume_group_object_methods[] = {
 	  "\n"
 	  "Retrieves a sequence object of the logical volumes." },
 
+	{ "get_logical_volumes_summary",
+	  (PyCFunction) pyvslvm_volume_group_get_logical_volumes_summary,
+	  METH_NOARGS,
+	  "get_logical_volumes_summary() -> List\n"
+	  "\n"
+	  "Retrieves the values of all logical volumes without creating logical volume objects.\n"
+	  "Every logical volume is represented by a tuple of the name, identifier, size and\n"
+	  "a list of segments. Every segment is represented by a tuple of the offset, size\n"
+	  "and a list of stripes. Every stripe is represented by a tuple of the physical\n"
+	  "volume name and data area offset." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -901,8 +926,10 @@ PyObject *pyvslvm_volume_group_get_logical_volume_by_index(
            PyObject *pyvslvm_volume_group,
            int volume_index )
 {
+	libbfio_pool_t *file_io_pool              = NULL;
 	libcerror_error_t *error                  = NULL;
 	libvslvm_logical_volume_t *logical_volume = NULL;
+	pyvslvm_handle_t *handle_object           = NULL;
 	PyObject *logical_volume_object           = NULL;
 	static char *function                     = "pyvslvm_volume_group_get_logical_volume_by_index";
 	int result                                = 0;
@@ -940,8 +967,49 @@ PyObject *pyvslvm_volume_group_get_logical_volume_by_index(
 
 		goto on_error;
 	}
+	handle_object = ( (pyvslvm_volume_group_t *) pyvslvm_volume_group )->handle_object;
+
+	/* A separate file IO pool per logical volume allows the logical volumes
+	 * to be read concurrently, for example by read_buffers_at_offsets
+	 */
+	if( ( handle_object != NULL )
+	 && ( handle_object->file_io_pool != NULL )
+	 && ( handle_object->clone_file_io_pool != 0 ) )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libbfio_pool_clone(
+		          &file_io_pool,
+		          handle_object->file_io_pool,
+		          &error );
+
+		if( result == 1 )
+		{
+			result = libvslvm_logical_volume_set_physical_volume_file_io_pool(
+			          logical_volume,
+			          file_io_pool,
+			          &error );
+		}
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyvslvm_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to set file IO pool of logical volume: %d.",
+			 function,
+			 volume_index );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+	}
 	logical_volume_object = pyvslvm_logical_volume_new(
 	                         logical_volume,
+	                         file_io_pool,
 	                         (pyvslvm_volume_group_t *) pyvslvm_volume_group );
 
 	if( logical_volume_object == NULL )
@@ -962,6 +1030,12 @@ on_error:
 		 &logical_volume,
 		 NULL );
 	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
 	return( NULL );
 }
 
@@ -1056,3 +1130,685 @@ PyObject *pyvslvm_volume_group_get_logical_volumes(
 	return( logical_volumes_object );
 }
 
+/* Retrieves the summary of a stripe
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyvslvm_volume_group_get_stripe_summary(
+           libvslvm_stripe_t *stripe )
+{
+	char physical_volume_name[ 64 ];
+
+	libcerror_error_t *error           = NULL;
+	PyObject *integer_object           = NULL;
+	PyObject *string_object            = NULL;
+	PyObject *tuple_object             = NULL;
+	static char *function              = "pyvslvm_volume_group_get_stripe_summary";
+	size_t physical_volume_name_length = 0;
+	off64_t data_area_offset           = 0;
+
+	if( libvslvm_stripe_get_physical_volume_name(
+	     stripe,
+	     physical_volume_name,
+	     64,
+	     &error ) != 1 )
+	{
+		pyvslvm_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve physical volume name.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	if( libvslvm_stripe_get_data_area_offset(
+	     stripe,
+	     &data_area_offset,
+	     &error ) != 1 )
+	{
+		pyvslvm_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve data area offset.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	physical_volume_name_length = narrow_string_length(
+	                               physical_volume_name );
+
+	string_object = PyUnicode_DecodeUTF8(
+	                 physical_volume_name,
+	                 (Py_ssize_t) physical_volume_name_length,
+	                 NULL );
+
+	if( string_object == NULL )
+	{
+		goto on_error;
+	}
+	integer_object = pyvslvm_integer_signed_new_from_64bit(
+	                  (int64_t) data_area_offset );
+
+	if( integer_object == NULL )
+	{
+		goto on_error;
+	}
+	tuple_object = PyTuple_New(
+	                2 );
+
+	if( tuple_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create tuple object.",
+		 function );
+
+		goto on_error;
+	}
+	/* PyTuple_SetItem steals the references
+	 */
+	PyTuple_SetItem(
+	 tuple_object,
+	 0,
+	 string_object );
+
+	PyTuple_SetItem(
+	 tuple_object,
+	 1,
+	 integer_object );
+
+	return( tuple_object );
+
+on_error:
+	if( integer_object != NULL )
+	{
+		Py_DecRef(
+		 integer_object );
+	}
+	if( string_object != NULL )
+	{
+		Py_DecRef(
+		 string_object );
+	}
+	return( NULL );
+}
+
+/* Retrieves the summary of a segment
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyvslvm_volume_group_get_segment_summary(
+           libvslvm_segment_t *segment )
+{
+	libcerror_error_t *error  = NULL;
+	libvslvm_stripe_t *stripe = NULL;
+	PyObject *list_object     = NULL;
+	PyObject *offset_object   = NULL;
+	PyObject *size_object     = NULL;
+	PyObject *stripe_object   = NULL;
+	PyObject *tuple_object    = NULL;
+	static char *function     = "pyvslvm_volume_group_get_segment_summary";
+	size64_t size             = 0;
+	off64_t offset            = 0;
+	int number_of_stripes     = 0;
+	int stripe_index          = 0;
+
+	if( libvslvm_segment_get_offset(
+	     segment,
+	     &offset,
+	     &error ) != 1 )
+	{
+		pyvslvm_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve offset.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	if( libvslvm_segment_get_size(
+	     segment,
+	     &size,
+	     &error ) != 1 )
+	{
+		pyvslvm_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve size.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	if( libvslvm_segment_get_number_of_stripes(
+	     segment,
+	     &number_of_stripes,
+	     &error ) != 1 )
+	{
+		pyvslvm_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of stripes.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	list_object = PyList_New(
+	               (Py_ssize_t) number_of_stripes );
+
+	if( list_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create list object.",
+		 function );
+
+		goto on_error;
+	}
+	for( stripe_index = 0;
+	     stripe_index < number_of_stripes;
+	     stripe_index++ )
+	{
+		if( libvslvm_segment_get_stripe(
+		     segment,
+		     stripe_index,
+		     &stripe,
+		     &error ) != 1 )
+		{
+			pyvslvm_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve stripe: %d.",
+			 function,
+			 stripe_index );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+		stripe_object = pyvslvm_volume_group_get_stripe_summary(
+		                 stripe );
+
+		libvslvm_stripe_free(
+		 &stripe,
+		 NULL );
+
+		if( stripe_object == NULL )
+		{
+			goto on_error;
+		}
+		/* PyList_SetItem steals the reference
+		 */
+		PyList_SetItem(
+		 list_object,
+		 (Py_ssize_t) stripe_index,
+		 stripe_object );
+	}
+	offset_object = pyvslvm_integer_signed_new_from_64bit(
+	                 (int64_t) offset );
+
+	if( offset_object == NULL )
+	{
+		goto on_error;
+	}
+	size_object = pyvslvm_integer_unsigned_new_from_64bit(
+	               (uint64_t) size );
+
+	if( size_object == NULL )
+	{
+		goto on_error;
+	}
+	tuple_object = PyTuple_New(
+	                3 );
+
+	if( tuple_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create tuple object.",
+		 function );
+
+		goto on_error;
+	}
+	/* PyTuple_SetItem steals the references
+	 */
+	PyTuple_SetItem(
+	 tuple_object,
+	 0,
+	 offset_object );
+
+	PyTuple_SetItem(
+	 tuple_object,
+	 1,
+	 size_object );
+
+	PyTuple_SetItem(
+	 tuple_object,
+	 2,
+	 list_object );
+
+	return( tuple_object );
+
+on_error:
+	if( size_object != NULL )
+	{
+		Py_DecRef(
+		 size_object );
+	}
+	if( offset_object != NULL )
+	{
+		Py_DecRef(
+		 offset_object );
+	}
+	if( list_object != NULL )
+	{
+		Py_DecRef(
+		 list_object );
+	}
+	return( NULL );
+}
+
+/* Retrieves the summary of a specific logical volume
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyvslvm_volume_group_get_logical_volume_summary_by_index(
+           pyvslvm_volume_group_t *pyvslvm_volume_group,
+           int volume_index )
+{
+	char identifier[ 39 ];
+
+	libcerror_error_t *error    = NULL;
+	libvslvm_segment_t *segment = NULL;
+	PyObject *identifier_object = NULL;
+	PyObject *list_object       = NULL;
+	PyObject *name_object       = NULL;
+	PyObject *segment_object    = NULL;
+	PyObject *size_object       = NULL;
+	PyObject *tuple_object      = NULL;
+	char *name                  = NULL;
+	static char *function       = "pyvslvm_volume_group_get_logical_volume_summary_by_index";
+	size64_t segment_size       = 0;
+	size64_t size               = 0;
+	size_t name_size            = 0;
+	int number_of_segments      = 0;
+	int segment_index           = 0;
+
+	if( pyvslvm_volume_group == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid volume group.",
+		 function );
+
+		return( NULL );
+	}
+	if( libvslvm_volume_group_get_logical_volume_name_size_by_index(
+	     pyvslvm_volume_group->volume_group,
+	     volume_index,
+	     &name_size,
+	     &error ) != 1 )
+	{
+		pyvslvm_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve logical volume: %d name size.",
+		 function,
+		 volume_index );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	if( name_size == 0 )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		name_object = Py_None;
+	}
+	else
+	{
+		name = (char *) PyMem_Malloc(
+		                 sizeof( char ) * name_size );
+
+		if( name == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to create name.",
+			 function );
+
+			goto on_error;
+		}
+		if( libvslvm_volume_group_get_logical_volume_name_by_index(
+		     pyvslvm_volume_group->volume_group,
+		     volume_index,
+		     name,
+		     name_size,
+		     &error ) != 1 )
+		{
+			pyvslvm_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve logical volume: %d name.",
+			 function,
+			 volume_index );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+		/* Pass the string length to PyUnicode_DecodeUTF8
+		 * otherwise it makes the end of string character is part
+		 * of the string
+		 */
+		name_object = PyUnicode_DecodeUTF8(
+		               name,
+		               (Py_ssize_t) name_size - 1,
+		               NULL );
+
+		PyMem_Free(
+		 name );
+
+		name = NULL;
+
+		if( name_object == NULL )
+		{
+			goto on_error;
+		}
+	}
+	if( libvslvm_volume_group_get_logical_volume_identifier_by_index(
+	     pyvslvm_volume_group->volume_group,
+	     volume_index,
+	     identifier,
+	     39,
+	     &error ) != 1 )
+	{
+		pyvslvm_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve logical volume: %d identifier.",
+		 function,
+		 volume_index );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	identifier_object = PyUnicode_DecodeUTF8(
+	                     identifier,
+	                     (Py_ssize_t) narrow_string_length( identifier ),
+	                     NULL );
+
+	if( identifier_object == NULL )
+	{
+		goto on_error;
+	}
+	if( libvslvm_volume_group_get_logical_volume_number_of_segments_by_index(
+	     pyvslvm_volume_group->volume_group,
+	     volume_index,
+	     &number_of_segments,
+	     &error ) != 1 )
+	{
+		pyvslvm_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve logical volume: %d number of segments.",
+		 function,
+		 volume_index );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	list_object = PyList_New(
+	               (Py_ssize_t) number_of_segments );
+
+	if( list_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create list object.",
+		 function );
+
+		goto on_error;
+	}
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		if( libvslvm_volume_group_get_logical_volume_segment_by_index(
+		     pyvslvm_volume_group->volume_group,
+		     volume_index,
+		     segment_index,
+		     &segment,
+		     &error ) != 1 )
+		{
+			pyvslvm_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve logical volume: %d segment: %d.",
+			 function,
+			 volume_index,
+			 segment_index );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+		if( libvslvm_segment_get_size(
+		     segment,
+		     &segment_size,
+		     &error ) != 1 )
+		{
+			pyvslvm_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve logical volume: %d segment: %d size.",
+			 function,
+			 volume_index,
+			 segment_index );
+
+			libcerror_error_free(
+			 &error );
+
+			libvslvm_segment_free(
+			 &segment,
+			 NULL );
+
+			goto on_error;
+		}
+		/* The size of a logical volume is the sum of the size of its segments
+		 */
+		size += segment_size;
+
+		segment_object = pyvslvm_volume_group_get_segment_summary(
+		                  segment );
+
+		libvslvm_segment_free(
+		 &segment,
+		 NULL );
+
+		if( segment_object == NULL )
+		{
+			goto on_error;
+		}
+		/* PyList_SetItem steals the reference
+		 */
+		PyList_SetItem(
+		 list_object,
+		 (Py_ssize_t) segment_index,
+		 segment_object );
+	}
+	size_object = pyvslvm_integer_unsigned_new_from_64bit(
+	               (uint64_t) size );
+
+	if( size_object == NULL )
+	{
+		goto on_error;
+	}
+	tuple_object = PyTuple_New(
+	                4 );
+
+	if( tuple_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create tuple object.",
+		 function );
+
+		goto on_error;
+	}
+	/* PyTuple_SetItem steals the references
+	 */
+	PyTuple_SetItem(
+	 tuple_object,
+	 0,
+	 name_object );
+
+	PyTuple_SetItem(
+	 tuple_object,
+	 1,
+	 identifier_object );
+
+	PyTuple_SetItem(
+	 tuple_object,
+	 2,
+	 size_object );
+
+	PyTuple_SetItem(
+	 tuple_object,
+	 3,
+	 list_object );
+
+	return( tuple_object );
+
+on_error:
+	if( size_object != NULL )
+	{
+		Py_DecRef(
+		 size_object );
+	}
+	if( list_object != NULL )
+	{
+		Py_DecRef(
+		 list_object );
+	}
+	if( identifier_object != NULL )
+	{
+		Py_DecRef(
+		 identifier_object );
+	}
+	if( name_object != NULL )
+	{
+		Py_DecRef(
+		 name_object );
+	}
+	if( name != NULL )
+	{
+		PyMem_Free(
+		 name );
+	}
+	return( NULL );
+}
+
+/* Retrieves the summary of all logical volumes
+ * The values are read from the volume group metadata directly
+ * without creating a logical volume per logical volume
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyvslvm_volume_group_get_logical_volumes_summary(
+           pyvslvm_volume_group_t *pyvslvm_volume_group,
+           PyObject *arguments PYVSLVM_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error        = NULL;
+	PyObject *list_object           = NULL;
+	PyObject *logical_volume_object = NULL;
+	static char *function           = "pyvslvm_volume_group_get_logical_volumes_summary";
+	int number_of_logical_volumes   = 0;
+	int volume_index                = 0;
+
+	PYVSLVM_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyvslvm_volume_group == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid volume group.",
+		 function );
+
+		return( NULL );
+	}
+	/* The values are retrieved from memory, hence the GIL is held
+	 * for the entire summary instead of being released per value
+	 */
+	if( libvslvm_volume_group_get_number_of_logical_volumes(
+	     pyvslvm_volume_group->volume_group,
+	     &number_of_logical_volumes,
+	     &error ) != 1 )
+	{
+		pyvslvm_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of logical volumes.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	list_object = PyList_New(
+	               (Py_ssize_t) number_of_logical_volumes );
+
+	if( list_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create list object.",
+		 function );
+
+		return( NULL );
+	}
+	for( volume_index = 0;
+	     volume_index < number_of_logical_volumes;
+	     volume_index++ )
+	{
+		logical_volume_object = pyvslvm_volume_group_get_logical_volume_summary_by_index(
+		                         pyvslvm_volume_group,
+		                         volume_index );
+
+		if( logical_volume_object == NULL )
+		{
+			Py_DecRef(
+			 list_object );
+
+			return( NULL );
+		}
+		/* PyList_SetItem steals the reference
+		 */
+		PyList_SetItem(
+		 list_object,
+		 (Py_ssize_t) volume_index,
+		 logical_volume_object );
+	}
+	return( list_object );
+}
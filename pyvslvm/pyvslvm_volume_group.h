@@ -110,6 +110,20 @@ PyObject *pyvslvm_volume_group_get_logical_volumes(
            pyvslvm_volume_group_t *pyvslvm_volume_group,
            PyObject *arguments );
 
+PyObject *pyvslvm_volume_group_get_stripe_summary(
+           libvslvm_stripe_t *stripe );
+
+PyObject *pyvslvm_volume_group_get_segment_summary(
+           libvslvm_segment_t *segment );
+
+PyObject *pyvslvm_volume_group_get_logical_volume_summary_by_index(
+           pyvslvm_volume_group_t *pyvslvm_volume_group,
+           int volume_index );
+
+PyObject *pyvslvm_volume_group_get_logical_volumes_summary(
+           pyvslvm_volume_group_t *pyvslvm_volume_group,
+           PyObject *arguments );
+
 #if defined( __cplusplus )
 }
 #endif
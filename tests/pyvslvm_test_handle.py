@@ -20,6 +20,7 @@
 # along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 import argparse
+import io
 import os
 import sys
 import unittest
@@ -27,6 +28,34 @@ import unittest
 import pyvslvm
 
 
+class CountingBytesIO(io.BytesIO):
+  """In-memory file object that counts calls to read."""
+
+  def __init__(self, *args, **kwargs):
+    """Initializes the file object."""
+    super(CountingBytesIO, self).__init__(*args, **kwargs)
+    self.number_of_read_calls = 0
+
+  def read(self, *args, **kwargs):
+    """Reads data and counts the call."""
+    self.number_of_read_calls += 1
+    return super(CountingBytesIO, self).read(*args, **kwargs)
+
+
+class CountingFileIO(io.FileIO):
+  """File object that counts calls to read."""
+
+  def __init__(self, *args, **kwargs):
+    """Initializes the file object."""
+    super(CountingFileIO, self).__init__(*args, **kwargs)
+    self.number_of_read_calls = 0
+
+  def read(self, *args, **kwargs):
+    """Reads data and counts the call."""
+    self.number_of_read_calls += 1
+    return super(CountingFileIO, self).read(*args, **kwargs)
+
+
 class HandleTypeTests(unittest.TestCase):
   """Tests the handle type."""
 
@@ -83,6 +112,60 @@ class HandleTypeTests(unittest.TestCase):
       with self.assertRaises(ValueError):
         vslvm_handle.open_file_object(file_object, mode="w")
 
+  def test_open_file_object_file_descriptor(self):
+    """Tests that open_file_object reads a regular file by its descriptor."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    if not os.path.isfile(test_source):
+      raise unittest.SkipTest("source not a regular file")
+
+    if sys.platform.startswith("win") or not hasattr(os, "pread"):
+      raise unittest.SkipTest("pread not supported")
+
+    vslvm_handle = pyvslvm.handle()
+
+    with CountingFileIO(test_source, "rb") as file_object:
+      vslvm_handle.open_file_object(file_object)
+
+      volume_group = vslvm_handle.get_volume_group()
+      self.assertIsNotNone(volume_group)
+
+      vslvm_handle.close()
+
+      # The data was read using pread on a duplicate of the file descriptor.
+      self.assertEqual(file_object.number_of_read_calls, 0)
+
+      # The duplicate did not change the offset of the file object.
+      self.assertEqual(file_object.tell(), 0)
+
+  def test_open_file_object_python_methods(self):
+    """Tests that open_file_object reads a BytesIO by its Python methods."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    if not os.path.isfile(test_source):
+      raise unittest.SkipTest("source not a regular file")
+
+    with open(test_source, "rb") as file_object:
+      data = file_object.read()
+
+    vslvm_handle = pyvslvm.handle()
+
+    file_object = CountingBytesIO(data)
+
+    vslvm_handle.open_file_object(file_object)
+
+    volume_group = vslvm_handle.get_volume_group()
+    self.assertIsNotNone(volume_group)
+
+    vslvm_handle.close()
+
+    # BytesIO has no file descriptor hence its read method is used.
+    self.assertGreater(file_object.number_of_read_calls, 0)
+
   def test_close(self):
     """Tests the close function."""
     test_source = getattr(unittest, "source", None)
@@ -0,0 +1,213 @@
+#!/usr/bin/env python3
+#
+# Python-bindings logical volume type test script
+#
+# Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+#
+# Refer to AUTHORS for acknowledgements.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+import argparse
+import io
+import os
+import sys
+import unittest
+
+import pyvslvm
+
+
+class LogicalVolumeTypeTests(unittest.TestCase):
+  """Tests the logical volume type."""
+
+  def _GetLogicalVolumes(self, vslvm_handle, test_source):
+    """Opens the source and retrieves the logical volumes.
+
+    Args:
+      vslvm_handle (pyvslvm.handle): handle.
+      test_source (str): path of the source file.
+
+    Returns:
+      list[pyvslvm.logical_volume]: logical volumes.
+    """
+    vslvm_handle.open(test_source)
+    vslvm_handle.open_physical_volume_files([test_source])
+
+    volume_group = vslvm_handle.get_volume_group()
+    self.assertIsNotNone(volume_group)
+
+    return list(volume_group.logical_volumes)
+
+  def test_get_extent_run(self):
+    """Tests the get_extent_run function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    vslvm_handle = pyvslvm.handle()
+
+    logical_volumes = self._GetLogicalVolumes(vslvm_handle, test_source)
+    if not logical_volumes:
+      raise unittest.SkipTest("missing logical volumes")
+
+    volume_group = vslvm_handle.get_volume_group()
+    number_of_physical_volumes = volume_group.get_number_of_physical_volumes()
+
+    for logical_volume in logical_volumes:
+      size = logical_volume.get_size()
+      number_of_extent_runs = logical_volume.get_number_of_extent_runs()
+      self.assertEqual(
+          logical_volume.number_of_extent_runs, number_of_extent_runs)
+
+      previous_end_offset = 0
+      for extent_run_index in range(number_of_extent_runs):
+        extent_run = logical_volume.get_extent_run(extent_run_index)
+        self.assertEqual(len(extent_run), 5)
+
+        (logical_offset, extent_run_size, physical_volume_index,
+         physical_volume_offset, extent_run_type) = extent_run
+
+        # The extent runs are sorted by logical offset and do not overlap.
+        self.assertGreaterEqual(logical_offset, previous_end_offset)
+        self.assertGreater(extent_run_size, 0)
+        self.assertLessEqual(logical_offset + extent_run_size, size)
+        self.assertGreaterEqual(physical_volume_index, 0)
+        self.assertLess(physical_volume_index, number_of_physical_volumes)
+        self.assertGreaterEqual(physical_volume_offset, 0)
+        self.assertEqual(extent_run_type, 1)
+
+        previous_end_offset = logical_offset + extent_run_size
+
+        # The source is the only physical volume hence the data of
+        # the extent run is stored at the physical volume offset.
+        if number_of_physical_volumes == 1:
+          read_size = min(extent_run_size, 4096)
+          expected_data = logical_volume.read_buffer_at_offset(
+              read_size, logical_offset)
+
+          with open(test_source, "rb") as file_object:
+            file_object.seek(physical_volume_offset, os.SEEK_SET)
+            data = file_object.read(read_size)
+
+          self.assertEqual(data, expected_data)
+
+      with self.assertRaises(IOError):
+        logical_volume.get_extent_run(number_of_extent_runs)
+
+    vslvm_handle.close()
+
+  def test_read_buffers_at_offsets(self):
+    """Tests reading logical volumes in parallel with read_buffers_at_offsets."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    vslvm_handle = pyvslvm.handle()
+
+    logical_volumes = self._GetLogicalVolumes(vslvm_handle, test_source)
+    if not logical_volumes:
+      raise unittest.SkipTest("missing logical volumes")
+
+    read_requests = []
+    for logical_volume in logical_volumes:
+      size = logical_volume.get_size()
+      for offset in range(0, min(size, 16 * 65536), 65536):
+        read_requests.append((logical_volume, offset, 4096))
+
+    expected_data = []
+    for logical_volume, offset, read_size in read_requests:
+      data = logical_volume.read_buffer_at_offset(read_size, offset)
+      expected_data.append(data)
+
+    for number_of_threads in (1, 4, 8):
+      data = pyvslvm.read_buffers_at_offsets(
+          read_requests, number_of_threads=number_of_threads)
+      self.assertEqual(data, expected_data)
+
+    buffers = [bytearray(read_size) for _, _, read_size in read_requests]
+    read_requests_into = [
+        (logical_volume, offset, buffer)
+        for (logical_volume, offset, _), buffer in zip(read_requests, buffers)]
+
+    read_counts = pyvslvm.read_buffers_at_offsets(
+        read_requests_into, number_of_threads=4)
+    self.assertEqual(read_counts, [len(data) for data in expected_data])
+
+    for buffer, data in zip(buffers, expected_data):
+      self.assertEqual(bytes(buffer[:len(data)]), data)
+
+    vslvm_handle.close()
+
+  def test_read_buffers_at_offsets_file_objects(self):
+    """Tests reading logical volumes in parallel from Python file objects."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    if not os.path.isfile(test_source):
+      raise unittest.SkipTest("source not a regular file")
+
+    vslvm_handle = pyvslvm.handle()
+
+    logical_volumes = self._GetLogicalVolumes(vslvm_handle, test_source)
+    if not logical_volumes:
+      raise unittest.SkipTest("missing logical volumes")
+
+    read_requests = []
+    expected_data = []
+    for logical_volume in logical_volumes:
+      size = logical_volume.get_size()
+      for offset in range(0, min(size, 16 * 65536), 65536):
+        read_requests.append((logical_volume.get_name(), offset, 4096))
+        expected_data.append(
+            logical_volume.read_buffer_at_offset(4096, offset))
+
+    vslvm_handle.close()
+
+    with open(test_source, "rb") as file_object:
+      # Use an in-memory copy so that the data is read using the Python
+      # methods of the file object instead of its file descriptor.
+      bytes_io_object = io.BytesIO(file_object.read())
+
+    vslvm_handle.open(test_source)
+    vslvm_handle.open_physical_volume_files_as_file_objects([bytes_io_object])
+
+    volume_group = vslvm_handle.get_volume_group()
+    logical_volumes_by_name = {
+        logical_volume.get_name(): logical_volume
+        for logical_volume in volume_group.logical_volumes}
+
+    read_requests = [
+        (logical_volumes_by_name[name], offset, read_size)
+        for name, offset, read_size in read_requests]
+
+    data = pyvslvm.read_buffers_at_offsets(read_requests, number_of_threads=8)
+    self.assertEqual(data, expected_data)
+
+    vslvm_handle.close()
+
+
+if __name__ == "__main__":
+  argument_parser = argparse.ArgumentParser()
+
+  argument_parser.add_argument(
+      "source", nargs="?", action="store", metavar="PATH",
+      default=None, help="path of the source file.")
+
+  options, unknown_options = argument_parser.parse_known_args()
+  unknown_options.insert(0, sys.argv[0])
+
+  setattr(unittest, "source", options.source)
+
+  unittest.main(argv=unknown_options, verbosity=2)
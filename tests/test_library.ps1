@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "checksum chunk_data data_area_descriptor error io_handle logical_volume logical_volume_values metadata metadata_area notify physical_volume raw_location_descriptor segment stripe volume_group"
+$LibraryTests = "checksum chunk_data chunk_data_pool data_area_descriptor error extent_run io_handle logical_volume logical_volume_values metadata metadata_area notify physical_volume raw_location_descriptor segment string_index stripe volume_group"
 $LibraryTestsWithInput = "handle support"
 $OptionSets = "" -split " "
 
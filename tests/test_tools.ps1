@@ -1,6 +1,6 @@
 # Tests tools functions and types.
 
-$ToolsTests = "info_handle output signal"
+$ToolsTests = "bench_handle export_handle info_handle output signal"
 $OptionSets = "" -split " "
 
 . .\test_functions.ps1
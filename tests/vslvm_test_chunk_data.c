@@ -34,6 +34,7 @@
 #include "vslvm_test_unused.h"
 
 #include "../libvslvm/libvslvm_chunk_data.h"
+#include "../libvslvm/libvslvm_definitions.h"
 
 #if defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT )
 
@@ -73,6 +74,11 @@ int vslvm_test_chunk_data_initialize(
 	 "error",
 	 error );
 
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "data alignment",
+	 (int) ( (intptr_t) chunk_data->data % LIBVSLVM_CHUNK_DATA_ALIGNMENT ),
+	 0 );
+
 	result = libvslvm_chunk_data_free(
 	          &chunk_data,
 	          &error );
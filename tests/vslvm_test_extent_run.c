@@ -0,0 +1,365 @@
+/*
+ * Library extent_run type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vslvm_test_libcerror.h"
+#include "vslvm_test_libvslvm.h"
+#include "vslvm_test_macros.h"
+#include "vslvm_test_memory.h"
+#include "vslvm_test_unused.h"
+
+#include "../libvslvm/libvslvm_extent_run.h"
+
+#if defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT )
+
+/* Tests the libvslvm_extent_run_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_extent_run_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libvslvm_extent_run_t *extent_run = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_VSLVM_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 1;
+	int number_of_memset_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libvslvm_extent_run_initialize(
+	          &extent_run,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_run",
+	 extent_run );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_extent_run_free(
+	          &extent_run,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "extent_run",
+	 extent_run );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvslvm_extent_run_initialize(
+	          NULL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	extent_run = (libvslvm_extent_run_t *) 0x12345678UL;
+
+	result = libvslvm_extent_run_initialize(
+	          &extent_run,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	extent_run = NULL;
+
+#if defined( HAVE_VSLVM_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libvslvm_extent_run_initialize with malloc failing
+		 */
+		vslvm_test_malloc_attempts_before_fail = test_number;
+
+		result = libvslvm_extent_run_initialize(
+		          &extent_run,
+		          &error );
+
+		if( vslvm_test_malloc_attempts_before_fail != -1 )
+		{
+			vslvm_test_malloc_attempts_before_fail = -1;
+
+			if( extent_run != NULL )
+			{
+				libvslvm_extent_run_free(
+				 &extent_run,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSLVM_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSLVM_TEST_ASSERT_IS_NULL(
+			 "extent_run",
+			 extent_run );
+
+			VSLVM_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libvslvm_extent_run_initialize with memset failing
+		 */
+		vslvm_test_memset_attempts_before_fail = test_number;
+
+		result = libvslvm_extent_run_initialize(
+		          &extent_run,
+		          &error );
+
+		if( vslvm_test_memset_attempts_before_fail != -1 )
+		{
+			vslvm_test_memset_attempts_before_fail = -1;
+
+			if( extent_run != NULL )
+			{
+				libvslvm_extent_run_free(
+				 &extent_run,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSLVM_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSLVM_TEST_ASSERT_IS_NULL(
+			 "extent_run",
+			 extent_run );
+
+			VSLVM_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_VSLVM_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_run != NULL )
+	{
+		libvslvm_extent_run_free(
+		 &extent_run,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_extent_run_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_extent_run_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libvslvm_extent_run_free(
+	          NULL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_extent_run_compare_references_by_physical_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_extent_run_compare_references_by_physical_offset(
+     void )
+{
+	libvslvm_extent_run_t first_extent_run;
+	libvslvm_extent_run_t second_extent_run;
+
+	libvslvm_extent_run_t *first_extent_run_reference  = NULL;
+	libvslvm_extent_run_t *second_extent_run_reference = NULL;
+	int result                                         = 0;
+
+	first_extent_run.physical_offset  = 0x00100000;
+	second_extent_run.physical_offset = 0x00500000;
+
+	first_extent_run_reference  = &first_extent_run;
+	second_extent_run_reference = &second_extent_run;
+
+	/* Test regular cases
+	 */
+	result = libvslvm_extent_run_compare_references_by_physical_offset(
+	          &first_extent_run_reference,
+	          &second_extent_run_reference );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libvslvm_extent_run_compare_references_by_physical_offset(
+	          &second_extent_run_reference,
+	          &first_extent_run_reference );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libvslvm_extent_run_compare_references_by_physical_offset(
+	          &first_extent_run_reference,
+	          &first_extent_run_reference );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSLVM_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSLVM_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSLVM_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSLVM_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSLVM_TEST_UNREFERENCED_PARAMETER( argc )
+	VSLVM_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT )
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_extent_run_initialize",
+	 vslvm_test_extent_run_initialize );
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_extent_run_free",
+	 vslvm_test_extent_run_free );
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_extent_run_compare_references_by_physical_offset",
+	 vslvm_test_extent_run_compare_references_by_physical_offset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
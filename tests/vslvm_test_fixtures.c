@@ -0,0 +1,514 @@
+/*
+ * Fixtures for testing
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "vslvm_test_fixtures.h"
+#include "vslvm_test_libbfio.h"
+#include "vslvm_test_libcerror.h"
+#include "vslvm_test_libvslvm.h"
+
+#if defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT )
+
+#include "../libvslvm/libvslvm_data_area_descriptor.h"
+#include "../libvslvm/libvslvm_handle.h"
+#include "../libvslvm/libvslvm_io_handle.h"
+#include "../libvslvm/libvslvm_logical_volume_values.h"
+#include "../libvslvm/libvslvm_physical_volume.h"
+#include "../libvslvm/libvslvm_segment.h"
+#include "../libvslvm/libvslvm_stripe.h"
+#include "../libvslvm/libvslvm_volume_group.h"
+
+/* Appends a segment to logical volume values for testing
+ * Every stripe of the segment is stored on the physical volume "pv0"
+ * Returns 1 if successful or -1 on error
+ */
+int vslvm_test_append_segment(
+     libvslvm_logical_volume_values_t *logical_volume_values,
+     off64_t segment_offset,
+     size64_t segment_size,
+     const uint64_t *stripe_data_area_offsets,
+     int number_of_stripes,
+     libcerror_error_t **error )
+{
+	libvslvm_segment_t *segment = NULL;
+	libvslvm_stripe_t *stripe   = NULL;
+	int stripe_index            = 0;
+
+	if( stripe_data_area_offsets == NULL )
+	{
+		return( -1 );
+	}
+	if( libvslvm_segment_initialize(
+	     &segment,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	( (libvslvm_internal_segment_t *) segment )->offset = segment_offset;
+	( (libvslvm_internal_segment_t *) segment )->size   = segment_size;
+
+	for( stripe_index = 0;
+	     stripe_index < number_of_stripes;
+	     stripe_index++ )
+	{
+		if( libvslvm_stripe_initialize(
+		     &stripe,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libvslvm_internal_stripe_set_physical_volume_name(
+		     (libvslvm_internal_stripe_t *) stripe,
+		     "pv0",
+		     4,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libvslvm_stripe_set_data_area_offset(
+		     stripe,
+		     (off64_t) stripe_data_area_offsets[ stripe_index ],
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libvslvm_segment_append_stripe(
+		     segment,
+		     stripe,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		stripe = NULL;
+	}
+	if( libvslvm_logical_volume_values_append_segment(
+	     logical_volume_values,
+	     segment,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( stripe != NULL )
+	{
+		libvslvm_internal_stripe_free(
+		 (libvslvm_internal_stripe_t **) &stripe,
+		 NULL );
+	}
+	if( segment != NULL )
+	{
+		libvslvm_internal_segment_free(
+		 (libvslvm_internal_segment_t **) &segment,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates a volume group for testing
+ * The volume group has an extent size of 32 KiB and contains the physical volume "pv0"
+ * of 512 KiB with 2 data areas, of which the second data area extends to the end
+ * of the physical volume
+ *
+ * The volume group contains the logical volume "lv0" with 3 segments:
+ * * data area offset 0x00010000 maps onto physical volume offset 0x00020000
+ * * data area offset 0x00020000 maps onto physical volume offset 0x00030000
+ * * data area offset 0x00048000 maps onto physical volume offset 0x00068000,
+ *   in the second data area
+ *
+ * and the logical volume "lv1" with 1 segment of 2 stripes:
+ * * data area offset 0x00030000 maps onto physical volume offset 0x00040000
+ * * data area offset 0x00038000 maps onto physical volume offset 0x00048000
+ *
+ * The logical volume values of "lv0" are returned and are owned by the volume group
+ * Returns 1 if successful or -1 on error
+ */
+int vslvm_test_create_volume_group(
+     libvslvm_volume_group_t **volume_group,
+     libvslvm_logical_volume_values_t **logical_volume_values,
+     libcerror_error_t **error )
+{
+	const char *logical_volume_identifiers[ 2 ] = {
+		"lv0aaa-aaaa-aaaa-aaaa-aaaa-aaaa-aaaaaa",
+		"lv1bbb-bbbb-bbbb-bbbb-bbbb-bbbb-bbbbbb" };
+
+	const char *logical_volume_names[ 2 ] = {
+		"lv0",
+		"lv1" };
+
+	uint64_t data_area_values[ 2 ][ 3 ] = {
+		{ 0x00010000UL, 0x00040000UL, 0 },
+		{ 0x00060000UL, 0, 0x00040000UL } };
+
+	/* The logical volume index, segment offset, segment size and number of stripes
+	 */
+	uint64_t segment_values[ 4 ][ 4 ] = {
+		{ 0, 0, 0x00010000UL, 1 },
+		{ 0, 0x00010000UL, 0x00010000UL, 1 },
+		{ 0, 0x00020000UL, 0x00010000UL, 1 },
+		{ 1, 0, 0x00010000UL, 2 } };
+
+	/* The data area offsets of the stripes of the segments
+	 */
+	uint64_t stripe_values[ 5 ] = {
+		0x00010000UL,
+		0x00020000UL,
+		0x00048000UL,
+		0x00030000UL,
+		0x00038000UL };
+
+	libvslvm_data_area_descriptor_t *data_area_descriptor         = NULL;
+	libvslvm_logical_volume_values_t *safe_logical_volume_values  = NULL;
+	libvslvm_logical_volume_values_t *first_logical_volume_values = NULL;
+	libvslvm_physical_volume_t *physical_volume                   = NULL;
+	libvslvm_volume_group_t *safe_volume_group                    = NULL;
+	int entry_index                                               = 0;
+	int logical_volume_index                                      = 0;
+	int segment_index                                             = 0;
+	int stripe_values_index                                       = 0;
+	int value_index                                               = 0;
+
+	if( volume_group == NULL )
+	{
+		return( -1 );
+	}
+	if( logical_volume_values == NULL )
+	{
+		return( -1 );
+	}
+	if( libvslvm_volume_group_initialize(
+	     &safe_volume_group,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	( (libvslvm_internal_volume_group_t *) safe_volume_group )->extent_size = 0x00008000UL;
+
+	if( libvslvm_physical_volume_initialize(
+	     &physical_volume,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libvslvm_physical_volume_set_name(
+	     physical_volume,
+	     "pv0",
+	     4,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	( (libvslvm_internal_physical_volume_t *) physical_volume )->size = VSLVM_TEST_PHYSICAL_VOLUME_DATA_SIZE;
+
+	for( value_index = 0;
+	     value_index < 2;
+	     value_index++ )
+	{
+		if( libvslvm_data_area_descriptor_initialize(
+		     &data_area_descriptor,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libvslvm_data_area_descriptor_set(
+		     data_area_descriptor,
+		     (off64_t) data_area_values[ value_index ][ 0 ],
+		     (size64_t) data_area_values[ value_index ][ 1 ],
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		data_area_descriptor->data_offset = data_area_values[ value_index ][ 2 ];
+
+		if( libcdata_array_append_entry(
+		     ( (libvslvm_internal_physical_volume_t *) physical_volume )->data_area_descriptors_array,
+		     &entry_index,
+		     (intptr_t *) data_area_descriptor,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		data_area_descriptor = NULL;
+	}
+	if( libvslvm_volume_group_append_physical_volume(
+	     safe_volume_group,
+	     physical_volume,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	physical_volume = NULL;
+
+	for( logical_volume_index = 0;
+	     logical_volume_index < 2;
+	     logical_volume_index++ )
+	{
+		if( libvslvm_logical_volume_values_initialize(
+		     &safe_logical_volume_values,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libvslvm_logical_volume_values_set_name(
+		     safe_logical_volume_values,
+		     logical_volume_names[ logical_volume_index ],
+		     4,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libvslvm_logical_volume_values_set_identifier(
+		     safe_logical_volume_values,
+		     logical_volume_identifiers[ logical_volume_index ],
+		     39,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		for( segment_index = 0;
+		     segment_index < 4;
+		     segment_index++ )
+		{
+			if( segment_values[ segment_index ][ 0 ] != (uint64_t) logical_volume_index )
+			{
+				continue;
+			}
+			if( vslvm_test_append_segment(
+			     safe_logical_volume_values,
+			     (off64_t) segment_values[ segment_index ][ 1 ],
+			     (size64_t) segment_values[ segment_index ][ 2 ],
+			     &( stripe_values[ stripe_values_index ] ),
+			     (int) segment_values[ segment_index ][ 3 ],
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			stripe_values_index += (int) segment_values[ segment_index ][ 3 ];
+		}
+		if( libvslvm_volume_group_append_logical_volume(
+		     safe_volume_group,
+		     safe_logical_volume_values,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( logical_volume_index == 0 )
+		{
+			first_logical_volume_values = safe_logical_volume_values;
+		}
+		safe_logical_volume_values = NULL;
+	}
+	*volume_group          = safe_volume_group;
+	*logical_volume_values = first_logical_volume_values;
+
+	return( 1 );
+
+on_error:
+	if( safe_logical_volume_values != NULL )
+	{
+		libvslvm_logical_volume_values_free(
+		 &safe_logical_volume_values,
+		 NULL );
+	}
+	if( data_area_descriptor != NULL )
+	{
+		libvslvm_data_area_descriptor_free(
+		 &data_area_descriptor,
+		 NULL );
+	}
+	if( physical_volume != NULL )
+	{
+		libvslvm_internal_physical_volume_free(
+		 (libvslvm_internal_physical_volume_t **) &physical_volume,
+		 NULL );
+	}
+	if( safe_volume_group != NULL )
+	{
+		libvslvm_internal_volume_group_free(
+		 (libvslvm_internal_volume_group_t **) &safe_volume_group,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens the volume group for testing
+ * The physical volume data contains the 4 KiB block number in every byte
+ * The allocation tables of the physical volume are built as they would be on open
+ * The data is freed by the caller after the file IO pool
+ * Returns 1 if successful or -1 on error
+ */
+int vslvm_test_open_volume_group(
+     libvslvm_volume_group_t *volume_group,
+     libvslvm_io_handle_t **io_handle,
+     libbfio_pool_t **file_io_pool,
+     uint8_t **data,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle      = NULL;
+	libbfio_pool_t *safe_file_io_pool     = NULL;
+	libvslvm_handle_t *handle             = NULL;
+	libvslvm_io_handle_t *safe_io_handle  = NULL;
+	uint8_t *safe_data                    = NULL;
+	size_t data_index                     = 0;
+
+	if( volume_group == NULL )
+	{
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		return( -1 );
+	}
+	if( file_io_pool == NULL )
+	{
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		return( -1 );
+	}
+	safe_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * VSLVM_TEST_PHYSICAL_VOLUME_DATA_SIZE );
+
+	if( safe_data == NULL )
+	{
+		goto on_error;
+	}
+	for( data_index = 0;
+	     data_index < VSLVM_TEST_PHYSICAL_VOLUME_DATA_SIZE;
+	     data_index++ )
+	{
+		safe_data[ data_index ] = (uint8_t) ( data_index >> 12 );
+	}
+	if( libvslvm_io_handle_initialize(
+	     &safe_io_handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libbfio_memory_range_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     file_io_handle,
+	     safe_data,
+	     VSLVM_TEST_PHYSICAL_VOLUME_DATA_SIZE,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libbfio_pool_initialize(
+	     &safe_file_io_pool,
+	     1,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libbfio_pool_set_handle(
+	     safe_file_io_pool,
+	     0,
+	     file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The file IO handle is freed by the file IO pool
+	 */
+	file_io_handle = NULL;
+
+	if( libvslvm_volume_group_set_io_values(
+	     volume_group,
+	     safe_io_handle,
+	     safe_file_io_pool,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libvslvm_handle_initialize(
+	     &handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libvslvm_internal_handle_open_build_allocation_tables(
+	     (libvslvm_internal_handle_t *) handle,
+	     volume_group,
+	     safe_file_io_pool,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libvslvm_handle_free(
+	     &handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	*io_handle    = safe_io_handle;
+	*file_io_pool = safe_file_io_pool;
+	*data         = safe_data;
+
+	return( 1 );
+
+on_error:
+	if( handle != NULL )
+	{
+		libvslvm_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( safe_file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &safe_file_io_pool,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( safe_io_handle != NULL )
+	{
+		libvslvm_io_handle_free(
+		 &safe_io_handle,
+		 NULL );
+	}
+	if( safe_data != NULL )
+	{
+		memory_free(
+		 safe_data );
+	}
+	return( -1 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT ) */
+
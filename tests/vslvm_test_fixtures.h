@@ -0,0 +1,72 @@
+/*
+ * Fixtures for testing
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _VSLVM_TEST_FIXTURES_H )
+#define _VSLVM_TEST_FIXTURES_H
+
+#include <common.h>
+#include <types.h>
+
+#include "vslvm_test_libbfio.h"
+#include "vslvm_test_libcerror.h"
+#include "vslvm_test_libvslvm.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT )
+
+#include "../libvslvm/libvslvm_io_handle.h"
+#include "../libvslvm/libvslvm_logical_volume_values.h"
+
+/* The size of the physical volume data of the test volume group
+ */
+#define VSLVM_TEST_PHYSICAL_VOLUME_DATA_SIZE	0x00080000UL
+
+int vslvm_test_append_segment(
+     libvslvm_logical_volume_values_t *logical_volume_values,
+     off64_t segment_offset,
+     size64_t segment_size,
+     const uint64_t *stripe_data_area_offsets,
+     int number_of_stripes,
+     libcerror_error_t **error );
+
+int vslvm_test_create_volume_group(
+     libvslvm_volume_group_t **volume_group,
+     libvslvm_logical_volume_values_t **logical_volume_values,
+     libcerror_error_t **error );
+
+int vslvm_test_open_volume_group(
+     libvslvm_volume_group_t *volume_group,
+     libvslvm_io_handle_t **io_handle,
+     libbfio_pool_t **file_io_pool,
+     uint8_t **data,
+     libcerror_error_t **error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _VSLVM_TEST_FIXTURES_H ) */
+
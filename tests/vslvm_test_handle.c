@@ -1286,6 +1286,75 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libvslvm_handle_set_wipe_chunk_data function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_handle_set_wipe_chunk_data(
+     libvslvm_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libvslvm_handle_set_wipe_chunk_data(
+	          handle,
+	          0,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_handle_set_wipe_chunk_data(
+	          handle,
+	          1,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvslvm_handle_set_wipe_chunk_data(
+	          NULL,
+	          0,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libvslvm_handle_get_volume_group function
  * Returns 1 if successful or 0 if not
  */
@@ -1509,6 +1578,11 @@ int main(
 		 vslvm_test_handle_signal_abort,
 		 handle );
 
+		VSLVM_TEST_RUN_WITH_ARGS(
+		 "libvslvm_handle_set_wipe_chunk_data",
+		 vslvm_test_handle_set_wipe_chunk_data,
+		 handle );
+
 		/* TODO: add tests for libvslvm_handle_open_physical_volume_files */
 
 		/* TODO: add tests for libvslvm_handle_open_physical_volume_files_wide */
@@ -21,32 +21,2864 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "vslvm_test_fixtures.h"
+#include "vslvm_test_libbfio.h"
 #include "vslvm_test_libcerror.h"
 #include "vslvm_test_libvslvm.h"
 #include "vslvm_test_macros.h"
 #include "vslvm_test_memory.h"
 #include "vslvm_test_unused.h"
 
+#include "../libvslvm/libvslvm_data_area_descriptor.h"
+#include "../libvslvm/libvslvm_extent_run.h"
+#include "../libvslvm/libvslvm_io_handle.h"
 #include "../libvslvm/libvslvm_logical_volume.h"
+#include "../libvslvm/libvslvm_logical_volume_values.h"
+#include "../libvslvm/libvslvm_physical_volume.h"
+#include "../libvslvm/libvslvm_volume_group.h"
+
+#if defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT )
+
+/* Tests the libvslvm_logical_volume_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_logical_volume_initialize(
+     void )
+{
+	uint64_t linear_stripe_values[ 2 ] = {
+		0x00010000UL, 0x00020000UL };
+
+	libcerror_error_t *error                                       = NULL;
+	libvslvm_extent_run_t *extent_run                              = NULL;
+	libvslvm_logical_volume_t *logical_volume                      = NULL;
+	libvslvm_logical_volume_values_t *linear_logical_volume_values = NULL;
+	libvslvm_logical_volume_values_t *logical_volume_values        = NULL;
+	libvslvm_physical_volume_t *physical_volume                    = NULL;
+	libvslvm_volume_group_t *volume_group                          = NULL;
+	int extent_run_index                                           = 0;
+	int number_of_extent_runs                                      = 0;
+	int result                                                     = 0;
+	int segment_index                                              = 0;
+
+	/* Initialize test
+	 */
+	result = vslvm_test_create_volume_group(
+	          &volume_group,
+	          &logical_volume_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvslvm_logical_volume_initialize(
+	          &logical_volume,
+	          NULL,
+	          volume_group,
+	          NULL,
+	          logical_volume_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The logical volume data is stored in 2 extent runs and is read
+	 * using the chunks vector and cache
+	 */
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "is_linear",
+	 (int) ( (libvslvm_internal_logical_volume_t *) logical_volume )->is_linear,
+	 0 );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 ( (libvslvm_internal_logical_volume_t *) logical_volume )->size,
+	 (uint64_t) 0x00030000UL );
+
+	/* The first 2 segments are contiguous in the first data area
+	 * and are stored as a single extent run
+	 */
+	result = libcdata_array_get_number_of_entries(
+	          ( (libvslvm_internal_logical_volume_t *) logical_volume )->extent_runs_array,
+	          &number_of_extent_runs,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extent_runs",
+	 number_of_extent_runs,
+	 2 );
+
+	/* Test an offset in the first data area
+	 */
+	result = libvslvm_internal_logical_volume_get_extent_run_at_offset(
+	          (libvslvm_internal_logical_volume_t *) logical_volume,
+	          0x00018000,
+	          &extent_run_index,
+	          &extent_run,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_run",
+	 extent_run );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "extent_run_index",
+	 extent_run_index,
+	 0 );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "extent_run->logical_offset",
+	 (uint64_t) extent_run->logical_offset,
+	 (uint64_t) 0 );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "extent_run->size",
+	 extent_run->size,
+	 (uint64_t) 0x00020000UL );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "extent_run->physical_volume_index",
+	 extent_run->physical_volume_index,
+	 0 );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "extent_run->physical_offset",
+	 (uint64_t) extent_run->physical_offset,
+	 (uint64_t) 0x00020000UL );
+
+	extent_run = NULL;
+
+	/* Test an offset in the second data area, that follows a data area of size 0,
+	 * the data area offset 0x00048000 is 0x00008000 into the second data area
+	 */
+	result = libvslvm_internal_logical_volume_get_extent_run_at_offset(
+	          (libvslvm_internal_logical_volume_t *) logical_volume,
+	          0x00028000,
+	          &extent_run_index,
+	          &extent_run,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_run",
+	 extent_run );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "extent_run_index",
+	 extent_run_index,
+	 1 );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "extent_run->logical_offset",
+	 (uint64_t) extent_run->logical_offset,
+	 (uint64_t) 0x00020000UL );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "extent_run->size",
+	 extent_run->size,
+	 (uint64_t) 0x00010000UL );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "extent_run->physical_volume_index",
+	 extent_run->physical_volume_index,
+	 0 );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "extent_run->physical_offset",
+	 (uint64_t) extent_run->physical_offset,
+	 (uint64_t) 0x00068000UL );
+
+	extent_run = NULL;
+
+	result = libvslvm_logical_volume_free(
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a logical volume with segments that are stored contiguously
+	 * on the same physical volume, which is read directly from the physical volume
+	 */
+	result = libvslvm_logical_volume_values_initialize(
+	          &linear_logical_volume_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( segment_index = 0;
+	     segment_index < 2;
+	     segment_index++ )
+	{
+		result = vslvm_test_append_segment(
+		          linear_logical_volume_values,
+		          (off64_t) ( segment_index * 0x00010000UL ),
+		          (size64_t) 0x00010000UL,
+		          &( linear_stripe_values[ segment_index ] ),
+		          1,
+		          &error );
+
+		VSLVM_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSLVM_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libvslvm_logical_volume_initialize(
+	          &logical_volume,
+	          NULL,
+	          volume_group,
+	          NULL,
+	          linear_logical_volume_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "is_linear",
+	 (int) ( (libvslvm_internal_logical_volume_t *) logical_volume )->is_linear,
+	 1 );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 ( (libvslvm_internal_logical_volume_t *) logical_volume )->size,
+	 (uint64_t) 0x00020000UL );
+
+	result = libvslvm_logical_volume_free(
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_logical_volume_values_free(
+	          &linear_logical_volume_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvslvm_logical_volume_initialize(
+	          NULL,
+	          NULL,
+	          volume_group,
+	          NULL,
+	          logical_volume_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	logical_volume = (libvslvm_logical_volume_t *) 0x12345678UL;
+
+	result = libvslvm_logical_volume_initialize(
+	          &logical_volume,
+	          NULL,
+	          volume_group,
+	          NULL,
+	          logical_volume_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	logical_volume = NULL;
+
+	result = libvslvm_logical_volume_initialize(
+	          &logical_volume,
+	          NULL,
+	          volume_group,
+	          NULL,
+	          NULL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a stripe data area offset that is not in a data area of the physical volume
+	 */
+	result = libvslvm_volume_group_get_physical_volume(
+	          volume_group,
+	          0,
+	          &physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_empty(
+	          ( (libvslvm_internal_physical_volume_t *) physical_volume )->data_area_descriptors_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libvslvm_data_area_descriptor_free,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_logical_volume_initialize(
+	          &logical_volume,
+	          NULL,
+	          volume_group,
+	          NULL,
+	          logical_volume_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvslvm_internal_volume_group_free(
+	          (libvslvm_internal_volume_group_t **) &volume_group,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( logical_volume != NULL )
+	{
+		libvslvm_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( linear_logical_volume_values != NULL )
+	{
+		libvslvm_logical_volume_values_free(
+		 &linear_logical_volume_values,
+		 NULL );
+	}
+	if( volume_group != NULL )
+	{
+		libvslvm_internal_volume_group_free(
+		 (libvslvm_internal_volume_group_t **) &volume_group,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT ) */
 
 /* Tests the libvslvm_logical_volume_free function
  * Returns 1 if successful or 0 if not
  */
-int vslvm_test_logical_volume_free(
+int vslvm_test_logical_volume_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libvslvm_logical_volume_free(
+	          NULL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT )
+
+/* Tests the libvslvm_logical_volume_get_chunk_cache_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_logical_volume_get_chunk_cache_statistics(
+     void )
+{
+	uint8_t buffer[ 4096 ];
+
+	libbfio_handle_t *file_io_handle                        = NULL;
+	libbfio_pool_t *file_io_pool                            = NULL;
+	libcerror_error_t *error                                = NULL;
+	libvslvm_io_handle_t *io_handle                         = NULL;
+	libvslvm_logical_volume_t *logical_volume               = NULL;
+	libvslvm_logical_volume_values_t *logical_volume_values = NULL;
+	libvslvm_volume_group_t *volume_group                   = NULL;
+	uint8_t *data                                           = NULL;
+	uint64_t number_of_hits                                 = 0;
+	uint64_t number_of_misses                               = 0;
+	ssize_t read_count                                      = 0;
+	size_t data_index                                       = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 * The physical volume data contains the 4 KiB block number in every byte
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * 0x00080000UL );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	for( data_index = 0;
+	     data_index < 0x00080000UL;
+	     data_index++ )
+	{
+		data[ data_index ] = (uint8_t) ( data_index >> 12 );
+	}
+	result = libvslvm_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_initialize(
+	          &file_io_handle,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          file_io_handle,
+	          data,
+	          0x00080000UL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_initialize(
+	          &file_io_pool,
+	          1,
+	          0,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_set_handle(
+	          file_io_pool,
+	          0,
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The file IO handle is freed by the file IO pool
+	 */
+	file_io_handle = NULL;
+
+	result = vslvm_test_create_volume_group(
+	          &volume_group,
+	          &logical_volume_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_volume_group_set_io_values(
+	          volume_group,
+	          io_handle,
+	          file_io_pool,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_volume_group_get_logical_volume(
+	          volume_group,
+	          0,
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvslvm_logical_volume_get_chunk_cache_statistics(
+	          logical_volume,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 0 );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 0 );
+
+	/* Test a read of a chunk that is not cached
+	 */
+	read_count = libvslvm_logical_volume_read_buffer_at_offset(
+	              logical_volume,
+	              buffer,
+	              4096,
+	              0,
+	              &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4096 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_logical_volume_get_chunk_cache_statistics(
+	          logical_volume,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 0 );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 1 );
+
+	/* Test a read of the same chunk that is cached
+	 */
+	read_count = libvslvm_logical_volume_read_buffer_at_offset(
+	              logical_volume,
+	              buffer,
+	              4096,
+	              0x00001000,
+	              &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4096 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_logical_volume_get_chunk_cache_statistics(
+	          logical_volume,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 1 );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 1 );
+
+	/* Test a read of a chunk in the second data area that is not cached
+	 */
+	read_count = libvslvm_logical_volume_read_buffer_at_offset(
+	              logical_volume,
+	              buffer,
+	              4096,
+	              0x00028000,
+	              &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4096 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_logical_volume_get_chunk_cache_statistics(
+	          logical_volume,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 1 );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 2 );
+
+	result = memory_compare(
+	          buffer,
+	          &( data[ 0x00070000UL ] ),
+	          4096 );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libvslvm_logical_volume_get_chunk_cache_statistics(
+	          NULL,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_logical_volume_get_chunk_cache_statistics(
+	          logical_volume,
+	          NULL,
+	          &number_of_misses,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_logical_volume_get_chunk_cache_statistics(
+	          logical_volume,
+	          &number_of_hits,
+	          NULL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvslvm_logical_volume_free(
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_internal_volume_group_free(
+	          (libvslvm_internal_volume_group_t **) &volume_group,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( logical_volume != NULL )
+	{
+		libvslvm_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( volume_group != NULL )
+	{
+		libvslvm_internal_volume_group_free(
+		 (libvslvm_internal_volume_group_t **) &volume_group,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libvslvm_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_logical_volume_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_logical_volume_read_buffer_at_offset(
+     void )
+{
+	uint8_t buffer[ 0x00030000UL ];
+
+	libbfio_pool_t *file_io_pool                            = NULL;
+	libcerror_error_t *error                                = NULL;
+	libvslvm_io_handle_t *io_handle                         = NULL;
+	libvslvm_logical_volume_t *logical_volume               = NULL;
+	libvslvm_logical_volume_values_t *logical_volume_values = NULL;
+	libvslvm_volume_group_t *volume_group                   = NULL;
+	uint8_t *data                                           = NULL;
+	ssize_t read_count                                      = 0;
+	int iterator                                            = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = vslvm_test_create_volume_group(
+	          &volume_group,
+	          &logical_volume_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vslvm_test_open_volume_group(
+	          volume_group,
+	          &io_handle,
+	          &file_io_pool,
+	          &data,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The logical volume is read twice to test that the chunk data released
+	 * by the first logical volume is reused by the second logical volume
+	 */
+	for( iterator = 0;
+	     iterator < 2;
+	     iterator++ )
+	{
+		result = libvslvm_volume_group_get_logical_volume(
+		          volume_group,
+		          0,
+		          &logical_volume,
+		          &error );
+
+		VSLVM_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSLVM_TEST_ASSERT_IS_NOT_NULL(
+		 "logical_volume",
+		 logical_volume );
+
+		VSLVM_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		VSLVM_TEST_ASSERT_IS_NOT_NULL(
+		 "logical_volume->chunk_data_pool",
+		 ( (libvslvm_internal_logical_volume_t *) logical_volume )->chunk_data_pool );
+
+		VSLVM_TEST_ASSERT_EQUAL_INT(
+		 "number_of_free_chunk_data",
+		 io_handle->chunk_data_pool->number_of_free_chunk_data,
+		 iterator * 3 );
+
+		read_count = libvslvm_logical_volume_read_buffer_at_offset(
+		              logical_volume,
+		              buffer,
+		              0x00030000UL,
+		              0,
+		              &error );
+
+		VSLVM_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 0x00030000UL );
+
+		VSLVM_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The chunk data of the 3 chunks read is retrieved from the pool
+		 */
+		VSLVM_TEST_ASSERT_EQUAL_INT(
+		 "number_of_free_chunk_data",
+		 io_handle->chunk_data_pool->number_of_free_chunk_data,
+		 0 );
+
+		result = memory_compare(
+		          buffer,
+		          &( data[ 0x00020000UL ] ),
+		          0x00020000UL );
+
+		VSLVM_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = memory_compare(
+		          &( buffer[ 0x00020000UL ] ),
+		          &( data[ 0x00068000UL ] ),
+		          0x00010000UL );
+
+		VSLVM_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Freeing the logical volume releases the cached chunk data to the pool
+		 */
+		result = libvslvm_logical_volume_free(
+		          &logical_volume,
+		          &error );
+
+		VSLVM_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSLVM_TEST_ASSERT_IS_NULL(
+		 "logical_volume",
+		 logical_volume );
+
+		VSLVM_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		VSLVM_TEST_ASSERT_EQUAL_INT(
+		 "number_of_free_chunk_data",
+		 io_handle->chunk_data_pool->number_of_free_chunk_data,
+		 3 );
+	}
+	/* Test error cases
+	 */
+	read_count = libvslvm_logical_volume_read_buffer_at_offset(
+	              NULL,
+	              buffer,
+	              0x00030000UL,
+	              0,
+	              &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvslvm_internal_volume_group_free(
+	          (libvslvm_internal_volume_group_t **) &volume_group,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( logical_volume != NULL )
+	{
+		libvslvm_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( volume_group != NULL )
+	{
+		libvslvm_internal_volume_group_free(
+		 (libvslvm_internal_volume_group_t **) &volume_group,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libvslvm_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_logical_volume_set_physical_volume_file_io_pool function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_logical_volume_set_physical_volume_file_io_pool(
+     void )
+{
+	uint8_t buffer[ 4096 ];
+	uint8_t expected_buffer[ 4096 ];
+
+	libbfio_handle_t *file_io_handle                        = NULL;
+	libbfio_pool_t *file_io_pool                            = NULL;
+	libbfio_pool_t *separate_file_io_pool                   = NULL;
+	libcerror_error_t *error                                = NULL;
+	libvslvm_io_handle_t *io_handle                         = NULL;
+	libvslvm_logical_volume_t *logical_volume               = NULL;
+	libvslvm_logical_volume_values_t *logical_volume_values = NULL;
+	libvslvm_volume_group_t *volume_group                   = NULL;
+	uint8_t *data                                           = NULL;
+	uint8_t *separate_data                                  = NULL;
+	ssize_t read_count                                      = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = vslvm_test_create_volume_group(
+	          &volume_group,
+	          &logical_volume_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vslvm_test_open_volume_group(
+	          volume_group,
+	          &io_handle,
+	          &file_io_pool,
+	          &data,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The separate physical volume data contains different values
+	 * to determine from which file IO pool the data is read
+	 */
+	separate_data = (uint8_t *) memory_allocate(
+	                             sizeof( uint8_t ) * VSLVM_TEST_PHYSICAL_VOLUME_DATA_SIZE );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "separate_data",
+	 separate_data );
+
+	memory_set(
+	 separate_data,
+	 0xaa,
+	 sizeof( uint8_t ) * VSLVM_TEST_PHYSICAL_VOLUME_DATA_SIZE );
+
+	memory_set(
+	 expected_buffer,
+	 0xaa,
+	 4096 );
+
+	result = libbfio_memory_range_initialize(
+	          &file_io_handle,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          file_io_handle,
+	          separate_data,
+	          VSLVM_TEST_PHYSICAL_VOLUME_DATA_SIZE,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_initialize(
+	          &separate_file_io_pool,
+	          1,
+	          0,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_set_handle(
+	          separate_file_io_pool,
+	          0,
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The file IO handle is freed by the file IO pool
+	 */
+	file_io_handle = NULL;
+
+	result = libvslvm_volume_group_get_logical_volume(
+	          volume_group,
+	          0,
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The data is read from the separate file IO pool after it was set
+	 */
+	result = libvslvm_logical_volume_set_physical_volume_file_io_pool(
+	          logical_volume,
+	          separate_file_io_pool,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libvslvm_logical_volume_read_buffer_at_offset(
+	              logical_volume,
+	              buffer,
+	              4096,
+	              0,
+	              &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4096 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          expected_buffer,
+	          4096 );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libvslvm_logical_volume_set_physical_volume_file_io_pool(
+	          NULL,
+	          separate_file_io_pool,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_logical_volume_set_physical_volume_file_io_pool(
+	          logical_volume,
+	          NULL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvslvm_logical_volume_free(
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &separate_file_io_pool,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "separate_file_io_pool",
+	 separate_file_io_pool );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 separate_data );
+
+	separate_data = NULL;
+
+	result = libvslvm_internal_volume_group_free(
+	          (libvslvm_internal_volume_group_t **) &volume_group,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( logical_volume != NULL )
+	{
+		libvslvm_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( separate_file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &separate_file_io_pool,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( separate_data != NULL )
+	{
+		memory_free(
+		 separate_data );
+	}
+	if( volume_group != NULL )
+	{
+		libvslvm_internal_volume_group_free(
+		 (libvslvm_internal_volume_group_t **) &volume_group,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libvslvm_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_logical_volume_get_physical_location function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_logical_volume_get_physical_location(
+     void )
+{
+	libcerror_error_t *error                                = NULL;
+	libvslvm_logical_volume_t *logical_volume               = NULL;
+	libvslvm_logical_volume_values_t *logical_volume_values = NULL;
+	libvslvm_volume_group_t *volume_group                   = NULL;
+	off64_t physical_volume_offset                          = 0;
+	size64_t contiguous_size                                = 0;
+	int physical_volume_index                               = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = vslvm_test_create_volume_group(
+	          &volume_group,
+	          &logical_volume_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_volume_group_get_logical_volume(
+	          volume_group,
+	          0,
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvslvm_logical_volume_get_physical_location(
+	          logical_volume,
+	          0,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &contiguous_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "physical_volume_index",
+	 physical_volume_index,
+	 0 );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "physical_volume_offset",
+	 (uint64_t) physical_volume_offset,
+	 (uint64_t) 0x00020000UL );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "contiguous_size",
+	 contiguous_size,
+	 (uint64_t) 0x00020000UL );
+
+	/* Test an offset in the second segment, that is contiguous with the first segment
+	 */
+	result = libvslvm_logical_volume_get_physical_location(
+	          logical_volume,
+	          0x00018000,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &contiguous_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "physical_volume_index",
+	 physical_volume_index,
+	 0 );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "physical_volume_offset",
+	 (uint64_t) physical_volume_offset,
+	 (uint64_t) 0x00038000UL );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "contiguous_size",
+	 contiguous_size,
+	 (uint64_t) 0x00008000UL );
+
+	/* Test an offset in the third segment, that is stored in the second data area
+	 */
+	result = libvslvm_logical_volume_get_physical_location(
+	          logical_volume,
+	          0x00028000,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &contiguous_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "physical_volume_index",
+	 physical_volume_index,
+	 0 );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "physical_volume_offset",
+	 (uint64_t) physical_volume_offset,
+	 (uint64_t) 0x00070000UL );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "contiguous_size",
+	 contiguous_size,
+	 (uint64_t) 0x00008000UL );
+
+	/* Test an offset beyond the end of the logical volume
+	 */
+	result = libvslvm_logical_volume_get_physical_location(
+	          logical_volume,
+	          0x00030000,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &contiguous_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvslvm_logical_volume_get_physical_location(
+	          NULL,
+	          0,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &contiguous_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_logical_volume_get_physical_location(
+	          logical_volume,
+	          -1,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &contiguous_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_logical_volume_get_physical_location(
+	          logical_volume,
+	          0,
+	          NULL,
+	          &physical_volume_offset,
+	          &contiguous_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_logical_volume_get_physical_location(
+	          logical_volume,
+	          0,
+	          &physical_volume_index,
+	          NULL,
+	          &contiguous_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_logical_volume_get_physical_location(
+	          logical_volume,
+	          0,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          NULL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvslvm_logical_volume_free(
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_internal_volume_group_free(
+	          (libvslvm_internal_volume_group_t **) &volume_group,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( logical_volume != NULL )
+	{
+		libvslvm_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( volume_group != NULL )
+	{
+		libvslvm_internal_volume_group_free(
+		 (libvslvm_internal_volume_group_t **) &volume_group,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_logical_volume_seek_data function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_logical_volume_seek_data(
+     void )
+{
+	libcerror_error_t *error                                = NULL;
+	libvslvm_logical_volume_t *logical_volume               = NULL;
+	libvslvm_logical_volume_values_t *logical_volume_values = NULL;
+	libvslvm_volume_group_t *volume_group                   = NULL;
+	off64_t data_offset                                     = 0;
+	size64_t data_size                                      = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = vslvm_test_create_volume_group(
+	          &volume_group,
+	          &logical_volume_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_volume_group_get_logical_volume(
+	          volume_group,
+	          0,
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Append an extent run after a range of unmapped data
+	 */
+	result = libvslvm_internal_logical_volume_append_extent_run(
+	          (libvslvm_internal_logical_volume_t *) logical_volume,
+	          0x00040000,
+	          0x00010000,
+	          0,
+	          0x00070000,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The data range consists of the consecutive extent runs in both data areas
+	 */
+	result = libvslvm_logical_volume_seek_data(
+	          logical_volume,
+	          0,
+	          &data_offset,
+	          &data_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "data_offset",
+	 (uint64_t) data_offset,
+	 (uint64_t) 0 );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "data_size",
+	 data_size,
+	 (uint64_t) 0x00030000UL );
+
+	/* Test an offset in the data range
+	 */
+	result = libvslvm_logical_volume_seek_data(
+	          logical_volume,
+	          0x00028000,
+	          &data_offset,
+	          &data_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "data_offset",
+	 (uint64_t) data_offset,
+	 (uint64_t) 0x00028000UL );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "data_size",
+	 data_size,
+	 (uint64_t) 0x00008000UL );
+
+	/* Test an offset in the unmapped data
+	 */
+	result = libvslvm_logical_volume_seek_data(
+	          logical_volume,
+	          0x00030000,
+	          &data_offset,
+	          &data_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "data_offset",
+	 (uint64_t) data_offset,
+	 (uint64_t) 0x00040000UL );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "data_size",
+	 data_size,
+	 (uint64_t) 0x00010000UL );
+
+	/* Test an offset beyond the last data range
+	 */
+	result = libvslvm_logical_volume_seek_data(
+	          logical_volume,
+	          0x00050000,
+	          &data_offset,
+	          &data_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvslvm_logical_volume_seek_data(
+	          NULL,
+	          0,
+	          &data_offset,
+	          &data_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_logical_volume_seek_data(
+	          logical_volume,
+	          -1,
+	          &data_offset,
+	          &data_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_logical_volume_seek_data(
+	          logical_volume,
+	          0,
+	          NULL,
+	          &data_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_logical_volume_seek_data(
+	          logical_volume,
+	          0,
+	          &data_offset,
+	          NULL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvslvm_logical_volume_free(
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_internal_volume_group_free(
+	          (libvslvm_internal_volume_group_t **) &volume_group,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( logical_volume != NULL )
+	{
+		libvslvm_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( volume_group != NULL )
+	{
+		libvslvm_internal_volume_group_free(
+		 (libvslvm_internal_volume_group_t **) &volume_group,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_logical_volume_get_number_of_extent_runs function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_logical_volume_get_number_of_extent_runs(
+     void )
+{
+	libcerror_error_t *error                                = NULL;
+	libvslvm_logical_volume_t *logical_volume               = NULL;
+	libvslvm_logical_volume_values_t *logical_volume_values = NULL;
+	libvslvm_volume_group_t *volume_group                   = NULL;
+	int number_of_extent_runs                               = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = vslvm_test_create_volume_group(
+	          &volume_group,
+	          &logical_volume_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_volume_group_get_logical_volume(
+	          volume_group,
+	          0,
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvslvm_logical_volume_get_number_of_extent_runs(
+	          logical_volume,
+	          &number_of_extent_runs,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extent_runs",
+	 number_of_extent_runs,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libvslvm_logical_volume_get_number_of_extent_runs(
+	          NULL,
+	          &number_of_extent_runs,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_logical_volume_get_number_of_extent_runs(
+	          logical_volume,
+	          NULL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvslvm_logical_volume_free(
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_internal_volume_group_free(
+	          (libvslvm_internal_volume_group_t **) &volume_group,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( logical_volume != NULL )
+	{
+		libvslvm_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( volume_group != NULL )
+	{
+		libvslvm_internal_volume_group_free(
+		 (libvslvm_internal_volume_group_t **) &volume_group,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_logical_volume_get_extent_run_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_logical_volume_get_extent_run_by_index(
      void )
 {
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_t *error                                = NULL;
+	libvslvm_logical_volume_t *logical_volume               = NULL;
+	libvslvm_logical_volume_values_t *logical_volume_values = NULL;
+	libvslvm_volume_group_t *volume_group                   = NULL;
+	off64_t logical_offset                                  = 0;
+	off64_t physical_volume_offset                          = 0;
+	size64_t size                                           = 0;
+	uint8_t extent_run_type                                 = 0;
+	int physical_volume_index                               = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = vslvm_test_create_volume_group(
+	          &volume_group,
+	          &logical_volume_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_volume_group_get_logical_volume(
+	          volume_group,
+	          0,
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The first 2 segments are stored contiguously and are merged into the first extent run
+	 */
+	result = libvslvm_logical_volume_get_extent_run_by_index(
+	          logical_volume,
+	          0,
+	          &logical_offset,
+	          &size,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &extent_run_type,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "logical_offset",
+	 (uint64_t) logical_offset,
+	 (uint64_t) 0 );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 size,
+	 (uint64_t) 0x00020000UL );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "physical_volume_index",
+	 physical_volume_index,
+	 0 );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "physical_volume_offset",
+	 (uint64_t) physical_volume_offset,
+	 (uint64_t) 0x00020000UL );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "extent_run_type",
+	 (int) extent_run_type,
+	 LIBVSLVM_EXTENT_RUN_TYPE_LINEAR );
+
+	/* The third segment is stored in the second data area
+	 */
+	result = libvslvm_logical_volume_get_extent_run_by_index(
+	          logical_volume,
+	          1,
+	          &logical_offset,
+	          &size,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &extent_run_type,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "logical_offset",
+	 (uint64_t) logical_offset,
+	 (uint64_t) 0x00020000UL );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 size,
+	 (uint64_t) 0x00010000UL );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "physical_volume_index",
+	 physical_volume_index,
+	 0 );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "physical_volume_offset",
+	 (uint64_t) physical_volume_offset,
+	 (uint64_t) 0x00068000UL );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "extent_run_type",
+	 (int) extent_run_type,
+	 LIBVSLVM_EXTENT_RUN_TYPE_LINEAR );
 
 	/* Test error cases
 	 */
-	result = libvslvm_logical_volume_free(
+	result = libvslvm_logical_volume_get_extent_run_by_index(
+	          NULL,
+	          0,
+	          &logical_offset,
+	          &size,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &extent_run_type,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_logical_volume_get_extent_run_by_index(
+	          logical_volume,
+	          -1,
+	          &logical_offset,
+	          &size,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &extent_run_type,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_logical_volume_get_extent_run_by_index(
+	          logical_volume,
+	          2,
+	          &logical_offset,
+	          &size,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &extent_run_type,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_logical_volume_get_extent_run_by_index(
+	          logical_volume,
+	          0,
+	          NULL,
+	          &size,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &extent_run_type,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_logical_volume_get_extent_run_by_index(
+	          logical_volume,
+	          0,
+	          &logical_offset,
+	          NULL,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &extent_run_type,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_logical_volume_get_extent_run_by_index(
+	          logical_volume,
+	          0,
+	          &logical_offset,
+	          &size,
+	          NULL,
+	          &physical_volume_offset,
+	          &extent_run_type,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_logical_volume_get_extent_run_by_index(
+	          logical_volume,
+	          0,
+	          &logical_offset,
+	          &size,
+	          &physical_volume_index,
+	          NULL,
+	          &extent_run_type,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_logical_volume_get_extent_run_by_index(
+	          logical_volume,
+	          0,
+	          &logical_offset,
+	          &size,
+	          &physical_volume_index,
+	          &physical_volume_offset,
 	          NULL,
 	          &error );
 
@@ -62,6 +2894,42 @@ int vslvm_test_logical_volume_free(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	result = libvslvm_logical_volume_free(
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_internal_volume_group_free(
+	          (libvslvm_internal_volume_group_t **) &volume_group,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -70,11 +2938,21 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( logical_volume != NULL )
+	{
+		libvslvm_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( volume_group != NULL )
+	{
+		libvslvm_internal_volume_group_free(
+		 (libvslvm_internal_volume_group_t **) &volume_group,
+		 NULL );
+	}
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT )
-
 #endif /* defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT ) */
 
 /* The main program
@@ -94,7 +2972,9 @@ int main(
 
 #if defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT )
 
-	/* TODO: add tests for libvslvm_logical_volume_initialize */
+	VSLVM_TEST_RUN(
+	 "libvslvm_logical_volume_initialize",
+	 vslvm_test_logical_volume_initialize );
 
 #endif /* defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT ) */
 
@@ -106,7 +2986,9 @@ int main(
 
 	/* TODO: add tests for libvslvm_logical_volume_read_buffer */
 
-	/* TODO: add tests for libvslvm_logical_volume_read_buffer_at_offset */
+	VSLVM_TEST_RUN(
+	 "libvslvm_logical_volume_read_buffer_at_offset",
+	 vslvm_test_logical_volume_read_buffer_at_offset );
 
 	/* TODO: add tests for libvslvm_logical_volume_seek_offset */
 
@@ -114,6 +2996,30 @@ int main(
 
 	/* TODO: add tests for libvslvm_logical_volume_get_size */
 
+	VSLVM_TEST_RUN(
+	 "libvslvm_logical_volume_get_chunk_cache_statistics",
+	 vslvm_test_logical_volume_get_chunk_cache_statistics );
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_logical_volume_set_physical_volume_file_io_pool",
+	 vslvm_test_logical_volume_set_physical_volume_file_io_pool );
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_logical_volume_get_physical_location",
+	 vslvm_test_logical_volume_get_physical_location );
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_logical_volume_seek_data",
+	 vslvm_test_logical_volume_seek_data );
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_logical_volume_get_number_of_extent_runs",
+	 vslvm_test_logical_volume_get_number_of_extent_runs );
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_logical_volume_get_extent_run_by_index",
+	 vslvm_test_logical_volume_get_extent_run_by_index );
+
 	/* TODO: add tests for libvslvm_logical_volume_get_name_size */
 
 	/* TODO: add tests for libvslvm_logical_volume_get_name */
@@ -21,22 +21,39 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "vslvm_test_libbfio.h"
 #include "vslvm_test_libcerror.h"
 #include "vslvm_test_libvslvm.h"
 #include "vslvm_test_macros.h"
 #include "vslvm_test_memory.h"
 #include "vslvm_test_unused.h"
 
+#include "../libvslvm/libvslvm_data_area_descriptor.h"
 #include "../libvslvm/libvslvm_physical_volume.h"
 
 #if defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT )
 
+/* The physical volume label data without the trailing zero bytes,
+ * the checksum is not set so it is not verified
+ */
+uint8_t vslvm_test_physical_volume_label_data1[ 512 ] = {
+	0x4c, 0x41, 0x42, 0x45, 0x4c, 0x4f, 0x4e, 0x45, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x4c, 0x56, 0x4d, 0x32, 0x20, 0x30, 0x30, 0x31,
+	0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+	0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+	0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
 /* Tests the libvslvm_physical_volume_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -889,17 +906,65 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libvslvm_physical_volume_get_number_of_metadata_area_descriptors function
+/* Appends a data area descriptor to the physical volume
+ * Returns 1 if successful or -1 on error
+ */
+int vslvm_test_physical_volume_append_data_area_descriptor(
+     libvslvm_physical_volume_t *physical_volume,
+     off64_t offset,
+     size64_t size,
+     uint64_t data_offset,
+     libcerror_error_t **error )
+{
+	libvslvm_data_area_descriptor_t *data_area_descriptor = NULL;
+	int entry_index                                       = 0;
+
+	if( libvslvm_data_area_descriptor_initialize(
+	     &data_area_descriptor,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libvslvm_data_area_descriptor_set(
+	     data_area_descriptor,
+	     offset,
+	     size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	data_area_descriptor->data_offset = data_offset;
+
+	if( libcdata_array_append_entry(
+	     ( (libvslvm_internal_physical_volume_t *) physical_volume )->data_area_descriptors_array,
+	     &entry_index,
+	     (intptr_t *) data_area_descriptor,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( data_area_descriptor != NULL )
+	{
+		libvslvm_data_area_descriptor_free(
+		 &data_area_descriptor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libvslvm_physical_volume_get_data_area_descriptor_by_offset function
  * Returns 1 if successful or 0 if not
  */
-int vslvm_test_physical_volume_get_number_of_metadata_area_descriptors(
+int vslvm_test_physical_volume_get_data_area_descriptor_by_offset(
      void )
 {
-	libcerror_error_t *error                       = NULL;
-	libvslvm_physical_volume_t *physical_volume    = NULL;
-	int number_of_metadata_area_descriptors        = 0;
-	int number_of_metadata_area_descriptors_is_set = 0;
-	int result                                     = 0;
+	libcerror_error_t *error                              = NULL;
+	libvslvm_data_area_descriptor_t *data_area_descriptor = NULL;
+	libvslvm_physical_volume_t *physical_volume           = NULL;
+	int result                                            = 0;
 
 	/* Initialize test
 	 */
@@ -920,66 +985,121 @@ int vslvm_test_physical_volume_get_number_of_metadata_area_descriptors(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	/* Test an offset without data area descriptors
 	 */
-	result = libvslvm_physical_volume_get_number_of_metadata_area_descriptors(
+	result = libvslvm_physical_volume_get_data_area_descriptor_by_offset(
 	          physical_volume,
-	          &number_of_metadata_area_descriptors,
+	          0,
+	          &data_area_descriptor,
 	          &error );
 
-	VSLVM_TEST_ASSERT_NOT_EQUAL_INT(
+	VSLVM_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
 	VSLVM_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	number_of_metadata_area_descriptors_is_set = result;
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "data_area_descriptor",
+	 data_area_descriptor );
 
-	/* Test error cases
+	result = vslvm_test_physical_volume_append_data_area_descriptor(
+	          physical_volume,
+	          0x00100000,
+	          0x00400000,
+	          0,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vslvm_test_physical_volume_append_data_area_descriptor(
+	          physical_volume,
+	          0x00600000,
+	          0x00200000,
+	          0x00400000,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an offset beyond the last data area
 	 */
-	result = libvslvm_physical_volume_get_number_of_metadata_area_descriptors(
-	          NULL,
-	          &number_of_metadata_area_descriptors,
+	result = libvslvm_physical_volume_get_data_area_descriptor_by_offset(
+	          physical_volume,
+	          0x00600000,
+	          &data_area_descriptor,
 	          &error );
 
 	VSLVM_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
-	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	VSLVM_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "data_area_descriptor",
+	 data_area_descriptor );
 
-	if( number_of_metadata_area_descriptors_is_set != 0 )
-	{
-		result = libvslvm_physical_volume_get_number_of_metadata_area_descriptors(
-		          physical_volume,
-		          NULL,
-		          &error );
+	/* A data area of size 0 extends to the end of the physical volume,
+	 * the data area that follows it shares its data offset
+	 */
+	result = vslvm_test_physical_volume_append_data_area_descriptor(
+	          physical_volume,
+	          0x00800000,
+	          0,
+	          0x00600000,
+	          &error );
 
-		VSLVM_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		VSLVM_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Clean up
+	result = vslvm_test_physical_volume_append_data_area_descriptor(
+	          physical_volume,
+	          0x00a00000,
+	          0x00100000,
+	          0x00600000,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
 	 */
-	result = libvslvm_internal_physical_volume_free(
-	          (libvslvm_internal_physical_volume_t **) &physical_volume,
+	result = libvslvm_physical_volume_get_data_area_descriptor_by_offset(
+	          physical_volume,
+	          0,
+	          &data_area_descriptor,
 	          &error );
 
 	VSLVM_TEST_ASSERT_EQUAL_INT(
@@ -988,106 +1108,1531 @@ int vslvm_test_physical_volume_get_number_of_metadata_area_descriptors(
 	 1 );
 
 	VSLVM_TEST_ASSERT_IS_NULL(
-	 "physical_volume",
-	 physical_volume );
+	 "error",
+	 error );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "data_area_descriptor",
+	 data_area_descriptor );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "data_area_descriptor->offset",
+	 data_area_descriptor->offset,
+	 (uint64_t) 0x00100000 );
+
+	data_area_descriptor = NULL;
+
+	result = libvslvm_physical_volume_get_data_area_descriptor_by_offset(
+	          physical_volume,
+	          0x003fffff,
+	          &data_area_descriptor,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	VSLVM_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "data_area_descriptor",
+	 data_area_descriptor );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( physical_volume != NULL )
-	{
-		libvslvm_internal_physical_volume_free(
-		 (libvslvm_internal_physical_volume_t **) &physical_volume,
-		 NULL );
-	}
-	return( 0 );
-}
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "data_area_descriptor->offset",
+	 data_area_descriptor->offset,
+	 (uint64_t) 0x00100000 );
 
-#endif /* defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT ) */
+	data_area_descriptor = NULL;
 
-/* The main program
- */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc VSLVM_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] VSLVM_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc VSLVM_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] VSLVM_TEST_ATTRIBUTE_UNUSED )
-#endif
-{
-	VSLVM_TEST_UNREFERENCED_PARAMETER( argc )
-	VSLVM_TEST_UNREFERENCED_PARAMETER( argv )
+	result = libvslvm_physical_volume_get_data_area_descriptor_by_offset(
+	          physical_volume,
+	          0x00400000,
+	          &data_area_descriptor,
+	          &error );
 
-#if defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT )
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	VSLVM_TEST_RUN(
-	 "libvslvm_physical_volume_initialize",
-	 vslvm_test_physical_volume_initialize );
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-#endif /* defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT ) */
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "data_area_descriptor",
+	 data_area_descriptor );
 
-	VSLVM_TEST_RUN(
-	 "libvslvm_physical_volume_free",
-	 vslvm_test_physical_volume_free );
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "data_area_descriptor->offset",
+	 data_area_descriptor->offset,
+	 (uint64_t) 0x00600000 );
 
-#if defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT )
+	data_area_descriptor = NULL;
 
-	VSLVM_TEST_RUN(
-	 "libvslvm_physical_volume_get_name_size",
-	 vslvm_test_physical_volume_get_name_size );
+	result = libvslvm_physical_volume_get_data_area_descriptor_by_offset(
+	          physical_volume,
+	          0x005fffff,
+	          &data_area_descriptor,
+	          &error );
 
-	/* TODO: add tests for libvslvm_physical_volume_get_name */
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	/* TODO: add tests for libvslvm_physical_volume_set_name */
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* TODO: add tests for libvslvm_physical_volume_compare_by_name */
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "data_area_descriptor",
+	 data_area_descriptor );
 
-	VSLVM_TEST_RUN(
-	 "libvslvm_physical_volume_get_identifier_size",
-	 vslvm_test_physical_volume_get_identifier_size );
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "data_area_descriptor->offset",
+	 data_area_descriptor->offset,
+	 (uint64_t) 0x00600000 );
 
-	/* TODO: add tests for libvslvm_physical_volume_get_identifier */
+	data_area_descriptor = NULL;
 
-	/* TODO: add tests for libvslvm_physical_volume_set_identifier */
+	/* Test offsets in the data area of size 0, these are found by
+	 * the second search over data areas that share the data offset
+	 */
+	result = libvslvm_physical_volume_get_data_area_descriptor_by_offset(
+	          physical_volume,
+	          0x00600000,
+	          &data_area_descriptor,
+	          &error );
 
-	VSLVM_TEST_RUN(
-	 "libvslvm_physical_volume_get_device_path_size",
-	 vslvm_test_physical_volume_get_device_path_size );
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	/* TODO: add tests for libvslvm_physical_volume_get_device_path */
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* TODO: add tests for libvslvm_physical_volume_set_device_path */
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "data_area_descriptor",
+	 data_area_descriptor );
 
-	VSLVM_TEST_RUN(
-	 "libvslvm_physical_volume_get_size",
-	 vslvm_test_physical_volume_get_size );
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "data_area_descriptor->offset",
+	 data_area_descriptor->offset,
+	 (uint64_t) 0x00800000 );
 
-	VSLVM_TEST_RUN(
-	 "libvslvm_physical_volume_get_number_of_data_area_descriptors",
-	 vslvm_test_physical_volume_get_number_of_data_area_descriptors );
+	data_area_descriptor = NULL;
 
-	/* TODO: add tests for libvslvm_physical_volume_get_data_area_descriptor */
+	result = libvslvm_physical_volume_get_data_area_descriptor_by_offset(
+	          physical_volume,
+	          0x00680000,
+	          &data_area_descriptor,
+	          &error );
 
-	/* TODO: add tests for libvslvm_physical_volume_get_data_area_descriptor_by_offset */
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	VSLVM_TEST_RUN(
-	 "libvslvm_physical_volume_get_number_of_metadata_area_descriptors",
-	 vslvm_test_physical_volume_get_number_of_metadata_area_descriptors );
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* TODO: add tests for libvslvm_physical_volume_get_metadata_area_descriptor */
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "data_area_descriptor",
+	 data_area_descriptor );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "data_area_descriptor->offset",
+	 data_area_descriptor->offset,
+	 (uint64_t) 0x00800000 );
+
+	data_area_descriptor = NULL;
+
+	result = libvslvm_physical_volume_get_data_area_descriptor_by_offset(
+	          physical_volume,
+	          0x10000000,
+	          &data_area_descriptor,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "data_area_descriptor",
+	 data_area_descriptor );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "data_area_descriptor->offset",
+	 data_area_descriptor->offset,
+	 (uint64_t) 0x00800000 );
 
-	/* TODO: add tests for libvslvm_physical_volume_read_label */
+	data_area_descriptor = NULL;
+
+	/* Test error cases
+	 */
+	result = libvslvm_physical_volume_get_data_area_descriptor_by_offset(
+	          NULL,
+	          0,
+	          &data_area_descriptor,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_physical_volume_get_data_area_descriptor_by_offset(
+	          physical_volume,
+	          0,
+	          NULL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data_area_descriptor = (libvslvm_data_area_descriptor_t *) 0x12345678UL;
+
+	result = libvslvm_physical_volume_get_data_area_descriptor_by_offset(
+	          physical_volume,
+	          0,
+	          &data_area_descriptor,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data_area_descriptor = NULL;
+
+	/* Clean up
+	 */
+	result = libvslvm_internal_physical_volume_free(
+	          (libvslvm_internal_physical_volume_t **) &physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "physical_volume",
+	 physical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( physical_volume != NULL )
+	{
+		libvslvm_internal_physical_volume_free(
+		 (libvslvm_internal_physical_volume_t **) &physical_volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_physical_volume_get_number_of_metadata_area_descriptors function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_physical_volume_get_number_of_metadata_area_descriptors(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libvslvm_physical_volume_t *physical_volume    = NULL;
+	int number_of_metadata_area_descriptors        = 0;
+	int number_of_metadata_area_descriptors_is_set = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libvslvm_physical_volume_initialize(
+	          &physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "physical_volume",
+	 physical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvslvm_physical_volume_get_number_of_metadata_area_descriptors(
+	          physical_volume,
+	          &number_of_metadata_area_descriptors,
+	          &error );
+
+	VSLVM_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_metadata_area_descriptors_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libvslvm_physical_volume_get_number_of_metadata_area_descriptors(
+	          NULL,
+	          &number_of_metadata_area_descriptors,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( number_of_metadata_area_descriptors_is_set != 0 )
+	{
+		result = libvslvm_physical_volume_get_number_of_metadata_area_descriptors(
+		          physical_volume,
+		          NULL,
+		          &error );
+
+		VSLVM_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		VSLVM_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libvslvm_internal_physical_volume_free(
+	          (libvslvm_internal_physical_volume_t **) &physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "physical_volume",
+	 physical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( physical_volume != NULL )
+	{
+		libvslvm_internal_physical_volume_free(
+		 (libvslvm_internal_physical_volume_t **) &physical_volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_physical_volume_get_logical_location function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_physical_volume_get_logical_location(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libvslvm_physical_volume_t *physical_volume = NULL;
+	off64_t logical_volume_offset               = 0;
+	size64_t contiguous_size                    = 0;
+	int logical_volume_index                    = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libvslvm_physical_volume_initialize(
+	          &physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "physical_volume",
+	 physical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_internal_physical_volume_append_allocation(
+	          (libvslvm_internal_physical_volume_t *) physical_volume,
+	          0x00500000,
+	          0x00400000,
+	          1,
+	          0x00800000,
+	          LIBVSLVM_EXTENT_RUN_TYPE_LINEAR,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_internal_physical_volume_append_allocation(
+	          (libvslvm_internal_physical_volume_t *) physical_volume,
+	          0x00100000,
+	          0x00400000,
+	          0,
+	          0,
+	          LIBVSLVM_EXTENT_RUN_TYPE_LINEAR,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_internal_physical_volume_append_allocation(
+	          (libvslvm_internal_physical_volume_t *) physical_volume,
+	          0x00a00000,
+	          0x00200000,
+	          2,
+	          0x00400000,
+	          LIBVSLVM_EXTENT_RUN_TYPE_STRIPED,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_internal_physical_volume_sort_allocations(
+	          (libvslvm_internal_physical_volume_t *) physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvslvm_physical_volume_get_logical_location(
+	          physical_volume,
+	          0x00600000,
+	          &logical_volume_index,
+	          &logical_volume_offset,
+	          &contiguous_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "logical_volume_index",
+	 logical_volume_index,
+	 1 );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT64(
+	 "logical_volume_offset",
+	 (int64_t) logical_volume_offset,
+	 (int64_t) 0x00900000 );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "contiguous_size",
+	 (uint64_t) contiguous_size,
+	 (uint64_t) 0x00300000 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_physical_volume_get_logical_location(
+	          physical_volume,
+	          0x00100000,
+	          &logical_volume_index,
+	          &logical_volume_offset,
+	          &contiguous_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "logical_volume_index",
+	 logical_volume_index,
+	 0 );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT64(
+	 "logical_volume_offset",
+	 (int64_t) logical_volume_offset,
+	 (int64_t) 0 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_physical_volume_get_logical_location(
+	          physical_volume,
+	          0x00900000,
+	          &logical_volume_index,
+	          &logical_volume_offset,
+	          &contiguous_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "contiguous_size",
+	 (uint64_t) contiguous_size,
+	 (uint64_t) 0x00100000 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_physical_volume_get_logical_location(
+	          physical_volume,
+	          0x00b00000,
+	          &logical_volume_index,
+	          &logical_volume_offset,
+	          &contiguous_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "logical_volume_index",
+	 logical_volume_index,
+	 2 );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT64(
+	 "logical_volume_offset",
+	 (int64_t) logical_volume_offset,
+	 (int64_t) -1 );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "contiguous_size",
+	 (uint64_t) contiguous_size,
+	 (uint64_t) 0x00100000 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvslvm_physical_volume_get_logical_location(
+	          NULL,
+	          0,
+	          &logical_volume_index,
+	          &logical_volume_offset,
+	          &contiguous_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_physical_volume_get_logical_location(
+	          physical_volume,
+	          -1,
+	          &logical_volume_index,
+	          &logical_volume_offset,
+	          &contiguous_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_physical_volume_get_logical_location(
+	          physical_volume,
+	          0,
+	          NULL,
+	          &logical_volume_offset,
+	          &contiguous_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvslvm_internal_physical_volume_free(
+	          (libvslvm_internal_physical_volume_t **) &physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "physical_volume",
+	 physical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( physical_volume != NULL )
+	{
+		libvslvm_internal_physical_volume_free(
+		 (libvslvm_internal_physical_volume_t **) &physical_volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_internal_physical_volume_sort_allocations function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_internal_physical_volume_sort_allocations(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libvslvm_physical_volume_t *physical_volume = NULL;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libvslvm_physical_volume_initialize(
+	          &physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "physical_volume",
+	 physical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_internal_physical_volume_append_allocation(
+	          (libvslvm_internal_physical_volume_t *) physical_volume,
+	          0x00500000,
+	          0x00400000,
+	          1,
+	          0,
+	          LIBVSLVM_EXTENT_RUN_TYPE_LINEAR,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvslvm_internal_physical_volume_sort_allocations(
+	          (libvslvm_internal_physical_volume_t *) physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvslvm_internal_physical_volume_sort_allocations(
+	          NULL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test sort with an allocation that overlaps with the end of a preceding allocation
+	 */
+	result = libvslvm_internal_physical_volume_append_allocation(
+	          (libvslvm_internal_physical_volume_t *) physical_volume,
+	          0x00100000,
+	          0x00500000,
+	          0,
+	          0,
+	          LIBVSLVM_EXTENT_RUN_TYPE_LINEAR,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_internal_physical_volume_sort_allocations(
+	          (libvslvm_internal_physical_volume_t *) physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvslvm_internal_physical_volume_free(
+	          (libvslvm_internal_physical_volume_t **) &physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "physical_volume",
+	 physical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( physical_volume != NULL )
+	{
+		libvslvm_internal_physical_volume_free(
+		 (libvslvm_internal_physical_volume_t **) &physical_volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_physical_volume_get_number_of_unallocated_extent_runs function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_physical_volume_get_number_of_unallocated_extent_runs(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libvslvm_physical_volume_t *physical_volume = NULL;
+	int number_of_extent_runs                   = 0;
+	int number_of_extent_runs_is_set            = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libvslvm_physical_volume_initialize(
+	          &physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "physical_volume",
+	 physical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvslvm_physical_volume_get_number_of_unallocated_extent_runs(
+	          physical_volume,
+	          &number_of_extent_runs,
+	          &error );
+
+	VSLVM_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_extent_runs_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libvslvm_physical_volume_get_number_of_unallocated_extent_runs(
+	          NULL,
+	          &number_of_extent_runs,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( number_of_extent_runs_is_set != 0 )
+	{
+		result = libvslvm_physical_volume_get_number_of_unallocated_extent_runs(
+		          physical_volume,
+		          NULL,
+		          &error );
+
+		VSLVM_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		VSLVM_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libvslvm_internal_physical_volume_free(
+	          (libvslvm_internal_physical_volume_t **) &physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "physical_volume",
+	 physical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( physical_volume != NULL )
+	{
+		libvslvm_internal_physical_volume_free(
+		 (libvslvm_internal_physical_volume_t **) &physical_volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_physical_volume_read_label_file_io_pool function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_physical_volume_read_label_file_io_pool(
+     void )
+{
+	uint8_t data[ 2048 ];
+
+	libbfio_handle_t *file_io_handle            = NULL;
+	libbfio_pool_t *file_io_pool                = NULL;
+	libcerror_error_t *error                    = NULL;
+	libvslvm_physical_volume_t *physical_volume = NULL;
+	int number_of_data_area_descriptors         = 0;
+	int number_of_metadata_area_descriptors     = 0;
+	int result                                  = 0;
+	int sector_index                            = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_memory_range_initialize(
+	          &file_io_handle,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          file_io_handle,
+	          data,
+	          2048,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_initialize(
+	          &file_io_pool,
+	          1,
+	          0,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_set_handle(
+	          file_io_pool,
+	          0,
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_io_handle = NULL;
+
+	/* Test regular cases with the label stored in sector 1, 2 and 3
+	 */
+	for( sector_index = 1;
+	     sector_index < 4;
+	     sector_index++ )
+	{
+		memory_set(
+		 data,
+		 0,
+		 2048 );
+
+		memory_copy(
+		 &( data[ sector_index * 512 ] ),
+		 vslvm_test_physical_volume_label_data1,
+		 512 );
+
+		result = libvslvm_physical_volume_initialize(
+		          &physical_volume,
+		          &error );
+
+		VSLVM_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSLVM_TEST_ASSERT_IS_NOT_NULL(
+		 "physical_volume",
+		 physical_volume );
+
+		VSLVM_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvslvm_physical_volume_read_label_file_io_pool(
+		          physical_volume,
+		          file_io_pool,
+		          0,
+		          0,
+		          &error );
+
+		VSLVM_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSLVM_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvslvm_physical_volume_get_number_of_data_area_descriptors(
+		          physical_volume,
+		          &number_of_data_area_descriptors,
+		          &error );
+
+		VSLVM_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSLVM_TEST_ASSERT_EQUAL_INT(
+		 "number_of_data_area_descriptors",
+		 number_of_data_area_descriptors,
+		 1 );
+
+		VSLVM_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvslvm_physical_volume_get_number_of_metadata_area_descriptors(
+		          physical_volume,
+		          &number_of_metadata_area_descriptors,
+		          &error );
+
+		VSLVM_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSLVM_TEST_ASSERT_EQUAL_INT(
+		 "number_of_metadata_area_descriptors",
+		 number_of_metadata_area_descriptors,
+		 1 );
+
+		VSLVM_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvslvm_internal_physical_volume_free(
+		          (libvslvm_internal_physical_volume_t **) &physical_volume,
+		          &error );
+
+		VSLVM_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSLVM_TEST_ASSERT_IS_NULL(
+		 "physical_volume",
+		 physical_volume );
+
+		VSLVM_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+	}
+	/* Test a short read with the label stored in the last sector that was read
+	 */
+	memory_set(
+	 data,
+	 0,
+	 2048 );
+
+	memory_copy(
+	 &( data[ 3 * 512 ] ),
+	 vslvm_test_physical_volume_label_data1,
+	 512 );
+
+	result = libvslvm_physical_volume_initialize(
+	          &physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "physical_volume",
+	 physical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_physical_volume_read_label_file_io_pool(
+	          physical_volume,
+	          file_io_pool,
+	          0,
+	          1024,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_physical_volume_get_number_of_data_area_descriptors(
+	          physical_volume,
+	          &number_of_data_area_descriptors,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "number_of_data_area_descriptors",
+	 number_of_data_area_descriptors,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_physical_volume_get_number_of_metadata_area_descriptors(
+	          physical_volume,
+	          &number_of_metadata_area_descriptors,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "number_of_metadata_area_descriptors",
+	 number_of_metadata_area_descriptors,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_internal_physical_volume_free(
+	          (libvslvm_internal_physical_volume_t **) &physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "physical_volume",
+	 physical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a short read that is smaller than a sector
+	 */
+	result = libvslvm_physical_volume_initialize(
+	          &physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "physical_volume",
+	 physical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_physical_volume_read_label_file_io_pool(
+	          physical_volume,
+	          file_io_pool,
+	          0,
+	          1792,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test without a label
+	 */
+	memory_set(
+	 data,
+	 0,
+	 2048 );
+
+	result = libvslvm_physical_volume_read_label_file_io_pool(
+	          physical_volume,
+	          file_io_pool,
+	          0,
+	          0,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvslvm_physical_volume_read_label_file_io_pool(
+	          NULL,
+	          file_io_pool,
+	          0,
+	          0,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_physical_volume_read_label_file_io_pool(
+	          physical_volume,
+	          NULL,
+	          0,
+	          0,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvslvm_internal_physical_volume_free(
+	          (libvslvm_internal_physical_volume_t **) &physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "physical_volume",
+	 physical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( physical_volume != NULL )
+	{
+		libvslvm_internal_physical_volume_free(
+		 (libvslvm_internal_physical_volume_t **) &physical_volume,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSLVM_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSLVM_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSLVM_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSLVM_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSLVM_TEST_UNREFERENCED_PARAMETER( argc )
+	VSLVM_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT )
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_physical_volume_initialize",
+	 vslvm_test_physical_volume_initialize );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT ) */
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_physical_volume_free",
+	 vslvm_test_physical_volume_free );
+
+#if defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT )
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_physical_volume_get_name_size",
+	 vslvm_test_physical_volume_get_name_size );
+
+	/* TODO: add tests for libvslvm_physical_volume_get_name */
+
+	/* TODO: add tests for libvslvm_physical_volume_set_name */
+
+	/* TODO: add tests for libvslvm_physical_volume_compare_by_name */
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_physical_volume_get_identifier_size",
+	 vslvm_test_physical_volume_get_identifier_size );
+
+	/* TODO: add tests for libvslvm_physical_volume_get_identifier */
+
+	/* TODO: add tests for libvslvm_physical_volume_set_identifier */
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_physical_volume_get_device_path_size",
+	 vslvm_test_physical_volume_get_device_path_size );
+
+	/* TODO: add tests for libvslvm_physical_volume_get_device_path */
+
+	/* TODO: add tests for libvslvm_physical_volume_set_device_path */
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_physical_volume_get_size",
+	 vslvm_test_physical_volume_get_size );
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_physical_volume_get_number_of_data_area_descriptors",
+	 vslvm_test_physical_volume_get_number_of_data_area_descriptors );
+
+	/* TODO: add tests for libvslvm_physical_volume_get_data_area_descriptor */
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_physical_volume_get_data_area_descriptor_by_offset",
+	 vslvm_test_physical_volume_get_data_area_descriptor_by_offset );
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_physical_volume_get_number_of_metadata_area_descriptors",
+	 vslvm_test_physical_volume_get_number_of_metadata_area_descriptors );
+
+	/* TODO: add tests for libvslvm_physical_volume_get_metadata_area_descriptor */
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_internal_physical_volume_sort_allocations",
+	 vslvm_test_internal_physical_volume_sort_allocations );
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_physical_volume_get_logical_location",
+	 vslvm_test_physical_volume_get_logical_location );
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_physical_volume_get_number_of_unallocated_extent_runs",
+	 vslvm_test_physical_volume_get_number_of_unallocated_extent_runs );
+
+	/* TODO: add tests for libvslvm_physical_volume_get_unallocated_extent_run_by_index */
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_physical_volume_read_label_file_io_pool",
+	 vslvm_test_physical_volume_read_label_file_io_pool );
 
 	/* TODO: add tests for libvslvm_physical_volume_read_element_data */
 
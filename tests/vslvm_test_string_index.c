@@ -0,0 +1,919 @@
+/*
+ * Library string_index type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vslvm_test_libcerror.h"
+#include "vslvm_test_libvslvm.h"
+#include "vslvm_test_macros.h"
+#include "vslvm_test_memory.h"
+#include "vslvm_test_unused.h"
+
+#include "../libvslvm/libvslvm_string_index.h"
+
+#if defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT )
+
+/* Tests the libvslvm_string_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_string_index_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libvslvm_string_index_t *string_index = NULL;
+	int result                            = 0;
+
+#if defined( HAVE_VSLVM_TEST_MEMORY )
+	int number_of_malloc_fail_tests       = 1;
+	int number_of_memset_fail_tests       = 1;
+	int test_number                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libvslvm_string_index_initialize(
+	          &string_index,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "string_index",
+	 string_index );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_string_index_free(
+	          &string_index,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "string_index",
+	 string_index );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvslvm_string_index_initialize(
+	          NULL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string_index = (libvslvm_string_index_t *) 0x12345678UL;
+
+	result = libvslvm_string_index_initialize(
+	          &string_index,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string_index = NULL;
+
+#if defined( HAVE_VSLVM_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libvslvm_string_index_initialize with malloc failing
+		 */
+		vslvm_test_malloc_attempts_before_fail = test_number;
+
+		result = libvslvm_string_index_initialize(
+		          &string_index,
+		          &error );
+
+		if( vslvm_test_malloc_attempts_before_fail != -1 )
+		{
+			vslvm_test_malloc_attempts_before_fail = -1;
+
+			if( string_index != NULL )
+			{
+				libvslvm_string_index_free(
+				 &string_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSLVM_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSLVM_TEST_ASSERT_IS_NULL(
+			 "string_index",
+			 string_index );
+
+			VSLVM_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libvslvm_string_index_initialize with memset failing
+		 */
+		vslvm_test_memset_attempts_before_fail = test_number;
+
+		result = libvslvm_string_index_initialize(
+		          &string_index,
+		          &error );
+
+		if( vslvm_test_memset_attempts_before_fail != -1 )
+		{
+			vslvm_test_memset_attempts_before_fail = -1;
+
+			if( string_index != NULL )
+			{
+				libvslvm_string_index_free(
+				 &string_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSLVM_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSLVM_TEST_ASSERT_IS_NULL(
+			 "string_index",
+			 string_index );
+
+			VSLVM_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_VSLVM_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string_index != NULL )
+	{
+		libvslvm_string_index_free(
+		 &string_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_string_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_string_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libvslvm_string_index_free(
+	          NULL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_string_index_insert_value function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_string_index_insert_value(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libvslvm_string_index_t *string_index = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libvslvm_string_index_initialize(
+	          &string_index,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "string_index",
+	 string_index );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvslvm_string_index_insert_value(
+	          string_index,
+	          "pv0",
+	          3,
+	          (intptr_t *) 0x12345678UL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_string_index_insert_value(
+	          string_index,
+	          "pv0",
+	          3,
+	          (intptr_t *) 0x87654321UL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvslvm_string_index_insert_value(
+	          NULL,
+	          "pv0",
+	          3,
+	          (intptr_t *) 0x12345678UL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_string_index_insert_value(
+	          string_index,
+	          NULL,
+	          3,
+	          (intptr_t *) 0x12345678UL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_string_index_insert_value(
+	          string_index,
+	          "pv0",
+	          (size_t) SSIZE_MAX + 1,
+	          (intptr_t *) 0x12345678UL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvslvm_string_index_free(
+	          &string_index,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "string_index",
+	 string_index );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string_index != NULL )
+	{
+		libvslvm_string_index_free(
+		 &string_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_string_index_get_value_by_key function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_string_index_get_value_by_key(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libvslvm_string_index_t *string_index = NULL;
+	intptr_t *value                       = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libvslvm_string_index_initialize(
+	          &string_index,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "string_index",
+	 string_index );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_string_index_insert_value(
+	          string_index,
+	          "pv0",
+	          3,
+	          (intptr_t *) 0x12345678UL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_string_index_insert_value(
+	          string_index,
+	          "pv1",
+	          3,
+	          (intptr_t *) 0x87654321UL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvslvm_string_index_get_value_by_key(
+	          string_index,
+	          "pv1",
+	          3,
+	          &value,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 (uint64_t) (intptr_t) value,
+	 (uint64_t) 0x87654321UL );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	value = NULL;
+
+	result = libvslvm_string_index_get_value_by_key(
+	          string_index,
+	          "pv10",
+	          4,
+	          &value,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvslvm_string_index_get_value_by_key(
+	          NULL,
+	          "pv1",
+	          3,
+	          &value,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_string_index_get_value_by_key(
+	          string_index,
+	          NULL,
+	          3,
+	          &value,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_string_index_get_value_by_key(
+	          string_index,
+	          "pv1",
+	          3,
+	          NULL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvslvm_string_index_free(
+	          &string_index,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "string_index",
+	 string_index );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string_index != NULL )
+	{
+		libvslvm_string_index_free(
+		 &string_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_string_index_remove_value function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_string_index_remove_value(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libvslvm_string_index_t *string_index = NULL;
+	intptr_t *value                       = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libvslvm_string_index_initialize(
+	          &string_index,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "string_index",
+	 string_index );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_string_index_insert_value(
+	          string_index,
+	          "pv0",
+	          3,
+	          (intptr_t *) 0x12345678UL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_string_index_insert_value(
+	          string_index,
+	          "pv1",
+	          3,
+	          (intptr_t *) 0x87654321UL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvslvm_string_index_remove_value(
+	          string_index,
+	          "pv0",
+	          3,
+	          (intptr_t *) 0x87654321UL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_string_index_remove_value(
+	          string_index,
+	          "pv0",
+	          3,
+	          (intptr_t *) 0x12345678UL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_string_index_remove_value(
+	          string_index,
+	          "pv0",
+	          3,
+	          (intptr_t *) 0x12345678UL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_string_index_get_value_by_key(
+	          string_index,
+	          "pv0",
+	          3,
+	          &value,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_string_index_get_value_by_key(
+	          string_index,
+	          "pv1",
+	          3,
+	          &value,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 (uint64_t) (intptr_t) value,
+	 (uint64_t) 0x87654321UL );
+
+	/* Test error cases
+	 */
+	result = libvslvm_string_index_remove_value(
+	          NULL,
+	          "pv1",
+	          3,
+	          (intptr_t *) 0x87654321UL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_string_index_remove_value(
+	          string_index,
+	          NULL,
+	          3,
+	          (intptr_t *) 0x87654321UL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_string_index_remove_value(
+	          string_index,
+	          "pv1",
+	          (size_t) SSIZE_MAX + 1,
+	          (intptr_t *) 0x87654321UL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvslvm_string_index_free(
+	          &string_index,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "string_index",
+	 string_index );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string_index != NULL )
+	{
+		libvslvm_string_index_free(
+		 &string_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSLVM_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSLVM_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSLVM_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSLVM_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSLVM_TEST_UNREFERENCED_PARAMETER( argc )
+	VSLVM_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT )
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_string_index_initialize",
+	 vslvm_test_string_index_initialize );
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_string_index_free",
+	 vslvm_test_string_index_free );
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_string_index_insert_value",
+	 vslvm_test_string_index_insert_value );
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_string_index_get_value_by_key",
+	 vslvm_test_string_index_get_value_by_key );
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_string_index_remove_value",
+	 vslvm_test_string_index_remove_value );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
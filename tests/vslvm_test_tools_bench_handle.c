@@ -0,0 +1,556 @@
+/*
+ * Tools bench_handle type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vslvm_test_libcerror.h"
+#include "vslvm_test_macros.h"
+#include "vslvm_test_memory.h"
+#include "vslvm_test_unused.h"
+
+#include "../vslvmtools/bench_handle.h"
+
+/* Tests the bench_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_tools_bench_handle_initialize(
+     void )
+{
+	bench_handle_t *bench_handle    = NULL;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_VSLVM_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = bench_handle_initialize(
+	          &bench_handle,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "bench_handle",
+	 bench_handle );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = bench_handle_free(
+	          &bench_handle,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "bench_handle",
+	 bench_handle );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = bench_handle_initialize(
+	          NULL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	bench_handle = (bench_handle_t *) 0x12345678UL;
+
+	result = bench_handle_initialize(
+	          &bench_handle,
+	          &error );
+
+	bench_handle = NULL;
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSLVM_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test bench_handle_initialize with malloc failing
+		 */
+		vslvm_test_malloc_attempts_before_fail = test_number;
+
+		result = bench_handle_initialize(
+		          &bench_handle,
+		          &error );
+
+		if( vslvm_test_malloc_attempts_before_fail != -1 )
+		{
+			vslvm_test_malloc_attempts_before_fail = -1;
+
+			if( bench_handle != NULL )
+			{
+				bench_handle_free(
+				 &bench_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSLVM_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSLVM_TEST_ASSERT_IS_NULL(
+			 "bench_handle",
+			 bench_handle );
+
+			VSLVM_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test bench_handle_initialize with memset failing
+		 */
+		vslvm_test_memset_attempts_before_fail = test_number;
+
+		result = bench_handle_initialize(
+		          &bench_handle,
+		          &error );
+
+		if( vslvm_test_memset_attempts_before_fail != -1 )
+		{
+			vslvm_test_memset_attempts_before_fail = -1;
+
+			if( bench_handle != NULL )
+			{
+				bench_handle_free(
+				 &bench_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSLVM_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSLVM_TEST_ASSERT_IS_NULL(
+			 "bench_handle",
+			 bench_handle );
+
+			VSLVM_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_VSLVM_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bench_handle != NULL )
+	{
+		bench_handle_free(
+		 &bench_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the bench_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_tools_bench_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = bench_handle_free(
+	          NULL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the bench_handle_set_number_of_iterations function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_tools_bench_handle_set_number_of_iterations(
+     void )
+{
+	bench_handle_t *bench_handle = NULL;
+	libcerror_error_t *error     = NULL;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = bench_handle_initialize(
+	          &bench_handle,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "bench_handle",
+	 bench_handle );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = bench_handle_set_number_of_iterations(
+	          bench_handle,
+	          _SYSTEM_STRING( "25" ),
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "bench_handle->number_of_iterations",
+	 bench_handle->number_of_iterations,
+	 25 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = bench_handle_set_number_of_iterations(
+	          bench_handle,
+	          _SYSTEM_STRING( "0" ),
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "bench_handle->number_of_iterations",
+	 bench_handle->number_of_iterations,
+	 25 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = bench_handle_set_number_of_iterations(
+	          NULL,
+	          _SYSTEM_STRING( "25" ),
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = bench_handle_free(
+	          &bench_handle,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "bench_handle",
+	 bench_handle );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bench_handle != NULL )
+	{
+		bench_handle_free(
+		 &bench_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the bench_handle_set_output_format function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_tools_bench_handle_set_output_format(
+     void )
+{
+	bench_handle_t *bench_handle = NULL;
+	libcerror_error_t *error     = NULL;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = bench_handle_initialize(
+	          &bench_handle,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "bench_handle",
+	 bench_handle );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = bench_handle_set_output_format(
+	          bench_handle,
+	          _SYSTEM_STRING( "json" ),
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "bench_handle->output_format",
+	 bench_handle->output_format,
+	 BENCH_HANDLE_OUTPUT_FORMAT_JSON );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = bench_handle_set_output_format(
+	          bench_handle,
+	          _SYSTEM_STRING( "xml" ),
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "bench_handle->output_format",
+	 bench_handle->output_format,
+	 BENCH_HANDLE_OUTPUT_FORMAT_JSON );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = bench_handle_set_output_format(
+	          NULL,
+	          _SYSTEM_STRING( "json" ),
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = bench_handle_free(
+	          &bench_handle,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "bench_handle",
+	 bench_handle );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bench_handle != NULL )
+	{
+		bench_handle_free(
+		 &bench_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSLVM_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSLVM_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSLVM_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSLVM_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSLVM_TEST_UNREFERENCED_PARAMETER( argc )
+	VSLVM_TEST_UNREFERENCED_PARAMETER( argv )
+
+	VSLVM_TEST_RUN(
+	 "bench_handle_initialize",
+	 vslvm_test_tools_bench_handle_initialize );
+
+	VSLVM_TEST_RUN(
+	 "bench_handle_free",
+	 vslvm_test_tools_bench_handle_free );
+
+	VSLVM_TEST_RUN(
+	 "bench_handle_set_number_of_iterations",
+	 vslvm_test_tools_bench_handle_set_number_of_iterations );
+
+	VSLVM_TEST_RUN(
+	 "bench_handle_set_output_format",
+	 vslvm_test_tools_bench_handle_set_output_format );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,18 +21,22 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "vslvm_test_fixtures.h"
+#include "vslvm_test_libbfio.h"
 #include "vslvm_test_libcerror.h"
 #include "vslvm_test_libvslvm.h"
 #include "vslvm_test_macros.h"
 #include "vslvm_test_memory.h"
 #include "vslvm_test_unused.h"
 
+#include "../libvslvm/libvslvm_io_handle.h"
 #include "../libvslvm/libvslvm_volume_group.h"
 
 #if defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT )
@@ -889,22 +893,3205 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libvslvm_volume_group_get_physical_volume_by_name function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_volume_group_get_physical_volume_by_name(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libvslvm_physical_volume_t *physical_volume = NULL;
+	libvslvm_volume_group_t *volume_group       = NULL;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libvslvm_volume_group_initialize(
+	          &volume_group,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_physical_volume_initialize(
+	          &physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "physical_volume",
+	 physical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_physical_volume_set_name(
+	          physical_volume,
+	          "pv0",
+	          4,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_physical_volume_set_identifier(
+	          physical_volume,
+	          "btEzLa-i0aL-sfS8-Ae9P-QKGU-IhtA-CkpWm7",
+	          39,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_volume_group_append_physical_volume(
+	          volume_group,
+	          physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The physical volume is now managed by the volume group
+	 */
+	physical_volume = NULL;
+
+	/* Test regular cases
+	 */
+	result = libvslvm_volume_group_get_physical_volume_by_name(
+	          volume_group,
+	          "pv0",
+	          3,
+	          &physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "physical_volume",
+	 physical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	physical_volume = NULL;
+
+	result = libvslvm_volume_group_get_physical_volume_by_name(
+	          volume_group,
+	          "pv0",
+	          3 - 1,
+	          &physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "physical_volume",
+	 physical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvslvm_volume_group_get_physical_volume_by_name(
+	          NULL,
+	          "pv0",
+	          3,
+	          &physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_get_physical_volume_by_name(
+	          volume_group,
+	          NULL,
+	          3,
+	          &physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_get_physical_volume_by_name(
+	          volume_group,
+	          "pv0",
+	          3,
+	          NULL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvslvm_internal_volume_group_free(
+	          (libvslvm_internal_volume_group_t **) &volume_group,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( physical_volume != NULL )
+	{
+		libvslvm_internal_physical_volume_free(
+		 (libvslvm_internal_physical_volume_t **) &physical_volume,
+		 NULL );
+	}
+	if( volume_group != NULL )
+	{
+		libvslvm_internal_volume_group_free(
+		 (libvslvm_internal_volume_group_t **) &volume_group,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_volume_group_get_physical_volume_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_volume_group_get_physical_volume_by_identifier(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libvslvm_physical_volume_t *physical_volume = NULL;
+	libvslvm_volume_group_t *volume_group       = NULL;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libvslvm_volume_group_initialize(
+	          &volume_group,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_physical_volume_initialize(
+	          &physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "physical_volume",
+	 physical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_physical_volume_set_name(
+	          physical_volume,
+	          "pv0",
+	          4,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_physical_volume_set_identifier(
+	          physical_volume,
+	          "btEzLa-i0aL-sfS8-Ae9P-QKGU-IhtA-CkpWm7",
+	          39,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_volume_group_append_physical_volume(
+	          volume_group,
+	          physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The physical volume is now managed by the volume group
+	 */
+	physical_volume = NULL;
+
+	/* Test regular cases
+	 */
+	result = libvslvm_volume_group_get_physical_volume_by_identifier(
+	          volume_group,
+	          "btEzLa-i0aL-sfS8-Ae9P-QKGU-IhtA-CkpWm7",
+	          38,
+	          &physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "physical_volume",
+	 physical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	physical_volume = NULL;
+
+	result = libvslvm_volume_group_get_physical_volume_by_identifier(
+	          volume_group,
+	          "btEzLa-i0aL-sfS8-Ae9P-QKGU-IhtA-CkpWm7",
+	          38 - 1,
+	          &physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "physical_volume",
+	 physical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvslvm_volume_group_get_physical_volume_by_identifier(
+	          NULL,
+	          "btEzLa-i0aL-sfS8-Ae9P-QKGU-IhtA-CkpWm7",
+	          38,
+	          &physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_get_physical_volume_by_identifier(
+	          volume_group,
+	          NULL,
+	          38,
+	          &physical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_get_physical_volume_by_identifier(
+	          volume_group,
+	          "btEzLa-i0aL-sfS8-Ae9P-QKGU-IhtA-CkpWm7",
+	          38,
+	          NULL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvslvm_internal_volume_group_free(
+	          (libvslvm_internal_volume_group_t **) &volume_group,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( physical_volume != NULL )
+	{
+		libvslvm_internal_physical_volume_free(
+		 (libvslvm_internal_physical_volume_t **) &physical_volume,
+		 NULL );
+	}
+	if( volume_group != NULL )
+	{
+		libvslvm_internal_volume_group_free(
+		 (libvslvm_internal_volume_group_t **) &volume_group,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libvslvm_volume_group_get_number_of_logical_volumes function
  * Returns 1 if successful or 0 if not
  */
-int vslvm_test_volume_group_get_number_of_logical_volumes(
+int vslvm_test_volume_group_get_number_of_logical_volumes(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libvslvm_volume_group_t *volume_group = NULL;
+	int number_of_logical_volumes         = 0;
+	int number_of_logical_volumes_is_set  = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libvslvm_volume_group_initialize(
+	          &volume_group,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvslvm_volume_group_get_number_of_logical_volumes(
+	          volume_group,
+	          &number_of_logical_volumes,
+	          &error );
+
+	VSLVM_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_logical_volumes_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libvslvm_volume_group_get_number_of_logical_volumes(
+	          NULL,
+	          &number_of_logical_volumes,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( number_of_logical_volumes_is_set != 0 )
+	{
+		result = libvslvm_volume_group_get_number_of_logical_volumes(
+		          volume_group,
+		          NULL,
+		          &error );
+
+		VSLVM_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		VSLVM_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libvslvm_internal_volume_group_free(
+	          (libvslvm_internal_volume_group_t **) &volume_group,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume_group != NULL )
+	{
+		libvslvm_internal_volume_group_free(
+		 (libvslvm_internal_volume_group_t **) &volume_group,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_volume_group_get_logical_volume_by_name function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_volume_group_get_logical_volume_by_name(
+     void )
+{
+	libcerror_error_t *error                                = NULL;
+	libvslvm_logical_volume_t *logical_volume               = NULL;
+	libvslvm_logical_volume_values_t *logical_volume_values = NULL;
+	libvslvm_volume_group_t *volume_group                   = NULL;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libvslvm_volume_group_initialize(
+	          &volume_group,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_logical_volume_values_initialize(
+	          &logical_volume_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume_values",
+	 logical_volume_values );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_logical_volume_values_set_name(
+	          logical_volume_values,
+	          "lv0",
+	          4,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_logical_volume_values_set_identifier(
+	          logical_volume_values,
+	          "Zm8Lbx-3tMe-dxNc-QKvQ-u5Av-vcH2-G0JdiX",
+	          39,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_volume_group_append_logical_volume(
+	          volume_group,
+	          logical_volume_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The logical volume values are now managed by the volume group
+	 */
+	logical_volume_values = NULL;
+
+	/* Test regular cases
+	 */
+	result = libvslvm_volume_group_get_logical_volume_by_name(
+	          volume_group,
+	          "lv0",
+	          3,
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_logical_volume_free(
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_volume_group_get_logical_volume_by_name(
+	          volume_group,
+	          "lv0",
+	          3 - 1,
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvslvm_volume_group_get_logical_volume_by_name(
+	          NULL,
+	          "lv0",
+	          3,
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_get_logical_volume_by_name(
+	          volume_group,
+	          NULL,
+	          3,
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_get_logical_volume_by_name(
+	          volume_group,
+	          "lv0",
+	          3,
+	          NULL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvslvm_internal_volume_group_free(
+	          (libvslvm_internal_volume_group_t **) &volume_group,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( logical_volume != NULL )
+	{
+		libvslvm_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( logical_volume_values != NULL )
+	{
+		libvslvm_logical_volume_values_free(
+		 &logical_volume_values,
+		 NULL );
+	}
+	if( volume_group != NULL )
+	{
+		libvslvm_internal_volume_group_free(
+		 (libvslvm_internal_volume_group_t **) &volume_group,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_volume_group_get_logical_volume_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_volume_group_get_logical_volume_by_identifier(
+     void )
+{
+	libcerror_error_t *error                                = NULL;
+	libvslvm_logical_volume_t *logical_volume               = NULL;
+	libvslvm_logical_volume_values_t *logical_volume_values = NULL;
+	libvslvm_volume_group_t *volume_group                   = NULL;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libvslvm_volume_group_initialize(
+	          &volume_group,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_logical_volume_values_initialize(
+	          &logical_volume_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume_values",
+	 logical_volume_values );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_logical_volume_values_set_name(
+	          logical_volume_values,
+	          "lv0",
+	          4,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_logical_volume_values_set_identifier(
+	          logical_volume_values,
+	          "Zm8Lbx-3tMe-dxNc-QKvQ-u5Av-vcH2-G0JdiX",
+	          39,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_volume_group_append_logical_volume(
+	          volume_group,
+	          logical_volume_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The logical volume values are now managed by the volume group
+	 */
+	logical_volume_values = NULL;
+
+	/* Test regular cases
+	 */
+	result = libvslvm_volume_group_get_logical_volume_by_identifier(
+	          volume_group,
+	          "Zm8Lbx-3tMe-dxNc-QKvQ-u5Av-vcH2-G0JdiX",
+	          38,
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_logical_volume_free(
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_volume_group_get_logical_volume_by_identifier(
+	          volume_group,
+	          "Zm8Lbx-3tMe-dxNc-QKvQ-u5Av-vcH2-G0JdiX",
+	          38 - 1,
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvslvm_volume_group_get_logical_volume_by_identifier(
+	          NULL,
+	          "Zm8Lbx-3tMe-dxNc-QKvQ-u5Av-vcH2-G0JdiX",
+	          38,
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_get_logical_volume_by_identifier(
+	          volume_group,
+	          NULL,
+	          38,
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_get_logical_volume_by_identifier(
+	          volume_group,
+	          "Zm8Lbx-3tMe-dxNc-QKvQ-u5Av-vcH2-G0JdiX",
+	          38,
+	          NULL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvslvm_internal_volume_group_free(
+	          (libvslvm_internal_volume_group_t **) &volume_group,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( logical_volume != NULL )
+	{
+		libvslvm_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( logical_volume_values != NULL )
+	{
+		libvslvm_logical_volume_values_free(
+		 &logical_volume_values,
+		 NULL );
+	}
+	if( volume_group != NULL )
+	{
+		libvslvm_internal_volume_group_free(
+		 (libvslvm_internal_volume_group_t **) &volume_group,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_volume_group_get_logical_volume_name_size_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_volume_group_get_logical_volume_name_size_by_index(
+     void )
+{
+	libcerror_error_t *error                                = NULL;
+	libvslvm_logical_volume_values_t *logical_volume_values = NULL;
+	libvslvm_volume_group_t *volume_group                   = NULL;
+	size_t name_size                                        = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = vslvm_test_create_volume_group(
+	          &volume_group,
+	          &logical_volume_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvslvm_volume_group_get_logical_volume_name_size_by_index(
+	          volume_group,
+	          0,
+	          &name_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_EQUAL_SIZE(
+	 "name_size",
+	 name_size,
+	 (size_t) 4 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvslvm_volume_group_get_logical_volume_name_size_by_index(
+	          NULL,
+	          0,
+	          &name_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_get_logical_volume_name_size_by_index(
+	          volume_group,
+	          2,
+	          &name_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_get_logical_volume_name_size_by_index(
+	          volume_group,
+	          0,
+	          NULL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvslvm_internal_volume_group_free(
+	          (libvslvm_internal_volume_group_t **) &volume_group,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume_group != NULL )
+	{
+		libvslvm_internal_volume_group_free(
+		 (libvslvm_internal_volume_group_t **) &volume_group,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_volume_group_get_logical_volume_name_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_volume_group_get_logical_volume_name_by_index(
+     void )
+{
+	char name[ 64 ];
+
+	libcerror_error_t *error                                = NULL;
+	libvslvm_logical_volume_values_t *logical_volume_values = NULL;
+	libvslvm_volume_group_t *volume_group                   = NULL;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = vslvm_test_create_volume_group(
+	          &volume_group,
+	          &logical_volume_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvslvm_volume_group_get_logical_volume_name_by_index(
+	          volume_group,
+	          1,
+	          name,
+	          64,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          name,
+	          "lv1",
+	          4 );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libvslvm_volume_group_get_logical_volume_name_by_index(
+	          NULL,
+	          1,
+	          name,
+	          64,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_get_logical_volume_name_by_index(
+	          volume_group,
+	          2,
+	          name,
+	          64,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_get_logical_volume_name_by_index(
+	          volume_group,
+	          1,
+	          NULL,
+	          64,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_get_logical_volume_name_by_index(
+	          volume_group,
+	          1,
+	          name,
+	          2,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvslvm_internal_volume_group_free(
+	          (libvslvm_internal_volume_group_t **) &volume_group,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume_group != NULL )
+	{
+		libvslvm_internal_volume_group_free(
+		 (libvslvm_internal_volume_group_t **) &volume_group,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_volume_group_get_logical_volume_identifier_size_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_volume_group_get_logical_volume_identifier_size_by_index(
+     void )
+{
+	libcerror_error_t *error                                = NULL;
+	libvslvm_logical_volume_values_t *logical_volume_values = NULL;
+	libvslvm_volume_group_t *volume_group                   = NULL;
+	size_t identifier_size                                  = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = vslvm_test_create_volume_group(
+	          &volume_group,
+	          &logical_volume_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvslvm_volume_group_get_logical_volume_identifier_size_by_index(
+	          volume_group,
+	          0,
+	          &identifier_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_EQUAL_SIZE(
+	 "identifier_size",
+	 identifier_size,
+	 (size_t) 39 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvslvm_volume_group_get_logical_volume_identifier_size_by_index(
+	          NULL,
+	          0,
+	          &identifier_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_get_logical_volume_identifier_size_by_index(
+	          volume_group,
+	          2,
+	          &identifier_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_get_logical_volume_identifier_size_by_index(
+	          volume_group,
+	          0,
+	          NULL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvslvm_internal_volume_group_free(
+	          (libvslvm_internal_volume_group_t **) &volume_group,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume_group != NULL )
+	{
+		libvslvm_internal_volume_group_free(
+		 (libvslvm_internal_volume_group_t **) &volume_group,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_volume_group_get_logical_volume_identifier_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_volume_group_get_logical_volume_identifier_by_index(
+     void )
+{
+	char identifier[ 64 ];
+
+	libcerror_error_t *error                                = NULL;
+	libvslvm_logical_volume_values_t *logical_volume_values = NULL;
+	libvslvm_volume_group_t *volume_group                   = NULL;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = vslvm_test_create_volume_group(
+	          &volume_group,
+	          &logical_volume_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvslvm_volume_group_get_logical_volume_identifier_by_index(
+	          volume_group,
+	          1,
+	          identifier,
+	          64,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          identifier,
+	          "lv1bbb-bbbb-bbbb-bbbb-bbbb-bbbb-bbbbbb",
+	          39 );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libvslvm_volume_group_get_logical_volume_identifier_by_index(
+	          NULL,
+	          1,
+	          identifier,
+	          64,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_get_logical_volume_identifier_by_index(
+	          volume_group,
+	          2,
+	          identifier,
+	          64,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_get_logical_volume_identifier_by_index(
+	          volume_group,
+	          1,
+	          NULL,
+	          64,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_get_logical_volume_identifier_by_index(
+	          volume_group,
+	          1,
+	          identifier,
+	          8,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvslvm_internal_volume_group_free(
+	          (libvslvm_internal_volume_group_t **) &volume_group,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume_group != NULL )
+	{
+		libvslvm_internal_volume_group_free(
+		 (libvslvm_internal_volume_group_t **) &volume_group,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_volume_group_get_logical_volume_number_of_segments_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_volume_group_get_logical_volume_number_of_segments_by_index(
+     void )
+{
+	libcerror_error_t *error                                = NULL;
+	libvslvm_logical_volume_values_t *logical_volume_values = NULL;
+	libvslvm_volume_group_t *volume_group                   = NULL;
+	int number_of_segments                                  = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = vslvm_test_create_volume_group(
+	          &volume_group,
+	          &logical_volume_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvslvm_volume_group_get_logical_volume_number_of_segments_by_index(
+	          volume_group,
+	          0,
+	          &number_of_segments,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 3 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_volume_group_get_logical_volume_number_of_segments_by_index(
+	          volume_group,
+	          1,
+	          &number_of_segments,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvslvm_volume_group_get_logical_volume_number_of_segments_by_index(
+	          NULL,
+	          0,
+	          &number_of_segments,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_get_logical_volume_number_of_segments_by_index(
+	          volume_group,
+	          2,
+	          &number_of_segments,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_get_logical_volume_number_of_segments_by_index(
+	          volume_group,
+	          0,
+	          NULL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvslvm_internal_volume_group_free(
+	          (libvslvm_internal_volume_group_t **) &volume_group,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume_group != NULL )
+	{
+		libvslvm_internal_volume_group_free(
+		 (libvslvm_internal_volume_group_t **) &volume_group,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_volume_group_get_logical_volume_segment_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_volume_group_get_logical_volume_segment_by_index(
+     void )
+{
+	libcerror_error_t *error                                = NULL;
+	libvslvm_logical_volume_values_t *logical_volume_values = NULL;
+	libvslvm_segment_t *segment                             = NULL;
+	libvslvm_volume_group_t *volume_group                   = NULL;
+	size64_t segment_size                                   = 0;
+	off64_t segment_offset                                  = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = vslvm_test_create_volume_group(
+	          &volume_group,
+	          &logical_volume_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvslvm_volume_group_get_logical_volume_segment_by_index(
+	          volume_group,
+	          0,
+	          2,
+	          &segment,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "segment",
+	 segment );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_segment_get_offset(
+	          segment,
+	          &segment_offset,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT64(
+	 "segment_offset",
+	 (int64_t) segment_offset,
+	 (int64_t) 0x00020000UL );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_segment_get_size(
+	          segment,
+	          &segment_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "segment_size",
+	 (uint64_t) segment_size,
+	 (uint64_t) 0x00010000UL );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The segment is owned by the logical volume values
+	 */
+	result = libvslvm_segment_free(
+	          &segment,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "segment",
+	 segment );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvslvm_volume_group_get_logical_volume_segment_by_index(
+	          NULL,
+	          0,
+	          2,
+	          &segment,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_get_logical_volume_segment_by_index(
+	          volume_group,
+	          2,
+	          0,
+	          &segment,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_get_logical_volume_segment_by_index(
+	          volume_group,
+	          0,
+	          3,
+	          &segment,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_get_logical_volume_segment_by_index(
+	          volume_group,
+	          0,
+	          2,
+	          NULL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvslvm_internal_volume_group_free(
+	          (libvslvm_internal_volume_group_t **) &volume_group,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume_group != NULL )
+	{
+		libvslvm_internal_volume_group_free(
+		 (libvslvm_internal_volume_group_t **) &volume_group,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_volume_group_get_unallocated_volume function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_volume_group_get_unallocated_volume(
+     void )
+{
+	/* The first bytes of the data contain the 4 KiB block number of the physical volume,
+	 * the unallocated extent runs start at physical volume offsets 0x00010000, 0x00060000 and 0x00078000
+	 */
+	off64_t expected_offsets[ 3 ] = {
+		0, 0x00010000UL, 0x00018000UL };
+
+	uint8_t expected_first_bytes[ 3 ] = {
+		0x10, 0x60, 0x78 };
+
+	uint8_t buffer[ 16 ];
+
+	libbfio_pool_t *file_io_pool                            = NULL;
+	libcerror_error_t *error                                = NULL;
+	libvslvm_io_handle_t *io_handle                         = NULL;
+	libvslvm_logical_volume_t *logical_volume               = NULL;
+	libvslvm_logical_volume_values_t *logical_volume_values = NULL;
+	libvslvm_volume_group_t *volume_group                   = NULL;
+	uint8_t *data                                           = NULL;
+	size64_t volume_size                                    = 0;
+	ssize_t read_count                                      = 0;
+	int offset_index                                        = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = vslvm_test_create_volume_group(
+	          &volume_group,
+	          &logical_volume_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vslvm_test_open_volume_group(
+	          volume_group,
+	          &io_handle,
+	          &file_io_pool,
+	          &data,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvslvm_volume_group_get_unallocated_volume(
+	          volume_group,
+	          0,
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_logical_volume_get_size(
+	          logical_volume,
+	          &volume_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "volume_size",
+	 (uint64_t) volume_size,
+	 (uint64_t) 0x00020000UL );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( offset_index = 0;
+	     offset_index < 3;
+	     offset_index++ )
+	{
+		read_count = libvslvm_logical_volume_read_buffer_at_offset(
+		              logical_volume,
+		              buffer,
+		              16,
+		              expected_offsets[ offset_index ],
+		              &error );
+
+		VSLVM_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 16 );
+
+		VSLVM_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		VSLVM_TEST_ASSERT_EQUAL_UINT8(
+		 "buffer[ 0 ]",
+		 buffer[ 0 ],
+		 expected_first_bytes[ offset_index ] );
+	}
+	result = libvslvm_logical_volume_free(
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvslvm_volume_group_get_unallocated_volume(
+	          NULL,
+	          0,
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_get_unallocated_volume(
+	          volume_group,
+	          1,
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_get_unallocated_volume(
+	          volume_group,
+	          0,
+	          NULL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvslvm_internal_volume_group_free(
+	          (libvslvm_internal_volume_group_t **) &volume_group,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( logical_volume != NULL )
+	{
+		libvslvm_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( volume_group != NULL )
+	{
+		libvslvm_internal_volume_group_free(
+		 (libvslvm_internal_volume_group_t **) &volume_group,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libvslvm_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_volume_group_get_data_area_volume function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_volume_group_get_data_area_volume(
+     void )
+{
+	/* The first bytes of the data contain the 4 KiB block number of the physical volume,
+	 * the data areas start at physical volume offsets 0x00010000 and 0x00060000
+	 */
+	off64_t expected_offsets[ 3 ] = {
+		0, 0x00040000UL, 0x0005f000UL };
+
+	uint8_t expected_first_bytes[ 3 ] = {
+		0x10, 0x60, 0x7f };
+
+	uint8_t buffer[ 16 ];
+
+	libbfio_pool_t *file_io_pool                            = NULL;
+	libcerror_error_t *error                                = NULL;
+	libvslvm_io_handle_t *io_handle                         = NULL;
+	libvslvm_logical_volume_t *logical_volume               = NULL;
+	libvslvm_logical_volume_values_t *logical_volume_values = NULL;
+	libvslvm_volume_group_t *volume_group                   = NULL;
+	uint8_t *data                                           = NULL;
+	size64_t volume_size                                    = 0;
+	ssize_t read_count                                      = 0;
+	int offset_index                                        = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = vslvm_test_create_volume_group(
+	          &volume_group,
+	          &logical_volume_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vslvm_test_open_volume_group(
+	          volume_group,
+	          &io_handle,
+	          &file_io_pool,
+	          &data,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvslvm_volume_group_get_data_area_volume(
+	          volume_group,
+	          0,
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_logical_volume_get_size(
+	          logical_volume,
+	          &volume_size,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_EQUAL_UINT64(
+	 "volume_size",
+	 (uint64_t) volume_size,
+	 (uint64_t) 0x00060000UL );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( offset_index = 0;
+	     offset_index < 3;
+	     offset_index++ )
+	{
+		read_count = libvslvm_logical_volume_read_buffer_at_offset(
+		              logical_volume,
+		              buffer,
+		              16,
+		              expected_offsets[ offset_index ],
+		              &error );
+
+		VSLVM_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 16 );
+
+		VSLVM_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		VSLVM_TEST_ASSERT_EQUAL_UINT8(
+		 "buffer[ 0 ]",
+		 buffer[ 0 ],
+		 expected_first_bytes[ offset_index ] );
+	}
+	result = libvslvm_logical_volume_free(
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvslvm_volume_group_get_data_area_volume(
+	          NULL,
+	          0,
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_get_data_area_volume(
+	          volume_group,
+	          1,
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_get_data_area_volume(
+	          volume_group,
+	          0,
+	          NULL,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvslvm_internal_volume_group_free(
+	          (libvslvm_internal_volume_group_t **) &volume_group,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( logical_volume != NULL )
+	{
+		libvslvm_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( volume_group != NULL )
+	{
+		libvslvm_internal_volume_group_free(
+		 (libvslvm_internal_volume_group_t **) &volume_group,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libvslvm_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* The maximum number of write callback invocations recorded by the sweep test
+ */
+#define VSLVM_TEST_SWEEP_MAXIMUM_NUMBER_OF_CALLS	16
+
+typedef struct vslvm_test_sweep_values vslvm_test_sweep_values_t;
+
+struct vslvm_test_sweep_values
+{
+	/* The value returned by the write callback
+	 */
+	int callback_result;
+
+	/* The number of write callback invocations
+	 */
+	int number_of_calls;
+
+	/* The logical volume index per invocation
+	 */
+	int logical_volume_indexes[ VSLVM_TEST_SWEEP_MAXIMUM_NUMBER_OF_CALLS ];
+
+	/* The logical volume offset per invocation
+	 */
+	off64_t logical_volume_offsets[ VSLVM_TEST_SWEEP_MAXIMUM_NUMBER_OF_CALLS ];
+
+	/* The buffer size per invocation
+	 */
+	size_t buffer_sizes[ VSLVM_TEST_SWEEP_MAXIMUM_NUMBER_OF_CALLS ];
+
+	/* The first byte of the buffer per invocation
+	 */
+	uint8_t first_bytes[ VSLVM_TEST_SWEEP_MAXIMUM_NUMBER_OF_CALLS ];
+};
+
+/* Records the data passed by libvslvm_volume_group_sweep_logical_volumes
+ * Returns the callback result of the sweep values
+ */
+int vslvm_test_volume_group_sweep_write_callback(
+     intptr_t *callback_data,
+     int logical_volume_index,
+     off64_t logical_volume_offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error VSLVM_TEST_ATTRIBUTE_UNUSED )
+{
+	vslvm_test_sweep_values_t *sweep_values = NULL;
+
+	VSLVM_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( callback_data == NULL )
+	{
+		return( -1 );
+	}
+	sweep_values = (vslvm_test_sweep_values_t *) callback_data;
+
+	if( sweep_values->number_of_calls < VSLVM_TEST_SWEEP_MAXIMUM_NUMBER_OF_CALLS )
+	{
+		sweep_values->logical_volume_indexes[ sweep_values->number_of_calls ] = logical_volume_index;
+		sweep_values->logical_volume_offsets[ sweep_values->number_of_calls ] = logical_volume_offset;
+		sweep_values->buffer_sizes[ sweep_values->number_of_calls ]           = buffer_size;
+		sweep_values->first_bytes[ sweep_values->number_of_calls ]            = buffer[ 0 ];
+	}
+	sweep_values->number_of_calls += 1;
+
+	return( sweep_values->callback_result );
+}
+
+/* Tests the libvslvm_volume_group_sweep_logical_volumes function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_volume_group_sweep_logical_volumes(
+     void )
+{
+	/* The first bytes of the data contain the 4 KiB block number of the physical volume,
+	 * the striped logical volume "lv1" at physical volume offset 0x00040000 is not swept
+	 */
+	off64_t expected_logical_volume_offsets[ 6 ] = {
+		0, 0x00008000UL, 0x00010000UL, 0x00018000UL, 0x00020000UL, 0x00028000UL };
+
+	uint8_t expected_first_bytes[ 6 ] = {
+		0x20, 0x28, 0x30, 0x38, 0x68, 0x70 };
+
+	vslvm_test_sweep_values_t sweep_values;
+
+	libbfio_pool_t *file_io_pool                            = NULL;
+	libcerror_error_t *error                                = NULL;
+	libvslvm_io_handle_t *io_handle                         = NULL;
+	libvslvm_logical_volume_t *logical_volume               = NULL;
+	libvslvm_logical_volume_values_t *logical_volume_values = NULL;
+	libvslvm_volume_group_t *volume_group                   = NULL;
+	uint8_t *data                                           = NULL;
+	int call_index                                          = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = vslvm_test_create_volume_group(
+	          &volume_group,
+	          &logical_volume_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vslvm_test_open_volume_group(
+	          volume_group,
+	          &io_handle,
+	          &file_io_pool,
+	          &data,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The striped logical volume is not supported by the logical volume
+	 */
+	result = libvslvm_volume_group_get_logical_volume(
+	          volume_group,
+	          1,
+	          &logical_volume,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	memory_set(
+	 &sweep_values,
+	 0,
+	 sizeof( vslvm_test_sweep_values_t ) );
+
+	sweep_values.callback_result = 1;
+
+	result = libvslvm_volume_group_sweep_logical_volumes(
+	          volume_group,
+	          0x00008000UL,
+	          &vslvm_test_volume_group_sweep_write_callback,
+	          (intptr_t *) &sweep_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "sweep_values.number_of_calls",
+	 sweep_values.number_of_calls,
+	 6 );
+
+	for( call_index = 0;
+	     call_index < 6;
+	     call_index++ )
+	{
+		VSLVM_TEST_ASSERT_EQUAL_INT(
+		 "sweep_values.logical_volume_indexes[ call_index ]",
+		 sweep_values.logical_volume_indexes[ call_index ],
+		 0 );
+
+		VSLVM_TEST_ASSERT_EQUAL_INT64(
+		 "sweep_values.logical_volume_offsets[ call_index ]",
+		 (int64_t) sweep_values.logical_volume_offsets[ call_index ],
+		 (int64_t) expected_logical_volume_offsets[ call_index ] );
+
+		VSLVM_TEST_ASSERT_EQUAL_SIZE(
+		 "sweep_values.buffer_sizes[ call_index ]",
+		 sweep_values.buffer_sizes[ call_index ],
+		 (size_t) 0x00008000UL );
+
+		VSLVM_TEST_ASSERT_EQUAL_UINT8(
+		 "sweep_values.first_bytes[ call_index ]",
+		 sweep_values.first_bytes[ call_index ],
+		 expected_first_bytes[ call_index ] );
+	}
+	/* Test the write callback stopping the sweep
+	 */
+	memory_set(
+	 &sweep_values,
+	 0,
+	 sizeof( vslvm_test_sweep_values_t ) );
+
+	sweep_values.callback_result = 0;
+
+	result = libvslvm_volume_group_sweep_logical_volumes(
+	          volume_group,
+	          0x00008000UL,
+	          &vslvm_test_volume_group_sweep_write_callback,
+	          (intptr_t *) &sweep_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "sweep_values.number_of_calls",
+	 sweep_values.number_of_calls,
+	 1 );
+
+	/* Test error cases
+	 */
+	memory_set(
+	 &sweep_values,
+	 0,
+	 sizeof( vslvm_test_sweep_values_t ) );
+
+	sweep_values.callback_result = -1;
+
+	result = libvslvm_volume_group_sweep_logical_volumes(
+	          volume_group,
+	          0x00008000UL,
+	          &vslvm_test_volume_group_sweep_write_callback,
+	          (intptr_t *) &sweep_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "sweep_values.number_of_calls",
+	 sweep_values.number_of_calls,
+	 1 );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_sweep_logical_volumes(
+	          NULL,
+	          0x00008000UL,
+	          &vslvm_test_volume_group_sweep_write_callback,
+	          (intptr_t *) &sweep_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_sweep_logical_volumes(
+	          volume_group,
+	          0,
+	          &vslvm_test_volume_group_sweep_write_callback,
+	          (intptr_t *) &sweep_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_sweep_logical_volumes(
+	          volume_group,
+	          0x00008000UL,
+	          NULL,
+	          (intptr_t *) &sweep_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvslvm_internal_volume_group_free(
+	          (libvslvm_internal_volume_group_t **) &volume_group,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "volume_group",
+	 volume_group );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( logical_volume != NULL )
+	{
+		libvslvm_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( volume_group != NULL )
+	{
+		libvslvm_internal_volume_group_free(
+		 (libvslvm_internal_volume_group_t **) &volume_group,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libvslvm_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the libvslvm_volume_group_sweep_physical_volume_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int vslvm_test_volume_group_sweep_physical_volume_file_io_handle(
      void )
 {
-	libcerror_error_t *error              = NULL;
-	libvslvm_volume_group_t *volume_group = NULL;
-	int number_of_logical_volumes         = 0;
-	int number_of_logical_volumes_is_set  = 0;
-	int result                            = 0;
+	/* The first bytes of the data contain the 4 KiB block number of the physical volume,
+	 * the striped logical volume "lv1" at physical volume offset 0x00040000 is not swept
+	 */
+	off64_t expected_logical_volume_offsets[ 6 ] = {
+		0, 0x00008000UL, 0x00010000UL, 0x00018000UL, 0x00020000UL, 0x00028000UL };
+
+	uint8_t expected_first_bytes[ 6 ] = {
+		0x20, 0x28, 0x30, 0x38, 0x68, 0x70 };
+
+	vslvm_test_sweep_values_t sweep_values;
+
+	libbfio_handle_t *file_io_handle                        = NULL;
+	libbfio_pool_t *file_io_pool                            = NULL;
+	libcerror_error_t *error                                = NULL;
+	libvslvm_io_handle_t *io_handle                         = NULL;
+	libvslvm_logical_volume_values_t *logical_volume_values = NULL;
+	libvslvm_volume_group_t *volume_group                   = NULL;
+	uint8_t *data                                           = NULL;
+	int call_index                                          = 0;
+	int result                                              = 0;
 
 	/* Initialize test
 	 */
-	result = libvslvm_volume_group_initialize(
+	result = vslvm_test_create_volume_group(
 	          &volume_group,
+	          &logical_volume_values,
 	          &error );
 
 	VSLVM_TEST_ASSERT_EQUAL_INT(
@@ -920,29 +4107,164 @@ int vslvm_test_volume_group_get_number_of_logical_volumes(
 	 "error",
 	 error );
 
+	result = vslvm_test_open_volume_group(
+	          volume_group,
+	          &io_handle,
+	          &file_io_pool,
+	          &data,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The physical volume data is read using a separate file IO handle
+	 */
+	result = libbfio_memory_range_initialize(
+	          &file_io_handle,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          file_io_handle,
+	          data,
+	          VSLVM_TEST_PHYSICAL_VOLUME_DATA_SIZE,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test regular cases
 	 */
-	result = libvslvm_volume_group_get_number_of_logical_volumes(
+	memory_set(
+	 &sweep_values,
+	 0,
+	 sizeof( vslvm_test_sweep_values_t ) );
+
+	sweep_values.callback_result = 1;
+
+	result = libvslvm_volume_group_sweep_physical_volume_file_io_handle(
 	          volume_group,
-	          &number_of_logical_volumes,
+	          0,
+	          file_io_handle,
+	          0x00008000UL,
+	          &vslvm_test_volume_group_sweep_write_callback,
+	          (intptr_t *) &sweep_values,
 	          &error );
 
-	VSLVM_TEST_ASSERT_NOT_EQUAL_INT(
+	VSLVM_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	VSLVM_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	number_of_logical_volumes_is_set = result;
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "sweep_values.number_of_calls",
+	 sweep_values.number_of_calls,
+	 6 );
+
+	for( call_index = 0;
+	     call_index < 6;
+	     call_index++ )
+	{
+		VSLVM_TEST_ASSERT_EQUAL_INT(
+		 "sweep_values.logical_volume_indexes[ call_index ]",
+		 sweep_values.logical_volume_indexes[ call_index ],
+		 0 );
+
+		VSLVM_TEST_ASSERT_EQUAL_INT64(
+		 "sweep_values.logical_volume_offsets[ call_index ]",
+		 (int64_t) sweep_values.logical_volume_offsets[ call_index ],
+		 (int64_t) expected_logical_volume_offsets[ call_index ] );
+
+		VSLVM_TEST_ASSERT_EQUAL_UINT8(
+		 "sweep_values.first_bytes[ call_index ]",
+		 sweep_values.first_bytes[ call_index ],
+		 expected_first_bytes[ call_index ] );
+	}
+	/* Test the write callback stopping the sweep
+	 */
+	memory_set(
+	 &sweep_values,
+	 0,
+	 sizeof( vslvm_test_sweep_values_t ) );
+
+	sweep_values.callback_result = 0;
+
+	result = libvslvm_volume_group_sweep_physical_volume_file_io_handle(
+	          volume_group,
+	          0,
+	          file_io_handle,
+	          0x00008000UL,
+	          &vslvm_test_volume_group_sweep_write_callback,
+	          (intptr_t *) &sweep_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "sweep_values.number_of_calls",
+	 sweep_values.number_of_calls,
+	 1 );
 
 	/* Test error cases
 	 */
-	result = libvslvm_volume_group_get_number_of_logical_volumes(
+	sweep_values.callback_result = 1;
+
+	result = libvslvm_volume_group_sweep_physical_volume_file_io_handle(
 	          NULL,
-	          &number_of_logical_volumes,
+	          0,
+	          file_io_handle,
+	          0x00008000UL,
+	          &vslvm_test_volume_group_sweep_write_callback,
+	          (intptr_t *) &sweep_values,
 	          &error );
 
 	VSLVM_TEST_ASSERT_EQUAL_INT(
@@ -957,27 +4279,122 @@ int vslvm_test_volume_group_get_number_of_logical_volumes(
 	libcerror_error_free(
 	 &error );
 
-	if( number_of_logical_volumes_is_set != 0 )
-	{
-		result = libvslvm_volume_group_get_number_of_logical_volumes(
-		          volume_group,
-		          NULL,
-		          &error );
+	result = libvslvm_volume_group_sweep_physical_volume_file_io_handle(
+	          volume_group,
+	          1,
+	          file_io_handle,
+	          0x00008000UL,
+	          &vslvm_test_volume_group_sweep_write_callback,
+	          (intptr_t *) &sweep_values,
+	          &error );
 
-		VSLVM_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		VSLVM_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_sweep_physical_volume_file_io_handle(
+	          volume_group,
+	          0,
+	          NULL,
+	          0x00008000UL,
+	          &vslvm_test_volume_group_sweep_write_callback,
+	          (intptr_t *) &sweep_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_sweep_physical_volume_file_io_handle(
+	          volume_group,
+	          0,
+	          file_io_handle,
+	          0,
+	          &vslvm_test_volume_group_sweep_write_callback,
+	          (intptr_t *) &sweep_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvslvm_volume_group_sweep_physical_volume_file_io_handle(
+	          volume_group,
+	          0,
+	          file_io_handle,
+	          0x00008000UL,
+	          NULL,
+	          (intptr_t *) &sweep_values,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSLVM_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
-		libcerror_error_free(
-		 &error );
-	}
 	/* Clean up
 	 */
+	result = libbfio_handle_close(
+	          file_io_handle,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libvslvm_internal_volume_group_free(
 	          (libvslvm_internal_volume_group_t **) &volume_group,
 	          &error );
@@ -995,6 +4412,35 @@ int vslvm_test_volume_group_get_number_of_logical_volumes(
 	 "error",
 	 error );
 
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvslvm_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	VSLVM_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSLVM_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
 	return( 1 );
 
 on_error:
@@ -1003,12 +4449,35 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
 	if( volume_group != NULL )
 	{
 		libvslvm_internal_volume_group_free(
 		 (libvslvm_internal_volume_group_t **) &volume_group,
 		 NULL );
 	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libvslvm_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
 	return( 0 );
 }
 
@@ -1075,7 +4544,13 @@ int main(
 
 	/* TODO: add tests for libvslvm_volume_group_get_physical_volume */
 
-	/* TODO: add tests for libvslvm_volume_group_get_physical_volume_by_name */
+	VSLVM_TEST_RUN(
+	 "libvslvm_volume_group_get_physical_volume_by_name",
+	 vslvm_test_volume_group_get_physical_volume_by_name );
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_volume_group_get_physical_volume_by_identifier",
+	 vslvm_test_volume_group_get_physical_volume_by_identifier );
 
 	/* TODO: add tests for libvslvm_volume_group_append_physical_volume */
 
@@ -1085,6 +4560,54 @@ int main(
 
 	/* TODO: add tests for libvslvm_volume_group_get_logical_volume */
 
+	VSLVM_TEST_RUN(
+	 "libvslvm_volume_group_get_logical_volume_by_name",
+	 vslvm_test_volume_group_get_logical_volume_by_name );
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_volume_group_get_logical_volume_by_identifier",
+	 vslvm_test_volume_group_get_logical_volume_by_identifier );
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_volume_group_get_logical_volume_name_size_by_index",
+	 vslvm_test_volume_group_get_logical_volume_name_size_by_index );
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_volume_group_get_logical_volume_name_by_index",
+	 vslvm_test_volume_group_get_logical_volume_name_by_index );
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_volume_group_get_logical_volume_identifier_size_by_index",
+	 vslvm_test_volume_group_get_logical_volume_identifier_size_by_index );
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_volume_group_get_logical_volume_identifier_by_index",
+	 vslvm_test_volume_group_get_logical_volume_identifier_by_index );
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_volume_group_get_logical_volume_number_of_segments_by_index",
+	 vslvm_test_volume_group_get_logical_volume_number_of_segments_by_index );
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_volume_group_get_logical_volume_segment_by_index",
+	 vslvm_test_volume_group_get_logical_volume_segment_by_index );
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_volume_group_get_unallocated_volume",
+	 vslvm_test_volume_group_get_unallocated_volume );
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_volume_group_get_data_area_volume",
+	 vslvm_test_volume_group_get_data_area_volume );
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_volume_group_sweep_logical_volumes",
+	 vslvm_test_volume_group_sweep_logical_volumes );
+
+	VSLVM_TEST_RUN(
+	 "libvslvm_volume_group_sweep_physical_volume_file_io_handle",
+	 vslvm_test_volume_group_sweep_physical_volume_file_io_handle );
+
 	/* TODO: add tests for libvslvm_volume_group_append_logical_volume */
 
 #endif /* defined( __GNUC__ ) && !defined( LIBVSLVM_DLL_IMPORT ) */
@@ -0,0 +1,2999 @@
+/*
+ * Bench handle
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_SYS_TIME_H )
+#include <sys/time.h>
+#endif
+
+#include <time.h>
+
+#include "bench_handle.h"
+#include "byte_size_string.h"
+#include "vslvmtools_libbfio.h"
+#include "vslvmtools_libcerror.h"
+#include "vslvmtools_libclocale.h"
+#include "vslvmtools_libcnotify.h"
+#include "vslvmtools_libcthreads.h"
+#include "vslvmtools_libvslvm.h"
+
+#if !defined( LIBVSLVM_HAVE_BFIO )
+
+LIBVSLVM_EXTERN \
+int libvslvm_handle_open_file_io_handle(
+     libvslvm_handle_t *handle,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libvslvm_error_t **error );
+
+LIBVSLVM_EXTERN \
+int libvslvm_handle_open_physical_volume_files_file_io_pool(
+     libvslvm_handle_t *handle,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBVSLVM_HAVE_BFIO ) */
+
+#define BENCH_HANDLE_NOTIFY_STREAM	stdout
+
+/* Copies a string of a decimal value to a 64-bit value
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_system_string_copy_from_64_bit_in_decimal(
+     const system_character_t *string,
+     size_t string_size,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function              = "bench_handle_system_string_copy_from_64_bit_in_decimal";
+	size_t string_index                = 0;
+	system_character_t character_value = 0;
+	uint8_t maximum_string_index       = 20;
+	int8_t sign                        = 1;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	*value_64bit = 0;
+
+	if( string[ string_index ] == (system_character_t) '-' )
+	{
+		string_index++;
+		maximum_string_index++;
+
+		sign = -1;
+	}
+	else if( string[ string_index ] == (system_character_t) '+' )
+	{
+		string_index++;
+		maximum_string_index++;
+	}
+	while( string_index < string_size )
+	{
+		if( string[ string_index ] == 0 )
+		{
+			break;
+		}
+		if( string_index > (size_t) maximum_string_index )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_LARGE,
+			 "%s: string too large.",
+			 function );
+
+			return( -1 );
+		}
+		*value_64bit *= 10;
+
+		if( ( string[ string_index ] >= (system_character_t) '0' )
+		 && ( string[ string_index ] <= (system_character_t) '9' ) )
+		{
+			character_value = (system_character_t) ( string[ string_index ] - (system_character_t) '0' );
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character value: %" PRIc_SYSTEM " at index: %d.",
+			 function,
+			 string[ string_index ],
+			 string_index );
+
+			return( -1 );
+		}
+		*value_64bit += character_value;
+
+		string_index++;
+	}
+	if( sign == -1 )
+	{
+		*value_64bit *= (uint64_t) -1;
+	}
+	return( 1 );
+}
+
+/* Creates a bench handle
+ * Make sure the value bench_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_initialize(
+     bench_handle_t **bench_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_initialize";
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bench_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid bench handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*bench_handle = memory_allocate_structure(
+	                 bench_handle_t );
+
+	if( *bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create bench handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *bench_handle,
+	     0,
+	     sizeof( bench_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear bench handle.",
+		 function );
+
+		memory_free(
+		 *bench_handle );
+
+		*bench_handle = NULL;
+
+		return( -1 );
+	}
+	( *bench_handle )->number_of_iterations = BENCH_HANDLE_DEFAULT_NUMBER_OF_ITERATIONS;
+	( *bench_handle )->read_size            = BENCH_HANDLE_DEFAULT_READ_SIZE;
+	( *bench_handle )->number_of_threads    = BENCH_HANDLE_DEFAULT_NUMBER_OF_THREADS;
+	( *bench_handle )->output_format        = BENCH_HANDLE_OUTPUT_FORMAT_TEXT;
+	( *bench_handle )->notify_stream        = BENCH_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *bench_handle != NULL )
+	{
+		memory_free(
+		 *bench_handle );
+
+		*bench_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a bench handle
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_free(
+     bench_handle_t **bench_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_free";
+	int result            = 1;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bench_handle != NULL )
+	{
+		if( ( *bench_handle )->physical_volume_file_io_pool != NULL )
+		{
+			if( bench_handle_close_input(
+			     *bench_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close input.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *bench_handle );
+
+		*bench_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the bench handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_signal_abort(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_signal_abort";
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	bench_handle->abort = 1;
+
+	if( bench_handle->input_handle != NULL )
+	{
+		if( libvslvm_handle_signal_abort(
+		     bench_handle->input_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal input handle to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the volume offset
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_set_volume_offset(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_set_volume_offset";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( bench_handle_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	bench_handle->volume_offset = (off64_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the index of the logical volume to read
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int bench_handle_set_logical_volume_index(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_set_logical_volume_index";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( bench_handle_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit > (uint64_t) INT_MAX )
+	{
+		return( 0 );
+	}
+	bench_handle->logical_volume_index = (int) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the number of open iterations
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int bench_handle_set_number_of_iterations(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_set_number_of_iterations";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( bench_handle_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > (uint64_t) BENCH_HANDLE_MAXIMUM_NUMBER_OF_ITERATIONS ) )
+	{
+		return( 0 );
+	}
+	bench_handle->number_of_iterations = (int) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the number of bytes to read per read benchmark
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int bench_handle_set_read_size(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_set_read_size";
+	size_t string_length  = 0;
+	uint64_t size_value   = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( byte_size_string_convert(
+	     string,
+	     string_length,
+	     &size_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to convert read size string.",
+		 function );
+
+		return( -1 );
+	}
+	/* The latency of every read is stored hence the read size is bound by the smallest read block size
+	 */
+	if( ( size_value < 4096 )
+	 || ( ( size_value / 4096 ) > (uint64_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) ) )
+	{
+		return( 0 );
+	}
+	bench_handle->read_size = (size64_t) size_value;
+
+	return( 1 );
+}
+
+/* Sets the number of read threads
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int bench_handle_set_number_of_threads(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_set_number_of_threads";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( bench_handle_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( value_64bit > (uint64_t) BENCH_HANDLE_MAXIMUM_NUMBER_OF_THREADS )
+#else
+	if( value_64bit != 0 )
+#endif
+	{
+		return( 0 );
+	}
+	bench_handle->number_of_threads = (int) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the output format
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int bench_handle_set_output_format(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_set_output_format";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 3 )
+	{
+		if( system_string_compare_no_case(
+		     string,
+		     _SYSTEM_STRING( "csv" ),
+		     3 ) == 0 )
+		{
+			bench_handle->output_format = BENCH_HANDLE_OUTPUT_FORMAT_CSV;
+			result                      = 1;
+		}
+	}
+	else if( string_length == 4 )
+	{
+		if( system_string_compare_no_case(
+		     string,
+		     _SYSTEM_STRING( "json" ),
+		     4 ) == 0 )
+		{
+			bench_handle->output_format = BENCH_HANDLE_OUTPUT_FORMAT_JSON;
+			result                      = 1;
+		}
+		else if( system_string_compare_no_case(
+		          string,
+		          _SYSTEM_STRING( "text" ),
+		          4 ) == 0 )
+		{
+			bench_handle->output_format = BENCH_HANDLE_OUTPUT_FORMAT_TEXT;
+			result                      = 1;
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the current time of a monotonic clock in nanoseconds
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_get_current_time(
+     uint64_t *current_time,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+#elif defined( HAVE_CLOCK_GETTIME )
+	struct timespec time_structure;
+#endif
+
+	static char *function = "bench_handle_get_current_time";
+
+#if !defined( WINAPI ) && !defined( HAVE_CLOCK_GETTIME )
+	time_t timestamp      = 0;
+#endif
+
+	if( current_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current time.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( QueryPerformanceCounter(
+	       &counter ) == 0 )
+	 || ( frequency.QuadPart <= 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve performance counter.",
+		 function );
+
+		return( -1 );
+	}
+	*current_time = ( (uint64_t) ( counter.QuadPart / frequency.QuadPart ) * 1000000000 )
+	              + ( ( (uint64_t) ( counter.QuadPart % frequency.QuadPart ) * 1000000000 ) / (uint64_t) frequency.QuadPart );
+
+#elif defined( HAVE_CLOCK_GETTIME )
+#if defined( CLOCK_MONOTONIC )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_structure ) != 0 )
+#else
+	if( clock_gettime(
+	     CLOCK_REALTIME,
+	     &time_structure ) != 0 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time structure.",
+		 function );
+
+		return( -1 );
+	}
+	*current_time = ( (uint64_t) time_structure.tv_sec * 1000000000 ) + (uint64_t) time_structure.tv_nsec;
+
+#else
+	timestamp = time(
+	             NULL );
+
+	if( timestamp == (time_t) -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		return( -1 );
+	}
+	*current_time = (uint64_t) timestamp * 1000000000;
+
+#endif /* defined( WINAPI ) */
+
+	return( 1 );
+}
+
+/* Retrieves the next value of a xorshift64* pseudo random number generator
+ * The random state must not be 0
+ * Returns the random value
+ */
+uint64_t bench_handle_get_random_value(
+          uint64_t *random_state )
+{
+	uint64_t value_64bit = 0;
+
+	if( random_state == NULL )
+	{
+		return( 0 );
+	}
+	value_64bit = *random_state;
+
+	value_64bit ^= value_64bit >> 12;
+	value_64bit ^= value_64bit << 25;
+	value_64bit ^= value_64bit >> 27;
+
+	*random_state = value_64bit;
+
+	return( value_64bit * 0x2545f4914f6cdd1dULL );
+}
+
+/* Opens the input and retrieves the logical volume
+ * The times of the open phases are measured in nanoseconds, where opening the handle
+ * reads the physical volume label and parses the metadata
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_open_input(
+     bench_handle_t *bench_handle,
+     const system_character_t *filename,
+     uint64_t *open_handle_time,
+     uint64_t *open_physical_volumes_time,
+     uint64_t *open_logical_volume_time,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle      = NULL;
+	libvslvm_volume_group_t *volume_group = NULL;
+	static char *function                 = "bench_handle_open_input";
+	size_t filename_length                = 0;
+	uint64_t end_time                     = 0;
+	uint64_t start_time                   = 0;
+	int entry_index                       = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle->physical_volume_file_io_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid bench handle - physical volume file IO pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle->input_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid bench handle - input handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( open_handle_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid open handle time.",
+		 function );
+
+		return( -1 );
+	}
+	if( open_physical_volumes_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid open physical volumes time.",
+		 function );
+
+		return( -1 );
+	}
+	if( open_logical_volume_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid open logical volume time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_range_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_range_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#else
+	if( libbfio_file_range_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to set name of file IO handle: 0.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_range_set(
+	     file_io_handle,
+	     bench_handle->volume_offset,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to set volume offset of file IO handle: 0.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvslvm_handle_initialize(
+	     &( bench_handle->input_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_get_current_time(
+	     &start_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve start time.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvslvm_handle_open_file_io_handle(
+	     bench_handle->input_handle,
+	     file_io_handle,
+	     LIBVSLVM_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_get_current_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve end time.",
+		 function );
+
+		goto on_error;
+	}
+	*open_handle_time = end_time - start_time;
+
+	if( libbfio_pool_initialize(
+	     &( bench_handle->physical_volume_file_io_pool ),
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize physical volume file IO pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_pool_append_handle(
+	     bench_handle->physical_volume_file_io_pool,
+	     &entry_index,
+	     file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The file IO pool takes over management of the file IO handle
+	 */
+	file_io_handle = NULL;
+
+	if( bench_handle_get_current_time(
+	     &start_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve start time.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvslvm_handle_open_physical_volume_files_file_io_pool(
+	     bench_handle->input_handle,
+	     bench_handle->physical_volume_file_io_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open physical volume files.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_get_current_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve end time.",
+		 function );
+
+		goto on_error;
+	}
+	*open_physical_volumes_time = end_time - start_time;
+
+	start_time = end_time;
+
+	if( libvslvm_handle_get_volume_group(
+	     bench_handle->input_handle,
+	     &volume_group,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume group.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvslvm_volume_group_get_logical_volume(
+	     volume_group,
+	     bench_handle->logical_volume_index,
+	     &( bench_handle->logical_volume ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume: %d.",
+		 function,
+		 bench_handle->logical_volume_index );
+
+		goto on_error;
+	}
+	if( bench_handle_get_current_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve end time.",
+		 function );
+
+		goto on_error;
+	}
+	*open_logical_volume_time = end_time - start_time;
+
+	if( libvslvm_volume_group_free(
+	     &volume_group,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free volume group.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvslvm_logical_volume_get_size(
+	     bench_handle->logical_volume,
+	     &( bench_handle->logical_volume_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume size.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( bench_handle->logical_volume != NULL )
+	{
+		libvslvm_logical_volume_free(
+		 &( bench_handle->logical_volume ),
+		 NULL );
+	}
+	if( volume_group != NULL )
+	{
+		libvslvm_volume_group_free(
+		 &volume_group,
+		 NULL );
+	}
+	if( bench_handle->input_handle != NULL )
+	{
+		libvslvm_handle_free(
+		 &( bench_handle->input_handle ),
+		 NULL );
+	}
+	/* The file IO pool must be freed after the input handle
+	 */
+	if( bench_handle->physical_volume_file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &( bench_handle->physical_volume_file_io_pool ),
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes the input
+ * Returns the 0 if successful or -1 on error
+ */
+int bench_handle_close_input(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_close_input";
+	int result            = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle->physical_volume_file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid bench handle - missing physical volume file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle->input_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid bench handle - missing input handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle->logical_volume != NULL )
+	{
+		if( libvslvm_logical_volume_free(
+		     &( bench_handle->logical_volume ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free logical volume.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libvslvm_handle_close(
+	     bench_handle->input_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input handle.",
+		 function );
+
+		result = -1;
+	}
+	if( libvslvm_handle_free(
+	     &( bench_handle->input_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free input handle.",
+		 function );
+
+		result = -1;
+	}
+	if( libbfio_pool_close_all(
+	     bench_handle->physical_volume_file_io_pool,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close physical volume file IO pool.",
+		 function );
+
+		result = -1;
+	}
+	if( libbfio_pool_free(
+	     &( bench_handle->physical_volume_file_io_pool ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free physical volume file IO pool.",
+		 function );
+
+		result = -1;
+	}
+	bench_handle->logical_volume_size = 0;
+
+	return( result );
+}
+
+/* Compares two latencies
+ * Callback function to sort the latencies
+ * Returns -1 if the first latency is smaller, 0 if equal or 1 if greater
+ */
+int bench_handle_compare_latencies(
+     const uint64_t *first_latency,
+     const uint64_t *second_latency )
+{
+	if( *first_latency < *second_latency )
+	{
+		return( -1 );
+	}
+	else if( *first_latency > *second_latency )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Appends a benchmark result
+ * The latencies are sorted to determine the percentiles
+ * The chunk cache statistics are only set if the chunk cache was used
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_append_result(
+     bench_handle_t *bench_handle,
+     const char *name,
+     uint64_t *latencies,
+     uint64_t number_of_latencies,
+     uint64_t number_of_bytes,
+     uint64_t elapsed_time,
+     uint64_t number_of_cache_hits,
+     uint64_t number_of_cache_misses,
+     libcerror_error_t **error )
+{
+	bench_handle_result_t *result = NULL;
+	static char *function         = "bench_handle_append_result";
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bench_handle->number_of_results < 0 )
+	 || ( bench_handle->number_of_results >= BENCH_HANDLE_MAXIMUM_NUMBER_OF_RESULTS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid bench handle - number of results value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( latencies == NULL )
+	 && ( number_of_latencies > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid latencies.",
+		 function );
+
+		return( -1 );
+	}
+	result = &( bench_handle->results[ bench_handle->number_of_results ] );
+
+	if( memory_set(
+	     result,
+	     0,
+	     sizeof( bench_handle_result_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear result.",
+		 function );
+
+		return( -1 );
+	}
+	result->name                 = name;
+	result->number_of_operations = number_of_latencies;
+	result->number_of_bytes      = number_of_bytes;
+	result->elapsed_time         = elapsed_time;
+
+	if( number_of_latencies > 0 )
+	{
+		qsort(
+		 latencies,
+		 (size_t) number_of_latencies,
+		 sizeof( uint64_t ),
+		 (int (*)(const void *, const void *)) &bench_handle_compare_latencies );
+
+		/* The percentiles are determined using the nearest rank
+		 */
+		result->minimum_latency      = latencies[ 0 ];
+		result->median_latency       = latencies[ ( ( number_of_latencies * 50 ) + 99 ) / 100 - 1 ];
+		result->percentile90_latency = latencies[ ( ( number_of_latencies * 90 ) + 99 ) / 100 - 1 ];
+		result->percentile99_latency = latencies[ ( ( number_of_latencies * 99 ) + 99 ) / 100 - 1 ];
+		result->maximum_latency      = latencies[ number_of_latencies - 1 ];
+	}
+	if( ( number_of_cache_hits > 0 )
+	 || ( number_of_cache_misses > 0 ) )
+	{
+		result->has_cache_statistics   = 1;
+		result->number_of_cache_hits   = number_of_cache_hits;
+		result->number_of_cache_misses = number_of_cache_misses;
+	}
+	bench_handle->number_of_results += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the chunk cache statistics of the logical volume
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_get_cache_statistics(
+     bench_handle_t *bench_handle,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_get_cache_statistics";
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvslvm_logical_volume_get_chunk_cache_statistics(
+	     bench_handle->logical_volume,
+	     number_of_hits,
+	     number_of_misses,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk cache statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the logical volume
+ * Reads of the block size are either done sequentially from the start of the logical volume
+ * or at random block aligned offsets. The latency of every read is stored in the read value
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int bench_handle_read(
+     bench_handle_t *bench_handle,
+     bench_handle_read_value_t *read_value,
+     uint8_t random_offsets,
+     libcerror_error_t **error )
+{
+	uint8_t *buffer           = NULL;
+	static char *function     = "bench_handle_read";
+	off64_t read_offset       = 0;
+	ssize_t read_count        = 0;
+	uint64_t end_time         = 0;
+	uint64_t number_of_blocks = 0;
+	uint64_t read_index       = 0;
+	uint64_t start_time       = 0;
+	int result                = 1;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read value.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_value->logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid read value - missing logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( read_value->block_size == 0 )
+	 || ( read_value->block_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read value - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( read_value->latencies == NULL )
+	 && ( read_value->number_of_reads > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid read value - missing latencies.",
+		 function );
+
+		return( -1 );
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * read_value->block_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_blocks = bench_handle->logical_volume_size / read_value->block_size;
+
+	for( read_index = 0;
+	     read_index < read_value->number_of_reads;
+	     read_index++ )
+	{
+		if( bench_handle->abort != 0 )
+		{
+			result = 0;
+
+			break;
+		}
+		if( random_offsets == 0 )
+		{
+			read_offset = (off64_t) ( read_index * read_value->block_size );
+		}
+		else if( number_of_blocks > 0 )
+		{
+			read_offset = (off64_t) ( ( bench_handle_get_random_value(
+			                             &( read_value->random_state ) ) % number_of_blocks ) * read_value->block_size );
+		}
+		if( bench_handle_get_current_time(
+		     &start_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve start time.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libvslvm_logical_volume_read_buffer_at_offset(
+		              read_value->logical_volume,
+		              buffer,
+		              read_value->block_size,
+		              read_offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 read_offset,
+			 read_offset );
+
+			goto on_error;
+		}
+		if( bench_handle_get_current_time(
+		     &end_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve end time.",
+			 function );
+
+			goto on_error;
+		}
+		read_value->latencies[ read_index ] = end_time - start_time;
+		read_value->number_of_bytes        += (uint64_t) read_count;
+	}
+	/* Only the latencies of the reads that were done are kept
+	 */
+	read_value->number_of_reads = read_index;
+
+	memory_free(
+	 buffer );
+
+	return( result );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
+/* Benchmarks opening the input
+ * The input is opened and closed for the number of iterations and remains open after the last iteration
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int bench_handle_benchmark_open(
+     bench_handle_t *bench_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	uint64_t *open_handle_times           = NULL;
+	uint64_t *open_logical_volume_times   = NULL;
+	uint64_t *open_physical_volumes_times = NULL;
+	static char *function                 = "bench_handle_benchmark_open";
+	uint64_t elapsed_time                 = 0;
+	int iteration                         = 0;
+	int result                            = 1;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bench_handle->number_of_iterations <= 0 )
+	 || ( bench_handle->number_of_iterations > BENCH_HANDLE_MAXIMUM_NUMBER_OF_ITERATIONS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid bench handle - number of iterations value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	open_handle_times = (uint64_t *) memory_allocate(
+	                                  sizeof( uint64_t ) * bench_handle->number_of_iterations );
+
+	if( open_handle_times == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create open handle times.",
+		 function );
+
+		goto on_error;
+	}
+	open_physical_volumes_times = (uint64_t *) memory_allocate(
+	                                            sizeof( uint64_t ) * bench_handle->number_of_iterations );
+
+	if( open_physical_volumes_times == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create open physical volumes times.",
+		 function );
+
+		goto on_error;
+	}
+	open_logical_volume_times = (uint64_t *) memory_allocate(
+	                                          sizeof( uint64_t ) * bench_handle->number_of_iterations );
+
+	if( open_logical_volume_times == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create open logical volume times.",
+		 function );
+
+		goto on_error;
+	}
+	for( iteration = 0;
+	     iteration < bench_handle->number_of_iterations;
+	     iteration++ )
+	{
+		if( bench_handle->abort != 0 )
+		{
+			result = 0;
+
+			break;
+		}
+		if( bench_handle_open_input(
+		     bench_handle,
+		     filename,
+		     &( open_handle_times[ iteration ] ),
+		     &( open_physical_volumes_times[ iteration ] ),
+		     &( open_logical_volume_times[ iteration ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open input in iteration: %d.",
+			 function,
+			 iteration );
+
+			goto on_error;
+		}
+		if( iteration < ( bench_handle->number_of_iterations - 1 ) )
+		{
+			if( bench_handle_close_input(
+			     bench_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close input in iteration: %d.",
+				 function,
+				 iteration );
+
+				goto on_error;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		for( iteration = 0, elapsed_time = 0;
+		     iteration < bench_handle->number_of_iterations;
+		     iteration++ )
+		{
+			elapsed_time += open_handle_times[ iteration ];
+		}
+		if( bench_handle_append_result(
+		     bench_handle,
+		     "open_handle",
+		     open_handle_times,
+		     (uint64_t) bench_handle->number_of_iterations,
+		     0,
+		     elapsed_time,
+		     0,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append open handle result.",
+			 function );
+
+			goto on_error;
+		}
+		for( iteration = 0, elapsed_time = 0;
+		     iteration < bench_handle->number_of_iterations;
+		     iteration++ )
+		{
+			elapsed_time += open_physical_volumes_times[ iteration ];
+		}
+		if( bench_handle_append_result(
+		     bench_handle,
+		     "open_physical_volumes",
+		     open_physical_volumes_times,
+		     (uint64_t) bench_handle->number_of_iterations,
+		     0,
+		     elapsed_time,
+		     0,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append open physical volumes result.",
+			 function );
+
+			goto on_error;
+		}
+		for( iteration = 0, elapsed_time = 0;
+		     iteration < bench_handle->number_of_iterations;
+		     iteration++ )
+		{
+			elapsed_time += open_logical_volume_times[ iteration ];
+		}
+		if( bench_handle_append_result(
+		     bench_handle,
+		     "open_logical_volume",
+		     open_logical_volume_times,
+		     (uint64_t) bench_handle->number_of_iterations,
+		     0,
+		     elapsed_time,
+		     0,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append open logical volume result.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 open_logical_volume_times );
+
+	memory_free(
+	 open_physical_volumes_times );
+
+	memory_free(
+	 open_handle_times );
+
+	return( result );
+
+on_error:
+	if( open_logical_volume_times != NULL )
+	{
+		memory_free(
+		 open_logical_volume_times );
+	}
+	if( open_physical_volumes_times != NULL )
+	{
+		memory_free(
+		 open_physical_volumes_times );
+	}
+	if( open_handle_times != NULL )
+	{
+		memory_free(
+		 open_handle_times );
+	}
+	return( -1 );
+}
+
+/* Benchmarks reading the logical volume in a single thread
+ * Sequential reads are bound by the size of the logical volume
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int bench_handle_benchmark_read(
+     bench_handle_t *bench_handle,
+     const char *name,
+     size_t block_size,
+     uint8_t random_offsets,
+     libcerror_error_t **error )
+{
+	bench_handle_read_value_t read_value;
+
+	static char *function           = "bench_handle_benchmark_read";
+	size64_t read_size              = 0;
+	uint64_t end_number_of_hits     = 0;
+	uint64_t end_number_of_misses   = 0;
+	uint64_t end_time               = 0;
+	uint64_t start_number_of_hits   = 0;
+	uint64_t start_number_of_misses = 0;
+	uint64_t start_time             = 0;
+	int result                      = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid block size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &read_value,
+	     0,
+	     sizeof( bench_handle_read_value_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read value.",
+		 function );
+
+		return( -1 );
+	}
+	read_size = bench_handle->read_size;
+
+	if( ( random_offsets == 0 )
+	 && ( read_size > bench_handle->logical_volume_size ) )
+	{
+		read_size = bench_handle->logical_volume_size;
+	}
+	read_value.bench_handle    = bench_handle;
+	read_value.logical_volume  = bench_handle->logical_volume;
+	read_value.block_size      = block_size;
+	read_value.number_of_reads = ( read_size + block_size - 1 ) / block_size;
+	read_value.random_state    = BENCH_HANDLE_RANDOM_SEED;
+
+	if( read_value.number_of_reads > 0 )
+	{
+		if( read_value.number_of_reads > (uint64_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of reads value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		read_value.latencies = (uint64_t *) memory_allocate(
+		                                     sizeof( uint64_t ) * (size_t) read_value.number_of_reads );
+
+		if( read_value.latencies == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create latencies.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( bench_handle_get_cache_statistics(
+	     bench_handle,
+	     &start_number_of_hits,
+	     &start_number_of_misses,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve start cache statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_get_current_time(
+	     &start_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve start time.",
+		 function );
+
+		goto on_error;
+	}
+	result = bench_handle_read(
+	          bench_handle,
+	          &read_value,
+	          random_offsets,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read logical volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_get_current_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve end time.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_get_cache_statistics(
+	     bench_handle,
+	     &end_number_of_hits,
+	     &end_number_of_misses,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve end cache statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( result == 1 )
+	{
+		if( bench_handle_append_result(
+		     bench_handle,
+		     name,
+		     read_value.latencies,
+		     read_value.number_of_reads,
+		     read_value.number_of_bytes,
+		     end_time - start_time,
+		     end_number_of_hits - start_number_of_hits,
+		     end_number_of_misses - start_number_of_misses,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append result.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( read_value.latencies != NULL )
+	{
+		memory_free(
+		 read_value.latencies );
+	}
+	return( result );
+
+on_error:
+	if( read_value.latencies != NULL )
+	{
+		memory_free(
+		 read_value.latencies );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Reads the logical volume at random offsets
+ * Callback function for the read threads
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_read_thread_callback(
+     bench_handle_read_value_t *read_value )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "bench_handle_read_thread_callback";
+	int result               = 1;
+
+	if( read_value == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read value.",
+		 function );
+
+		result = -1;
+	}
+	else if( bench_handle_read(
+	          read_value->bench_handle,
+	          read_value,
+	          1,
+	          &error ) == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read logical volume.",
+		 function );
+
+		result = -1;
+	}
+	if( result != 1 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+
+		/* The read error is checked by the thread that joins the read threads
+		 */
+		if( ( read_value != NULL )
+		 && ( read_value->bench_handle != NULL ) )
+		{
+			read_value->bench_handle->read_error = 1;
+		}
+	}
+	return( result );
+}
+
+/* Benchmarks reading the logical volume at random offsets in multiple threads
+ * The reads of the read size are divided over the read threads
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int bench_handle_benchmark_threaded_read(
+     bench_handle_t *bench_handle,
+     const char *name,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	bench_handle_read_value_t *read_values = NULL;
+	libcthreads_thread_t **read_threads    = NULL;
+	libvslvm_volume_group_t *volume_group  = NULL;
+	uint64_t *latencies                    = NULL;
+	static char *function                  = "bench_handle_benchmark_threaded_read";
+	uint64_t end_time                      = 0;
+	uint64_t latency_index                 = 0;
+	uint64_t number_of_bytes               = 0;
+	uint64_t number_of_hits                = 0;
+	uint64_t number_of_latencies           = 0;
+	uint64_t number_of_misses              = 0;
+	uint64_t number_of_reads               = 0;
+	uint64_t read_index                    = 0;
+	uint64_t start_time                    = 0;
+	uint64_t thread_number_of_hits         = 0;
+	uint64_t thread_number_of_misses       = 0;
+	int result                             = 1;
+	int thread_index                       = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bench_handle->number_of_threads <= 0 )
+	 || ( bench_handle->number_of_threads > BENCH_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid bench handle - number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid block size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_reads = ( bench_handle->read_size / block_size ) / (uint64_t) bench_handle->number_of_threads;
+
+	if( number_of_reads == 0 )
+	{
+		number_of_reads = 1;
+	}
+	if( number_of_reads > (uint64_t) ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) / bench_handle->number_of_threads ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of reads value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every read thread stores its latencies in its own part of the latencies
+	 */
+	latencies = (uint64_t *) memory_allocate(
+	                          sizeof( uint64_t ) * (size_t) number_of_reads * bench_handle->number_of_threads );
+
+	if( latencies == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create latencies.",
+		 function );
+
+		goto on_error;
+	}
+	read_values = (bench_handle_read_value_t *) memory_allocate(
+	                                             sizeof( bench_handle_read_value_t ) * bench_handle->number_of_threads );
+
+	if( read_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read values.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     read_values,
+	     0,
+	     sizeof( bench_handle_read_value_t ) * bench_handle->number_of_threads ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read values.",
+		 function );
+
+		memory_free(
+		 read_values );
+
+		read_values = NULL;
+
+		goto on_error;
+	}
+	read_threads = (libcthreads_thread_t **) memory_allocate(
+	                                          sizeof( libcthreads_thread_t * ) * bench_handle->number_of_threads );
+
+	if( read_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read threads.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     read_threads,
+	     0,
+	     sizeof( libcthreads_thread_t * ) * bench_handle->number_of_threads ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read threads.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvslvm_handle_get_volume_group(
+	     bench_handle->input_handle,
+	     &volume_group,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume group.",
+		 function );
+
+		goto on_error;
+	}
+	for( thread_index = 0;
+	     thread_index < bench_handle->number_of_threads;
+	     thread_index++ )
+	{
+		/* Every read thread reads its own instance of the logical volume, that has
+		 * its own current offset, lock and chunk cache, and its own sequence of random offsets
+		 */
+		if( libvslvm_volume_group_get_logical_volume(
+		     volume_group,
+		     bench_handle->logical_volume_index,
+		     &( read_values[ thread_index ].logical_volume ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve logical volume: %d for read thread: %d.",
+			 function,
+			 bench_handle->logical_volume_index,
+			 thread_index );
+
+			goto on_error;
+		}
+		read_values[ thread_index ].bench_handle    = bench_handle;
+		read_values[ thread_index ].block_size      = block_size;
+		read_values[ thread_index ].number_of_reads = number_of_reads;
+		read_values[ thread_index ].latencies       = &( latencies[ number_of_reads * thread_index ] );
+		read_values[ thread_index ].number_of_bytes = 0;
+		read_values[ thread_index ].random_state    = BENCH_HANDLE_RANDOM_SEED + (uint64_t) thread_index;
+	}
+	if( libvslvm_volume_group_free(
+	     &volume_group,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free volume group.",
+		 function );
+
+		goto on_error;
+	}
+	bench_handle->read_error = 0;
+	if( bench_handle_get_current_time(
+	     &start_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve start time.",
+		 function );
+
+		goto on_error;
+	}
+	for( thread_index = 0;
+	     thread_index < bench_handle->number_of_threads;
+	     thread_index++ )
+	{
+		if( libcthreads_thread_create(
+		     &( read_threads[ thread_index ] ),
+		     NULL,
+		     (int (*)(void *)) &bench_handle_read_thread_callback,
+		     (void *) &( read_values[ thread_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create read thread: %d.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+	}
+	for( thread_index = 0;
+	     thread_index < bench_handle->number_of_threads;
+	     thread_index++ )
+	{
+		if( libcthreads_thread_join(
+		     &( read_threads[ thread_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join read thread: %d.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+	}
+	if( bench_handle_get_current_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve end time.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle->read_error != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read logical volume in read thread.",
+		 function );
+
+		goto on_error;
+	}
+	/* The chunk cache statistics are the sum of those of the logical volume of every read thread
+	 */
+	for( thread_index = 0;
+	     thread_index < bench_handle->number_of_threads;
+	     thread_index++ )
+	{
+		if( libvslvm_logical_volume_get_chunk_cache_statistics(
+		     read_values[ thread_index ].logical_volume,
+		     &thread_number_of_hits,
+		     &thread_number_of_misses,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk cache statistics of read thread: %d.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+		number_of_hits   += thread_number_of_hits;
+		number_of_misses += thread_number_of_misses;
+	}
+	if( bench_handle->abort != 0 )
+	{
+		result = 0;
+	}
+	else
+	{
+		/* Move the latencies of the read threads together, a read thread
+		 * can have done less reads if the benchmark was aborted
+		 */
+		for( thread_index = 0;
+		     thread_index < bench_handle->number_of_threads;
+		     thread_index++ )
+		{
+			for( read_index = 0;
+			     read_index < read_values[ thread_index ].number_of_reads;
+			     read_index++ )
+			{
+				latencies[ latency_index++ ] = read_values[ thread_index ].latencies[ read_index ];
+			}
+			number_of_bytes += read_values[ thread_index ].number_of_bytes;
+		}
+		number_of_latencies = latency_index;
+
+		if( bench_handle_append_result(
+		     bench_handle,
+		     name,
+		     latencies,
+		     number_of_latencies,
+		     number_of_bytes,
+		     end_time - start_time,
+		     number_of_hits,
+		     number_of_misses,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append result.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( thread_index = 0;
+	     thread_index < bench_handle->number_of_threads;
+	     thread_index++ )
+	{
+		if( libvslvm_logical_volume_free(
+		     &( read_values[ thread_index ].logical_volume ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free logical volume of read thread: %d.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 read_threads );
+
+	memory_free(
+	 read_values );
+
+	memory_free(
+	 latencies );
+
+	return( result );
+
+on_error:
+	if( read_threads != NULL )
+	{
+		/* Make sure the read threads that were created have finished before the read values are freed
+		 */
+		bench_handle->abort = 1;
+
+		for( thread_index = 0;
+		     thread_index < bench_handle->number_of_threads;
+		     thread_index++ )
+		{
+			if( read_threads[ thread_index ] != NULL )
+			{
+				libcthreads_thread_join(
+				 &( read_threads[ thread_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 read_threads );
+	}
+	if( volume_group != NULL )
+	{
+		libvslvm_volume_group_free(
+		 &volume_group,
+		 NULL );
+	}
+	if( read_values != NULL )
+	{
+		for( thread_index = 0;
+		     thread_index < bench_handle->number_of_threads;
+		     thread_index++ )
+		{
+			if( read_values[ thread_index ].logical_volume != NULL )
+			{
+				libvslvm_logical_volume_free(
+				 &( read_values[ thread_index ].logical_volume ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 read_values );
+	}
+	if( latencies != NULL )
+	{
+		memory_free(
+		 latencies );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Prints the benchmark results
+ * The results are printed as text, comma separated values (CSV) or JSON
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_results_fprint(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error )
+{
+	bench_handle_result_t *result = NULL;
+	static char *function         = "bench_handle_results_fprint";
+	double cache_hit_rate         = 0.0;
+	double throughput             = 0.0;
+	int result_index              = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle->output_format == BENCH_HANDLE_OUTPUT_FORMAT_CSV )
+	{
+		fprintf(
+		 bench_handle->notify_stream,
+		 "name,operations,bytes,elapsed_time_ns,throughput_bytes_per_second,"
+		 "latency_minimum_ns,latency_median_ns,latency_p90_ns,latency_p99_ns,latency_maximum_ns,"
+		 "cache_hits,cache_misses,cache_hit_rate\n" );
+	}
+	else if( bench_handle->output_format == BENCH_HANDLE_OUTPUT_FORMAT_JSON )
+	{
+		fprintf(
+		 bench_handle->notify_stream,
+		 "{\n"
+		 "\t\"program\": \"vslvmbench\",\n"
+		 "\t\"version\": \"%s\",\n"
+		 "\t\"logical_volume_index\": %d,\n"
+		 "\t\"logical_volume_size\": %" PRIu64 ",\n"
+		 "\t\"read_size\": %" PRIu64 ",\n"
+		 "\t\"number_of_iterations\": %d,\n"
+		 "\t\"number_of_threads\": %d,\n"
+		 "\t\"results\": [",
+		 LIBVSLVM_VERSION_STRING,
+		 bench_handle->logical_volume_index,
+		 bench_handle->logical_volume_size,
+		 bench_handle->read_size,
+		 bench_handle->number_of_iterations,
+		 bench_handle->number_of_threads );
+	}
+	else
+	{
+		fprintf(
+		 bench_handle->notify_stream,
+		 "Benchmark results:\n" );
+
+		fprintf(
+		 bench_handle->notify_stream,
+		 "\tLogical volume index\t\t: %d\n",
+		 bench_handle->logical_volume_index );
+
+		fprintf(
+		 bench_handle->notify_stream,
+		 "\tLogical volume size\t\t: %" PRIu64 " bytes\n",
+		 bench_handle->logical_volume_size );
+
+		fprintf(
+		 bench_handle->notify_stream,
+		 "\n" );
+	}
+	for( result_index = 0;
+	     result_index < bench_handle->number_of_results;
+	     result_index++ )
+	{
+		result = &( bench_handle->results[ result_index ] );
+
+		throughput = 0.0;
+
+		if( result->elapsed_time > 0 )
+		{
+			throughput = ( (double) result->number_of_bytes * 1000000000.0 ) / (double) result->elapsed_time;
+		}
+		cache_hit_rate = 0.0;
+
+		if( result->has_cache_statistics != 0 )
+		{
+			cache_hit_rate = (double) result->number_of_cache_hits
+			               / (double) ( result->number_of_cache_hits + result->number_of_cache_misses );
+		}
+		if( bench_handle->output_format == BENCH_HANDLE_OUTPUT_FORMAT_CSV )
+		{
+			fprintf(
+			 bench_handle->notify_stream,
+			 "%s,%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%.0f,%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",",
+			 result->name,
+			 result->number_of_operations,
+			 result->number_of_bytes,
+			 result->elapsed_time,
+			 throughput,
+			 result->minimum_latency,
+			 result->median_latency,
+			 result->percentile90_latency,
+			 result->percentile99_latency,
+			 result->maximum_latency );
+
+			if( result->has_cache_statistics != 0 )
+			{
+				fprintf(
+				 bench_handle->notify_stream,
+				 "%" PRIu64 ",%" PRIu64 ",%.4f",
+				 result->number_of_cache_hits,
+				 result->number_of_cache_misses,
+				 cache_hit_rate );
+			}
+			else
+			{
+				fprintf(
+				 bench_handle->notify_stream,
+				 ",," );
+			}
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\n" );
+		}
+		else if( bench_handle->output_format == BENCH_HANDLE_OUTPUT_FORMAT_JSON )
+		{
+			fprintf(
+			 bench_handle->notify_stream,
+			 "%s\n"
+			 "\t\t{\n"
+			 "\t\t\t\"name\": \"%s\",\n"
+			 "\t\t\t\"operations\": %" PRIu64 ",\n"
+			 "\t\t\t\"bytes\": %" PRIu64 ",\n"
+			 "\t\t\t\"elapsed_time_ns\": %" PRIu64 ",\n"
+			 "\t\t\t\"throughput_bytes_per_second\": %.0f,\n"
+			 "\t\t\t\"latency_ns\": {\n"
+			 "\t\t\t\t\"minimum\": %" PRIu64 ",\n"
+			 "\t\t\t\t\"median\": %" PRIu64 ",\n"
+			 "\t\t\t\t\"p90\": %" PRIu64 ",\n"
+			 "\t\t\t\t\"p99\": %" PRIu64 ",\n"
+			 "\t\t\t\t\"maximum\": %" PRIu64 "\n"
+			 "\t\t\t},\n",
+			 ( result_index == 0 ) ? "" : ",",
+			 result->name,
+			 result->number_of_operations,
+			 result->number_of_bytes,
+			 result->elapsed_time,
+			 throughput,
+			 result->minimum_latency,
+			 result->median_latency,
+			 result->percentile90_latency,
+			 result->percentile99_latency,
+			 result->maximum_latency );
+
+			if( result->has_cache_statistics != 0 )
+			{
+				fprintf(
+				 bench_handle->notify_stream,
+				 "\t\t\t\"cache\": {\n"
+				 "\t\t\t\t\"hits\": %" PRIu64 ",\n"
+				 "\t\t\t\t\"misses\": %" PRIu64 ",\n"
+				 "\t\t\t\t\"hit_rate\": %.4f\n"
+				 "\t\t\t}\n",
+				 result->number_of_cache_hits,
+				 result->number_of_cache_misses,
+				 cache_hit_rate );
+			}
+			else
+			{
+				fprintf(
+				 bench_handle->notify_stream,
+				 "\t\t\t\"cache\": null\n" );
+			}
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\t\t}" );
+		}
+		else
+		{
+			fprintf(
+			 bench_handle->notify_stream,
+			 "%s:\n",
+			 result->name );
+
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\tOperations\t\t\t: %" PRIu64 "\n",
+			 result->number_of_operations );
+
+			if( result->number_of_bytes > 0 )
+			{
+				fprintf(
+				 bench_handle->notify_stream,
+				 "\tBytes read\t\t\t: %" PRIu64 "\n",
+				 result->number_of_bytes );
+			}
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\tElapsed time\t\t\t: %.6f seconds\n",
+			 (double) result->elapsed_time / 1000000000.0 );
+
+			if( result->number_of_bytes > 0 )
+			{
+				fprintf(
+				 bench_handle->notify_stream,
+				 "\tThroughput\t\t\t: %.2f MiB/s\n",
+				 throughput / ( 1024.0 * 1024.0 ) );
+			}
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\tLatency minimum\t\t\t: %.3f us\n",
+			 (double) result->minimum_latency / 1000.0 );
+
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\tLatency median\t\t\t: %.3f us\n",
+			 (double) result->median_latency / 1000.0 );
+
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\tLatency 90th percentile\t\t: %.3f us\n",
+			 (double) result->percentile90_latency / 1000.0 );
+
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\tLatency 99th percentile\t\t: %.3f us\n",
+			 (double) result->percentile99_latency / 1000.0 );
+
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\tLatency maximum\t\t\t: %.3f us\n",
+			 (double) result->maximum_latency / 1000.0 );
+
+			if( result->has_cache_statistics != 0 )
+			{
+				fprintf(
+				 bench_handle->notify_stream,
+				 "\tChunk cache hits\t\t: %" PRIu64 "\n",
+				 result->number_of_cache_hits );
+
+				fprintf(
+				 bench_handle->notify_stream,
+				 "\tChunk cache misses\t\t: %" PRIu64 "\n",
+				 result->number_of_cache_misses );
+
+				fprintf(
+				 bench_handle->notify_stream,
+				 "\tChunk cache hit rate\t\t: %.2f%%\n",
+				 cache_hit_rate * 100.0 );
+			}
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\n" );
+		}
+	}
+	if( bench_handle->output_format == BENCH_HANDLE_OUTPUT_FORMAT_JSON )
+	{
+		fprintf(
+		 bench_handle->notify_stream,
+		 "\n"
+		 "\t]\n"
+		 "}\n" );
+	}
+	return( 1 );
+}
+
+/* Runs the benchmarks
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int bench_handle_run(
+     bench_handle_t *bench_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_run";
+	int result            = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	bench_handle->number_of_results = 0;
+
+	result = bench_handle_benchmark_open(
+	          bench_handle,
+	          filename,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to benchmark open.",
+		 function );
+
+		return( -1 );
+	}
+	if( result == 1 )
+	{
+		result = bench_handle_benchmark_read(
+		          bench_handle,
+		          "sequential_read",
+		          BENCH_HANDLE_SEQUENTIAL_READ_BLOCK_SIZE,
+		          0,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to benchmark sequential read.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( result == 1 )
+	{
+		result = bench_handle_benchmark_read(
+		          bench_handle,
+		          "random_read_4k",
+		          4096,
+		          1,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to benchmark random 4k read.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( result == 1 )
+	{
+		result = bench_handle_benchmark_read(
+		          bench_handle,
+		          "random_read_64k",
+		          65536,
+		          1,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to benchmark random 64k read.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( result == 1 )
+	 && ( bench_handle->number_of_threads > 0 ) )
+	{
+		result = bench_handle_benchmark_threaded_read(
+		          bench_handle,
+		          "threaded_random_read_64k",
+		          65536,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to benchmark threaded random 64k read.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( result );
+}
+
@@ -0,0 +1,346 @@
+/*
+ * Bench handle
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _BENCH_HANDLE_H )
+#define _BENCH_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "vslvmtools_libbfio.h"
+#include "vslvmtools_libcerror.h"
+#include "vslvmtools_libcthreads.h"
+#include "vslvmtools_libvslvm.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define BENCH_HANDLE_DEFAULT_NUMBER_OF_ITERATIONS	10
+#define BENCH_HANDLE_MAXIMUM_NUMBER_OF_ITERATIONS	10000
+#define BENCH_HANDLE_DEFAULT_READ_SIZE			64 * 1024 * 1024
+#define BENCH_HANDLE_SEQUENTIAL_READ_BLOCK_SIZE		1024 * 1024
+#define BENCH_HANDLE_MAXIMUM_NUMBER_OF_RESULTS		8
+#define BENCH_HANDLE_MAXIMUM_NUMBER_OF_THREADS		64
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+#define BENCH_HANDLE_DEFAULT_NUMBER_OF_THREADS		4
+#else
+#define BENCH_HANDLE_DEFAULT_NUMBER_OF_THREADS		0
+#endif
+
+/* The seed of the random offsets, fixed so that runs are comparable
+ */
+#define BENCH_HANDLE_RANDOM_SEED			0x9e3779b97f4a7c15ULL
+
+enum BENCH_HANDLE_OUTPUT_FORMATS
+{
+	BENCH_HANDLE_OUTPUT_FORMAT_TEXT		= (int) 't',
+	BENCH_HANDLE_OUTPUT_FORMAT_CSV		= (int) 'c',
+	BENCH_HANDLE_OUTPUT_FORMAT_JSON		= (int) 'j'
+};
+
+typedef struct bench_handle_result bench_handle_result_t;
+
+struct bench_handle_result
+{
+	/* The name of the benchmark
+	 */
+	const char *name;
+
+	/* The number of operations
+	 */
+	uint64_t number_of_operations;
+
+	/* The number of bytes read
+	 */
+	uint64_t number_of_bytes;
+
+	/* The elapsed time in nanoseconds
+	 */
+	uint64_t elapsed_time;
+
+	/* The minimum latency of an operation in nanoseconds
+	 */
+	uint64_t minimum_latency;
+
+	/* The median (50th percentile) latency of an operation in nanoseconds
+	 */
+	uint64_t median_latency;
+
+	/* The 90th percentile latency of an operation in nanoseconds
+	 */
+	uint64_t percentile90_latency;
+
+	/* The 99th percentile latency of an operation in nanoseconds
+	 */
+	uint64_t percentile99_latency;
+
+	/* The maximum latency of an operation in nanoseconds
+	 */
+	uint64_t maximum_latency;
+
+	/* Value to indicate the chunk cache was used
+	 */
+	uint8_t has_cache_statistics;
+
+	/* The number of chunk cache hits
+	 */
+	uint64_t number_of_cache_hits;
+
+	/* The number of chunk cache misses
+	 */
+	uint64_t number_of_cache_misses;
+};
+
+typedef struct bench_handle bench_handle_t;
+
+struct bench_handle
+{
+	/* The volume offset
+	 */
+	off64_t volume_offset;
+
+	/* The index of the logical volume to read
+	 */
+	int logical_volume_index;
+
+	/* The number of open iterations
+	 */
+	int number_of_iterations;
+
+	/* The number of bytes to read per read benchmark
+	 */
+	size64_t read_size;
+
+	/* The number of read threads
+	 */
+	int number_of_threads;
+
+	/* The output format
+	 */
+	int output_format;
+
+	/* The libbfio physical volume file IO pool
+	 */
+	libbfio_pool_t *physical_volume_file_io_pool;
+
+	/* The libvslvm input handle
+	 */
+	libvslvm_handle_t *input_handle;
+
+	/* The logical volume
+	 */
+	libvslvm_logical_volume_t *logical_volume;
+
+	/* The logical volume size
+	 */
+	size64_t logical_volume_size;
+
+	/* The benchmark results
+	 */
+	bench_handle_result_t results[ BENCH_HANDLE_MAXIMUM_NUMBER_OF_RESULTS ];
+
+	/* The number of benchmark results
+	 */
+	int number_of_results;
+
+	/* Value to indicate a read thread failed
+	 */
+	int read_error;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+typedef struct bench_handle_read_value bench_handle_read_value_t;
+
+struct bench_handle_read_value
+{
+	/* The bench handle
+	 */
+	bench_handle_t *bench_handle;
+
+	/* The logical volume to read
+	 */
+	libvslvm_logical_volume_t *logical_volume;
+
+	/* The read block size
+	 */
+	size_t block_size;
+
+	/* The number of reads
+	 */
+	uint64_t number_of_reads;
+
+	/* The latencies of the reads in nanoseconds
+	 */
+	uint64_t *latencies;
+
+	/* The number of bytes read
+	 */
+	uint64_t number_of_bytes;
+
+	/* The random state of the read offsets
+	 */
+	uint64_t random_state;
+};
+
+int bench_handle_system_string_copy_from_64_bit_in_decimal(
+     const system_character_t *string,
+     size_t string_size,
+     uint64_t *value_64bit,
+     libcerror_error_t **error );
+
+int bench_handle_initialize(
+     bench_handle_t **bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_free(
+     bench_handle_t **bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_signal_abort(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_set_volume_offset(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int bench_handle_set_logical_volume_index(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int bench_handle_set_number_of_iterations(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int bench_handle_set_read_size(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int bench_handle_set_number_of_threads(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int bench_handle_set_output_format(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int bench_handle_get_current_time(
+     uint64_t *current_time,
+     libcerror_error_t **error );
+
+uint64_t bench_handle_get_random_value(
+          uint64_t *random_state );
+
+int bench_handle_open_input(
+     bench_handle_t *bench_handle,
+     const system_character_t *filename,
+     uint64_t *open_handle_time,
+     uint64_t *open_physical_volumes_time,
+     uint64_t *open_logical_volume_time,
+     libcerror_error_t **error );
+
+int bench_handle_close_input(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_compare_latencies(
+     const uint64_t *first_latency,
+     const uint64_t *second_latency );
+
+int bench_handle_append_result(
+     bench_handle_t *bench_handle,
+     const char *name,
+     uint64_t *latencies,
+     uint64_t number_of_latencies,
+     uint64_t number_of_bytes,
+     uint64_t elapsed_time,
+     uint64_t number_of_cache_hits,
+     uint64_t number_of_cache_misses,
+     libcerror_error_t **error );
+
+int bench_handle_get_cache_statistics(
+     bench_handle_t *bench_handle,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
+int bench_handle_read(
+     bench_handle_t *bench_handle,
+     bench_handle_read_value_t *read_value,
+     uint8_t random_offsets,
+     libcerror_error_t **error );
+
+int bench_handle_benchmark_open(
+     bench_handle_t *bench_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int bench_handle_benchmark_read(
+     bench_handle_t *bench_handle,
+     const char *name,
+     size_t block_size,
+     uint8_t random_offsets,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int bench_handle_read_thread_callback(
+     bench_handle_read_value_t *read_value );
+
+int bench_handle_benchmark_threaded_read(
+     bench_handle_t *bench_handle,
+     const char *name,
+     size_t block_size,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int bench_handle_results_fprint(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_run(
+     bench_handle_t *bench_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _BENCH_HANDLE_H ) */
+
@@ -0,0 +1,6759 @@
+/*
+ * Export handle
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* copy_file_range is only declared by glibc if _GNU_SOURCE is defined
+ */
+#if !defined( _GNU_SOURCE )
+#define _GNU_SOURCE 1
+#endif
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_SYS_IOCTL_H )
+#include <sys/ioctl.h>
+#endif
+
+#if defined( HAVE_LINUX_FS_H )
+#include <linux/fs.h>
+#endif
+
+#include "byte_size_string.h"
+#include "digest_hash.h"
+#include "export_handle.h"
+#include "extent_hash_file.h"
+#include "extent_hashes.h"
+#include "vslvmtools_libbfio.h"
+#include "vslvmtools_libcerror.h"
+#include "vslvmtools_libclocale.h"
+#include "vslvmtools_libcnotify.h"
+#include "vslvmtools_libcthreads.h"
+#include "vslvmtools_libhmac.h"
+#include "vslvmtools_libvslvm.h"
+
+#if !defined( LIBVSLVM_HAVE_BFIO )
+
+LIBVSLVM_EXTERN \
+int libvslvm_handle_open_file_io_handle(
+     libvslvm_handle_t *handle,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libvslvm_error_t **error );
+
+LIBVSLVM_EXTERN \
+int libvslvm_handle_open_physical_volume_files_file_io_pool(
+     libvslvm_handle_t *handle,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error );
+
+LIBVSLVM_EXTERN \
+int libvslvm_volume_group_sweep_physical_volume_file_io_handle(
+     libvslvm_volume_group_t *volume_group,
+     int physical_volume_index,
+     libbfio_handle_t *file_io_handle,
+     size_t buffer_size,
+     int (*write_callback)(
+            intptr_t *callback_data,
+            int logical_volume_index,
+            off64_t logical_volume_offset,
+            const uint8_t *buffer,
+            size_t buffer_size,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBVSLVM_HAVE_BFIO ) */
+
+#define EXPORT_HANDLE_NOTIFY_STREAM	stdout
+
+/* Copies a string of a decimal value to a 64-bit value
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_system_string_copy_from_64_bit_in_decimal(
+     const system_character_t *string,
+     size_t string_size,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function              = "export_handle_system_string_copy_from_64_bit_in_decimal";
+	size_t string_index                = 0;
+	system_character_t character_value = 0;
+	uint8_t maximum_string_index       = 20;
+	int8_t sign                        = 1;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	*value_64bit = 0;
+
+	if( string[ string_index ] == (system_character_t) '-' )
+	{
+		string_index++;
+		maximum_string_index++;
+
+		sign = -1;
+	}
+	else if( string[ string_index ] == (system_character_t) '+' )
+	{
+		string_index++;
+		maximum_string_index++;
+	}
+	while( string_index < string_size )
+	{
+		if( string[ string_index ] == 0 )
+		{
+			break;
+		}
+		if( string_index > (size_t) maximum_string_index )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_LARGE,
+			 "%s: string too large.",
+			 function );
+
+			return( -1 );
+		}
+		*value_64bit *= 10;
+
+		if( ( string[ string_index ] >= (system_character_t) '0' )
+		 && ( string[ string_index ] <= (system_character_t) '9' ) )
+		{
+			character_value = (system_character_t) ( string[ string_index ] - (system_character_t) '0' );
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character value: %" PRIc_SYSTEM " at index: %d.",
+			 function,
+			 string[ string_index ],
+			 string_index );
+
+			return( -1 );
+		}
+		*value_64bit += character_value;
+
+		string_index++;
+	}
+	if( sign == -1 )
+	{
+		*value_64bit *= (uint64_t) -1;
+	}
+	return( 1 );
+}
+
+/* Creates an export handle
+ * Make sure the value export_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_initialize(
+     export_handle_t **export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_initialize";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*export_handle = memory_allocate_structure(
+	                  export_handle_t );
+
+	if( *export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *export_handle,
+	     0,
+	     sizeof( export_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear export handle.",
+		 function );
+
+		memory_free(
+		 *export_handle );
+
+		*export_handle = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *export_handle )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *export_handle )->buffer_size       = EXPORT_HANDLE_DEFAULT_BUFFER_SIZE;
+	( *export_handle )->number_of_threads = EXPORT_HANDLE_DEFAULT_NUMBER_OF_THREADS;
+	( *export_handle )->write_sparse      = 1;
+	( *export_handle )->notify_stream     = EXPORT_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *export_handle != NULL )
+	{
+		memory_free(
+		 *export_handle );
+
+		*export_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an export handle
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_free(
+     export_handle_t **export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_free";
+	int result            = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_handle != NULL )
+	{
+		if( ( *export_handle )->physical_volume_file_io_pool != NULL )
+		{
+			if( export_handle_close_input(
+			     *export_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close input.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *export_handle )->output_file_io_handles != NULL )
+		{
+			if( export_handle_close_output(
+			     *export_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close output.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *export_handle )->digest_values != NULL )
+		{
+			if( export_handle_free_digest_values(
+			     *export_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free digest values.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( export_handle_free_extent_hashes(
+		     *export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free extent hashes.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *export_handle )->extent_hash_filename != NULL )
+		{
+			memory_free(
+			 ( *export_handle )->extent_hash_filename );
+		}
+		if( ( *export_handle )->previous_extent_hash_filename != NULL )
+		{
+			memory_free(
+			 ( *export_handle )->previous_extent_hash_filename );
+		}
+		if( ( *export_handle )->source_filename != NULL )
+		{
+			memory_free(
+			 ( *export_handle )->source_filename );
+		}
+		if( ( *export_handle )->target_path_prefix != NULL )
+		{
+			memory_free(
+			 ( *export_handle )->target_path_prefix );
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *export_handle )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *export_handle );
+
+		*export_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the export handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_signal_abort(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_signal_abort";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->abort = 1;
+
+	if( export_handle->input_handle != NULL )
+	{
+		if( libvslvm_handle_signal_abort(
+		     export_handle->input_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal input handle to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the volume offset
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_volume_offset(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_volume_offset";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( export_handle_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->volume_offset = (off64_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the buffer size
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_buffer_size(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_buffer_size";
+	size_t string_length  = 0;
+	uint64_t size_value   = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( byte_size_string_convert(
+	     string,
+	     string_length,
+	     &size_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to convert buffer size string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size_value == 0 )
+	 || ( size_value > (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		return( 0 );
+	}
+	export_handle->buffer_size = (size_t) size_value;
+
+	return( 1 );
+}
+
+/* Sets the number of write threads
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_number_of_threads(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_number_of_threads";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( export_handle_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( value_64bit > (uint64_t) EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS )
+#else
+	if( value_64bit != 0 )
+#endif
+	{
+		return( 0 );
+	}
+	export_handle->number_of_threads = (int) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the digest types to calculate
+ * The digest types are a comma separated list of: md5, sha1 and sha256
+ * Returns 1 if successful, 0 if unsupported values or -1 on error
+ */
+int export_handle_set_digest_types(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	const system_character_t *segment = NULL;
+	static char *function             = "export_handle_set_digest_types";
+	size_t segment_length             = 0;
+	size_t segment_start              = 0;
+	size_t string_index               = 0;
+	size_t string_length              = 0;
+	uint8_t calculate_md5             = 0;
+	uint8_t calculate_sha1            = 0;
+	uint8_t calculate_sha256          = 0;
+	int result                        = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	for( string_index = 0;
+	     string_index <= string_length;
+	     string_index++ )
+	{
+		if( ( string_index < string_length )
+		 && ( string[ string_index ] != (system_character_t) ',' ) )
+		{
+			continue;
+		}
+		segment        = &( string[ segment_start ] );
+		segment_length = string_index - segment_start;
+		segment_start  = string_index + 1;
+
+		if( segment_length == 0 )
+		{
+			continue;
+		}
+		if( ( segment_length == 3 )
+		 && ( system_string_compare_no_case(
+		       segment,
+		       _SYSTEM_STRING( "md5" ),
+		       3 ) == 0 ) )
+		{
+			calculate_md5 = 1;
+		}
+		else if( ( segment_length == 4 )
+		      && ( system_string_compare_no_case(
+		            segment,
+		            _SYSTEM_STRING( "sha1" ),
+		            4 ) == 0 ) )
+		{
+			calculate_sha1 = 1;
+		}
+		else if( ( segment_length == 6 )
+		      && ( system_string_compare_no_case(
+		            segment,
+		            _SYSTEM_STRING( "sha256" ),
+		            6 ) == 0 ) )
+		{
+			calculate_sha256 = 1;
+		}
+		else
+		{
+			result = 0;
+		}
+	}
+	if( result == 1 )
+	{
+		export_handle->calculate_md5    = calculate_md5;
+		export_handle->calculate_sha1   = calculate_sha1;
+		export_handle->calculate_sha256 = calculate_sha256;
+	}
+	return( result );
+}
+
+/* Sets the extent hash filename
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_extent_hash_filename(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function  = "export_handle_set_extent_hash_filename";
+	size_t filename_length = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->extent_hash_filename != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - extent hash filename value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+	if( filename_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_length > (size_t) ( ( SSIZE_MAX / sizeof( system_character_t ) ) - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid filename length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->extent_hash_filename = system_string_allocate(
+	                                       filename_length + 1 );
+
+	if( export_handle->extent_hash_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create extent hash filename string.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     export_handle->extent_hash_filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy extent hash filename.",
+		 function );
+
+		goto on_error;
+	}
+	export_handle->extent_hash_filename[ filename_length ] = 0;
+
+	return( 1 );
+
+on_error:
+	if( export_handle->extent_hash_filename != NULL )
+	{
+		memory_free(
+		 export_handle->extent_hash_filename );
+
+		export_handle->extent_hash_filename = NULL;
+	}
+	return( -1 );
+}
+
+/* Sets the previous extent hash filename
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_previous_extent_hash_filename(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function  = "export_handle_set_previous_extent_hash_filename";
+	size_t filename_length = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->previous_extent_hash_filename != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - previous extent hash filename value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+	if( filename_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_length > (size_t) ( ( SSIZE_MAX / sizeof( system_character_t ) ) - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid filename length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->previous_extent_hash_filename = system_string_allocate(
+	                                                filename_length + 1 );
+
+	if( export_handle->previous_extent_hash_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create previous extent hash filename string.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     export_handle->previous_extent_hash_filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy previous extent hash filename.",
+		 function );
+
+		goto on_error;
+	}
+	export_handle->previous_extent_hash_filename[ filename_length ] = 0;
+
+	return( 1 );
+
+on_error:
+	if( export_handle->previous_extent_hash_filename != NULL )
+	{
+		memory_free(
+		 export_handle->previous_extent_hash_filename );
+
+		export_handle->previous_extent_hash_filename = NULL;
+	}
+	return( -1 );
+}
+
+/* Sets the target path prefix
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_target_path_prefix(
+     export_handle_t *export_handle,
+     const system_character_t *target_path_prefix,
+     size_t target_path_prefix_size,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_target_path_prefix";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->target_path_prefix != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - target path prefix value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( target_path_prefix == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target path prefix.",
+		 function );
+
+		return( -1 );
+	}
+	if( target_path_prefix_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing target path prefix.",
+		 function );
+
+		goto on_error;
+	}
+	if( target_path_prefix_size > (size_t) ( SSIZE_MAX / sizeof( system_character_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid target path prefix size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	export_handle->target_path_prefix = system_string_allocate(
+	                                     target_path_prefix_size );
+
+	if( export_handle->target_path_prefix == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create target path prefix string.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     export_handle->target_path_prefix,
+	     target_path_prefix,
+	     target_path_prefix_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy target path prefix.",
+		 function );
+
+		goto on_error;
+	}
+	export_handle->target_path_prefix[ target_path_prefix_size - 1 ] = 0;
+
+	export_handle->target_path_prefix_size = target_path_prefix_size;
+
+	return( 1 );
+
+on_error:
+	if( export_handle->target_path_prefix != NULL )
+	{
+		memory_free(
+		 export_handle->target_path_prefix );
+
+		export_handle->target_path_prefix = NULL;
+	}
+	export_handle->target_path_prefix_size = 0;
+
+	return( -1 );
+}
+
+/* Opens the input
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_input(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "export_handle_open_input";
+	size_t filename_length           = 0;
+	int entry_index                  = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->physical_volume_file_io_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - physical volume file IO pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->input_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - input handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_range_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_range_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#else
+	if( libbfio_file_range_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to set name of file IO handle: 0.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_range_set(
+	     file_io_handle,
+	     export_handle->volume_offset,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to set volume offset of file IO handle: 0.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvslvm_handle_initialize(
+	     &( export_handle->input_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvslvm_handle_open_file_io_handle(
+	     export_handle->input_handle,
+	     file_io_handle,
+	     LIBVSLVM_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input handle.",
+		 function );
+
+		goto on_error;
+	}
+/* TODO control maximum number of open handles */
+	if( libbfio_pool_initialize(
+	     &( export_handle->physical_volume_file_io_pool ),
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize physical volume file IO pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_pool_append_handle(
+	     export_handle->physical_volume_file_io_pool,
+	     &entry_index,
+	     file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The file IO pool takes over management of the file IO handle
+	 */
+	file_io_handle = NULL;
+
+/* TODO determine if the first file is a metadata only file and change filenames accordingly
+ */
+	if( libvslvm_handle_open_physical_volume_files_file_io_pool(
+	     export_handle->input_handle,
+	     export_handle->physical_volume_file_io_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open physical volume files.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle->source_filename != NULL )
+	{
+		memory_free(
+		 export_handle->source_filename );
+	}
+	export_handle->source_filename = system_string_allocate(
+	                                  filename_length + 1 );
+
+	if( export_handle->source_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create source filename string.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     export_handle->source_filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy source filename.",
+		 function );
+
+		goto on_error;
+	}
+	export_handle->source_filename[ filename_length ] = 0;
+
+	return( 1 );
+
+on_error:
+	if( export_handle->source_filename != NULL )
+	{
+		memory_free(
+		 export_handle->source_filename );
+
+		export_handle->source_filename = NULL;
+	}
+	if( export_handle->input_handle != NULL )
+	{
+		libvslvm_handle_initialize(
+		 &( export_handle->input_handle ),
+		 NULL );
+	}
+	/* The file IO pool must be freed after the input handle
+	 */
+	if( export_handle->physical_volume_file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &( export_handle->physical_volume_file_io_pool ),
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes the input
+ * Returns the 0 if successful or -1 on error
+ */
+int export_handle_close_input(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_close_input";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->physical_volume_file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing physical volume file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->input_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing input handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvslvm_handle_close(
+	     export_handle->input_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input handle.",
+		 function );
+
+		result = -1;
+	}
+	if( libvslvm_handle_free(
+	     &( export_handle->input_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free input handle.",
+		 function );
+
+		result = -1;
+	}
+	if( libbfio_pool_close_all(
+	     export_handle->physical_volume_file_io_pool,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close physical volume file IO pool.",
+		 function );
+
+		result = -1;
+	}
+	if( libbfio_pool_free(
+	     &( export_handle->physical_volume_file_io_pool ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free physical volume file IO pool.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+
+
+/* Retrieves the target filename of a specific logical volume
+ * The target filename consists of the target path prefix followed by the logical volume number
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_target_filename(
+     export_handle_t *export_handle,
+     int logical_volume_index,
+     system_character_t *filename,
+     size_t filename_size,
+     size_t *filename_length,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_get_target_filename";
+	int print_count       = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->target_path_prefix == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing target path prefix.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid filename size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename length.",
+		 function );
+
+		return( -1 );
+	}
+	print_count = system_string_sprintf(
+	               filename,
+	               filename_size,
+	               _SYSTEM_STRING( "%" ) _SYSTEM_STRING( PRIs_SYSTEM ) _SYSTEM_STRING( "%d" ),
+	               export_handle->target_path_prefix,
+	               logical_volume_index + 1 );
+
+	if( ( print_count < 0 )
+	 || ( (size_t) print_count >= filename_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename of logical volume: %d.",
+		 function,
+		 logical_volume_index );
+
+		return( -1 );
+	}
+	*filename_length = (size_t) print_count;
+
+	return( 1 );
+}
+
+/* Opens the output
+ * Creates an output file named target path prefix followed by the logical volume number
+ * for every logical volume in the volume group
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_output(
+     export_handle_t *export_handle,
+     libvslvm_volume_group_t *volume_group,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle          = NULL;
+	libvslvm_logical_volume_t *logical_volume = NULL;
+	system_character_t *filename              = NULL;
+	static char *function                     = "export_handle_open_output";
+	size_t filename_length                    = 0;
+	size_t filename_size                      = 0;
+	uint8_t is_incremental                    = 0;
+	int access_flags                          = 0;
+	int logical_volume_index                  = 0;
+	int number_of_logical_volumes             = 0;
+	int result                                = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->target_path_prefix == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing target path prefix.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->output_file_io_handles != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - output file IO handles value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvslvm_volume_group_get_number_of_logical_volumes(
+	     volume_group,
+	     &number_of_logical_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of logical volumes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_logical_volumes <= 0 )
+	 || ( (size_t) number_of_logical_volumes > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( size64_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of logical volumes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->output_file_io_handles = (libbfio_handle_t **) memory_allocate(
+	                                                               sizeof( libbfio_handle_t * ) * number_of_logical_volumes );
+
+	if( export_handle->output_file_io_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create output file IO handles.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     export_handle->output_file_io_handles,
+	     0,
+	     sizeof( libbfio_handle_t * ) * number_of_logical_volumes ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear output file IO handles.",
+		 function );
+
+		memory_free(
+		 export_handle->output_file_io_handles );
+
+		export_handle->output_file_io_handles = NULL;
+
+		return( -1 );
+	}
+	export_handle->number_of_output_file_io_handles = number_of_logical_volumes;
+
+	export_handle->logical_volume_sizes = (size64_t *) memory_allocate(
+	                                                    sizeof( size64_t ) * number_of_logical_volumes );
+
+	if( export_handle->logical_volume_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create logical volume sizes.",
+		 function );
+
+		goto on_error;
+	}
+	export_handle->logical_volume_end_written = (uint8_t *) memory_allocate(
+	                                                         sizeof( uint8_t ) * number_of_logical_volumes );
+
+	if( export_handle->logical_volume_end_written == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create logical volume end written values.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     export_handle->logical_volume_end_written,
+	     0,
+	     sizeof( uint8_t ) * number_of_logical_volumes ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear logical volume end written values.",
+		 function );
+
+		goto on_error;
+	}
+	/* The size of the target path prefix plus 10 digits for the logical volume number
+	 */
+	filename_size = export_handle->target_path_prefix_size + 10;
+
+	filename = system_string_allocate(
+	            filename_size );
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename string.",
+		 function );
+
+		goto on_error;
+	}
+	for( logical_volume_index = 0;
+	     logical_volume_index < number_of_logical_volumes;
+	     logical_volume_index++ )
+	{
+		/* Logical volumes with a layout that is not supported, such as multiple stripes,
+		 * cannot be retrieved and are not exported
+		 */
+		result = export_handle_get_logical_volume(
+		          volume_group,
+		          logical_volume_index,
+		          &logical_volume,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve logical volume: %d.",
+			 function,
+			 logical_volume_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			export_handle->logical_volume_sizes[ logical_volume_index ] = 0;
+
+			fprintf(
+			 export_handle->notify_stream,
+			 "Unable to export logical volume: %d unsupported layout.\n",
+			 logical_volume_index + 1 );
+
+			export_handle->number_of_unsupported_logical_volumes += 1;
+
+			continue;
+		}
+		if( libvslvm_logical_volume_get_size(
+		     logical_volume,
+		     &( export_handle->logical_volume_sizes[ logical_volume_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve logical volume: %d size.",
+			 function,
+			 logical_volume_index );
+
+			goto on_error;
+		}
+		if( libvslvm_logical_volume_free(
+		     &logical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free logical volume: %d.",
+			 function,
+			 logical_volume_index );
+
+			goto on_error;
+		}
+		if( export_handle_get_target_filename(
+		     export_handle,
+		     logical_volume_index,
+		     filename,
+		     filename_size,
+		     &filename_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve target filename of logical volume: %d.",
+			 function,
+			 logical_volume_index );
+
+			goto on_error;
+		}
+		if( export_handle_get_logical_volume_is_incremental(
+		     export_handle,
+		     logical_volume_index,
+		     &is_incremental,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if logical volume: %d is exported incrementally.",
+			 function,
+			 logical_volume_index );
+
+			goto on_error;
+		}
+		/* The output file of an incremental export is updated in place
+		 */
+		if( is_incremental != 0 )
+		{
+			access_flags = LIBBFIO_OPEN_WRITE;
+		}
+		else
+		{
+			access_flags = LIBBFIO_OPEN_WRITE_TRUNCATE;
+		}
+		if( libbfio_file_initialize(
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( libbfio_file_set_name_wide(
+		     file_io_handle,
+		     filename,
+		     filename_length,
+		     error ) != 1 )
+#else
+		if( libbfio_file_set_name(
+		     file_io_handle,
+		     filename,
+		     filename_length,
+		     error ) != 1 )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set name of file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open output file: %" PRIs_SYSTEM ".",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+		export_handle->output_file_io_handles[ logical_volume_index ] = file_io_handle;
+
+		file_io_handle = NULL;
+
+		fprintf(
+		 export_handle->notify_stream,
+		 "Exporting logical volume: %d to: %" PRIs_SYSTEM "\n",
+		 logical_volume_index + 1,
+		 filename );
+	}
+	memory_free(
+	 filename );
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( logical_volume != NULL )
+	{
+		libvslvm_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	if( export_handle->output_file_io_handles != NULL )
+	{
+		export_handle_close_output(
+		 export_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes the output
+ * Returns the 0 if successful or -1 on error
+ */
+int export_handle_close_output(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function    = "export_handle_close_output";
+	int logical_volume_index = 0;
+	int result               = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->output_file_io_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing output file IO handles.",
+		 function );
+
+		return( -1 );
+	}
+	for( logical_volume_index = 0;
+	     logical_volume_index < export_handle->number_of_output_file_io_handles;
+	     logical_volume_index++ )
+	{
+		if( export_handle->output_file_io_handles[ logical_volume_index ] == NULL )
+		{
+			continue;
+		}
+		if( libbfio_handle_close(
+		     export_handle->output_file_io_handles[ logical_volume_index ],
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close output file IO handle: %d.",
+			 function,
+			 logical_volume_index );
+
+			result = -1;
+		}
+		if( libbfio_handle_free(
+		     &( export_handle->output_file_io_handles[ logical_volume_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free output file IO handle: %d.",
+			 function,
+			 logical_volume_index );
+
+			result = -1;
+		}
+	}
+	memory_free(
+	 export_handle->output_file_io_handles );
+
+	export_handle->output_file_io_handles           = NULL;
+	export_handle->number_of_output_file_io_handles = 0;
+
+	if( export_handle->logical_volume_sizes != NULL )
+	{
+		memory_free(
+		 export_handle->logical_volume_sizes );
+
+		export_handle->logical_volume_sizes = NULL;
+	}
+	if( export_handle->logical_volume_end_written != NULL )
+	{
+		memory_free(
+		 export_handle->logical_volume_end_written );
+
+		export_handle->logical_volume_end_written = NULL;
+	}
+	return( result );
+}
+
+/* Determines if the data only contains 0-byte values
+ * The bulk of the data is compared in aligned blocks of 64-bit values, which compilers
+ * can vectorize
+ * Returns 1 if the data only contains 0-byte values or 0 if not
+ */
+int export_handle_data_is_zero(
+     const uint8_t *data,
+     size_t data_size )
+{
+	const uint64_t *data_64bit = NULL;
+	const uint8_t *data_end    = NULL;
+
+	if( data == NULL )
+	{
+		return( 0 );
+	}
+	data_end = &( data[ data_size ] );
+
+	while( ( data < data_end )
+	    && ( ( (intptr_t) data % sizeof( uint64_t ) ) != 0 ) )
+	{
+		if( *data != 0 )
+		{
+			return( 0 );
+		}
+		data++;
+	}
+	while( (size_t) ( data_end - data ) >= ( 4 * sizeof( uint64_t ) ) )
+	{
+		data_64bit = (const uint64_t *) data;
+
+		if( ( data_64bit[ 0 ] | data_64bit[ 1 ] | data_64bit[ 2 ] | data_64bit[ 3 ] ) != 0 )
+		{
+			return( 0 );
+		}
+		data += 4 * sizeof( uint64_t );
+	}
+	while( data < data_end )
+	{
+		if( *data != 0 )
+		{
+			return( 0 );
+		}
+		data++;
+	}
+	return( 1 );
+}
+
+/* Writes logical volume data to the corresponding output file
+ * When writing sparse, data that only contains 0-byte values is not written unless forced
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_data(
+     export_handle_t *export_handle,
+     int logical_volume_index,
+     off64_t logical_volume_offset,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t force_write,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_write_data";
+	ssize_t write_count   = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->output_file_io_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing output file IO handles.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( logical_volume_index < 0 )
+	 || ( logical_volume_index >= export_handle->number_of_output_file_io_handles ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid logical volume index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->output_file_io_handles[ logical_volume_index ] == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing output file IO handle: %d.",
+		 function,
+		 logical_volume_index );
+
+		return( -1 );
+	}
+	if( ( export_handle->write_sparse != 0 )
+	 && ( force_write == 0 )
+	 && ( export_handle_data_is_zero(
+	       data,
+	       data_size ) != 0 ) )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     export_handle->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		export_handle->sparse_size += data_size;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     export_handle->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		return( 1 );
+	}
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               export_handle->output_file_io_handles[ logical_volume_index ],
+	               data,
+	               data_size,
+	               logical_volume_offset,
+	               error );
+
+	if( write_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write logical volume: %d data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 logical_volume_index,
+		 logical_volume_offset,
+		 logical_volume_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific logical volume
+ * Logical volumes with a layout that is not supported, such as multiple stripes,
+ * cannot be retrieved, any other error is returned
+ * Returns 1 if successful, 0 if the layout of the logical volume is not supported or -1 on error
+ */
+int export_handle_get_logical_volume(
+     libvslvm_volume_group_t *volume_group,
+     int logical_volume_index,
+     libvslvm_logical_volume_t **logical_volume,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_get_logical_volume";
+
+	if( libvslvm_volume_group_get_logical_volume(
+	     volume_group,
+	     logical_volume_index,
+	     logical_volume,
+	     error ) != 1 )
+	{
+		if( ( error != NULL )
+		 && ( libcerror_error_matches(
+		       *error,
+		       LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		       LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE ) != 0 ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+			libcerror_error_free(
+			 error );
+
+			return( 0 );
+		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume: %d.",
+		 function,
+		 logical_volume_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines if the sweep provides the data of a logical volume in order
+ * The sweep reads the physical volumes in order of their index and offset,
+ * hence the data is provided in order if the linear extent runs are stored
+ * in ascending physical volume order
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_logical_volume_is_ordered(
+     libvslvm_logical_volume_t *logical_volume,
+     uint8_t *is_ordered,
+     libcerror_error_t **error )
+{
+	static char *function            = "export_handle_get_logical_volume_is_ordered";
+	size64_t extent_run_size         = 0;
+	off64_t last_physical_volume_end = 0;
+	off64_t logical_offset           = 0;
+	off64_t physical_volume_offset   = 0;
+	uint8_t extent_run_type          = 0;
+	int extent_run_index             = 0;
+	int last_physical_volume_index   = -1;
+	int number_of_extent_runs        = 0;
+	int physical_volume_index        = 0;
+
+	if( is_ordered == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid is ordered.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvslvm_logical_volume_get_number_of_extent_runs(
+	     logical_volume,
+	     &number_of_extent_runs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extent runs.",
+		 function );
+
+		return( -1 );
+	}
+	*is_ordered = 1;
+
+	for( extent_run_index = 0;
+	     extent_run_index < number_of_extent_runs;
+	     extent_run_index++ )
+	{
+		if( libvslvm_logical_volume_get_extent_run_by_index(
+		     logical_volume,
+		     extent_run_index,
+		     &logical_offset,
+		     &extent_run_size,
+		     &physical_volume_index,
+		     &physical_volume_offset,
+		     &extent_run_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent run: %d.",
+			 function,
+			 extent_run_index );
+
+			return( -1 );
+		}
+		if( extent_run_type != LIBVSLVM_EXTENT_RUN_TYPE_LINEAR )
+		{
+			continue;
+		}
+		if( ( physical_volume_index < last_physical_volume_index )
+		 || ( ( physical_volume_index == last_physical_volume_index )
+		  &&  ( physical_volume_offset < last_physical_volume_end ) ) )
+		{
+			*is_ordered = 0;
+
+			break;
+		}
+		last_physical_volume_index = physical_volume_index;
+		last_physical_volume_end   = physical_volume_offset + (off64_t) extent_run_size;
+	}
+	return( 1 );
+}
+
+/* Determines if the linear extent runs of a logical volume are stored on multiple physical volumes
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_logical_volume_spans_physical_volumes(
+     libvslvm_logical_volume_t *logical_volume,
+     uint8_t *spans_physical_volumes,
+     libcerror_error_t **error )
+{
+	static char *function           = "export_handle_get_logical_volume_spans_physical_volumes";
+	size64_t extent_run_size        = 0;
+	off64_t logical_offset          = 0;
+	off64_t physical_volume_offset  = 0;
+	uint8_t extent_run_type         = 0;
+	int extent_run_index            = 0;
+	int first_physical_volume_index = -1;
+	int number_of_extent_runs       = 0;
+	int physical_volume_index       = 0;
+
+	if( spans_physical_volumes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid spans physical volumes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvslvm_logical_volume_get_number_of_extent_runs(
+	     logical_volume,
+	     &number_of_extent_runs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extent runs.",
+		 function );
+
+		return( -1 );
+	}
+	*spans_physical_volumes = 0;
+
+	for( extent_run_index = 0;
+	     extent_run_index < number_of_extent_runs;
+	     extent_run_index++ )
+	{
+		if( libvslvm_logical_volume_get_extent_run_by_index(
+		     logical_volume,
+		     extent_run_index,
+		     &logical_offset,
+		     &extent_run_size,
+		     &physical_volume_index,
+		     &physical_volume_offset,
+		     &extent_run_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent run: %d.",
+			 function,
+			 extent_run_index );
+
+			return( -1 );
+		}
+		if( extent_run_type != LIBVSLVM_EXTENT_RUN_TYPE_LINEAR )
+		{
+			continue;
+		}
+		if( first_physical_volume_index == -1 )
+		{
+			first_physical_volume_index = physical_volume_index;
+		}
+		else if( physical_volume_index != first_physical_volume_index )
+		{
+			*spans_physical_volumes = 1;
+
+			break;
+		}
+	}
+	return( 1 );
+}
+
+/* Creates a digest value
+ * Make sure the value digest_value is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_digest_value_initialize(
+     export_handle_t *export_handle,
+     export_handle_digest_value_t **digest_value,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_digest_value_initialize";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *digest_value != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid digest value value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*digest_value = memory_allocate_structure(
+	                 export_handle_digest_value_t );
+
+	if( *digest_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create digest value.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *digest_value,
+	     0,
+	     sizeof( export_handle_digest_value_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear digest value.",
+		 function );
+
+		memory_free(
+		 *digest_value );
+
+		*digest_value = NULL;
+
+		return( -1 );
+	}
+	if( export_handle->calculate_md5 != 0 )
+	{
+		if( libhmac_md5_initialize(
+		     &( ( *digest_value )->md5_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize MD5 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( export_handle->calculate_sha1 != 0 )
+	{
+		if( libhmac_sha1_initialize(
+		     &( ( *digest_value )->sha1_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize SHA1 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( export_handle->calculate_sha256 != 0 )
+	{
+		if( libhmac_sha256_initialize(
+		     &( ( *digest_value )->sha256_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize SHA256 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *digest_value != NULL )
+	{
+		export_handle_digest_value_free(
+		 digest_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a digest value
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_digest_value_free(
+     export_handle_digest_value_t **digest_value,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_digest_value_free";
+	int result            = 1;
+
+	if( digest_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *digest_value != NULL )
+	{
+		if( ( *digest_value )->md5_context != NULL )
+		{
+			if( libhmac_md5_free(
+			     &( ( *digest_value )->md5_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free MD5 context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *digest_value )->sha1_context != NULL )
+		{
+			if( libhmac_sha1_free(
+			     &( ( *digest_value )->sha1_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free SHA1 context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *digest_value )->sha256_context != NULL )
+		{
+			if( libhmac_sha256_free(
+			     &( ( *digest_value )->sha256_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free SHA256 context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *digest_value );
+
+		*digest_value = NULL;
+	}
+	return( result );
+}
+
+/* Updates the digest contexts of a digest value with data
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_digest_value_update(
+     export_handle_digest_value_t *digest_value,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_digest_value_update";
+
+	if( digest_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest value.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_value->md5_context != NULL )
+	{
+		if( libhmac_md5_update(
+		     digest_value->md5_context,
+		     data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update MD5 digest hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( digest_value->sha1_context != NULL )
+	{
+		if( libhmac_sha1_update(
+		     digest_value->sha1_context,
+		     data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update SHA1 digest hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( digest_value->sha256_context != NULL )
+	{
+		if( libhmac_sha256_update(
+		     digest_value->sha256_context,
+		     data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update SHA256 digest hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Initializes the digest values of the logical volumes
+ * If use_sweep is set the digest hashes of logical volumes that the sweep provides
+ * in order are calculated while the data is exported
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_initialize_digest_values(
+     export_handle_t *export_handle,
+     libvslvm_volume_group_t *volume_group,
+     uint8_t use_sweep,
+     libcerror_error_t **error )
+{
+	libvslvm_logical_volume_t *logical_volume = NULL;
+	static char *function                     = "export_handle_initialize_digest_values";
+	int logical_volume_index                  = 0;
+	int number_of_logical_volumes             = 0;
+	int result                                = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->digest_values != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - digest values value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( export_handle->calculate_md5 == 0 )
+	 && ( export_handle->calculate_sha1 == 0 )
+	 && ( export_handle->calculate_sha256 == 0 ) )
+	{
+		return( 1 );
+	}
+	if( libvslvm_volume_group_get_number_of_logical_volumes(
+	     volume_group,
+	     &number_of_logical_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of logical volumes.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_logical_volumes <= 0 )
+	 || ( (size_t) number_of_logical_volumes > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( export_handle_digest_value_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of logical volumes value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	export_handle->digest_values = (export_handle_digest_value_t **) memory_allocate(
+	                                                                  sizeof( export_handle_digest_value_t * ) * number_of_logical_volumes );
+
+	if( export_handle->digest_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create digest values.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     export_handle->digest_values,
+	     0,
+	     sizeof( export_handle_digest_value_t * ) * number_of_logical_volumes ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear digest values.",
+		 function );
+
+		memory_free(
+		 export_handle->digest_values );
+
+		export_handle->digest_values = NULL;
+
+		goto on_error;
+	}
+	export_handle->number_of_digest_values = number_of_logical_volumes;
+
+	export_handle->zero_buffer = (uint8_t *) memory_allocate(
+	                                          sizeof( uint8_t ) * export_handle->buffer_size );
+
+	if( export_handle->zero_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create zero buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     export_handle->zero_buffer,
+	     0,
+	     sizeof( uint8_t ) * export_handle->buffer_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear zero buffer.",
+		 function );
+
+		goto on_error;
+	}
+	for( logical_volume_index = 0;
+	     logical_volume_index < number_of_logical_volumes;
+	     logical_volume_index++ )
+	{
+		/* Logical volumes with a layout that is not supported are not exported
+		 * and have no digest values
+		 */
+		result = export_handle_get_logical_volume(
+		          volume_group,
+		          logical_volume_index,
+		          &logical_volume,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve logical volume: %d.",
+			 function,
+			 logical_volume_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( export_handle_digest_value_initialize(
+		     export_handle,
+		     &( export_handle->digest_values[ logical_volume_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create digest value: %d.",
+			 function,
+			 logical_volume_index );
+
+			goto on_error;
+		}
+		if( libvslvm_logical_volume_get_size(
+		     logical_volume,
+		     &( export_handle->digest_values[ logical_volume_index ]->logical_volume_size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of logical volume: %d.",
+			 function,
+			 logical_volume_index );
+
+			goto on_error;
+		}
+		if( use_sweep != 0 )
+		{
+			if( export_handle_get_logical_volume_is_ordered(
+			     logical_volume,
+			     &( export_handle->digest_values[ logical_volume_index ]->is_ordered ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if logical volume: %d is ordered.",
+				 function,
+				 logical_volume_index );
+
+				goto on_error;
+			}
+		}
+		if( libvslvm_logical_volume_free(
+		     &logical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free logical volume: %d.",
+			 function,
+			 logical_volume_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( logical_volume != NULL )
+	{
+		libvslvm_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	export_handle_free_digest_values(
+	 export_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Frees the digest values of the logical volumes
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_free_digest_values(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function    = "export_handle_free_digest_values";
+	int logical_volume_index = 0;
+	int result               = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->digest_values != NULL )
+	{
+		for( logical_volume_index = 0;
+		     logical_volume_index < export_handle->number_of_digest_values;
+		     logical_volume_index++ )
+		{
+			if( export_handle_digest_value_free(
+			     &( export_handle->digest_values[ logical_volume_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free digest value: %d.",
+				 function,
+				 logical_volume_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 export_handle->digest_values );
+
+		export_handle->digest_values = NULL;
+	}
+	export_handle->number_of_digest_values = 0;
+
+	if( export_handle->zero_buffer != NULL )
+	{
+		memory_free(
+		 export_handle->zero_buffer );
+
+		export_handle->zero_buffer = NULL;
+	}
+	return( result );
+}
+
+/* Updates the digest values of a logical volume with data provided by the sweep
+ * Unmapped regions between the previous and current data are hashed as 0-byte values
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_update_digest_values(
+     export_handle_t *export_handle,
+     int logical_volume_index,
+     off64_t logical_volume_offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	export_handle_digest_value_t *digest_value = NULL;
+	static char *function                      = "export_handle_update_digest_values";
+	size_t zero_data_size                      = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->digest_values == NULL )
+	{
+		return( 1 );
+	}
+	if( ( logical_volume_index < 0 )
+	 || ( logical_volume_index >= export_handle->number_of_digest_values ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid logical volume index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	digest_value = export_handle->digest_values[ logical_volume_index ];
+
+	if( ( digest_value == NULL )
+	 || ( digest_value->is_ordered == 0 ) )
+	{
+		return( 1 );
+	}
+	/* If the data is not provided in order the digest hashes are calculated after the export
+	 */
+	if( logical_volume_offset < digest_value->hashed_offset )
+	{
+		digest_value->is_ordered = 0;
+
+		return( 1 );
+	}
+	while( digest_value->hashed_offset < logical_volume_offset )
+	{
+		zero_data_size = export_handle->buffer_size;
+
+		if( (off64_t) zero_data_size > ( logical_volume_offset - digest_value->hashed_offset ) )
+		{
+			zero_data_size = (size_t) ( logical_volume_offset - digest_value->hashed_offset );
+		}
+		if( export_handle_digest_value_update(
+		     digest_value,
+		     export_handle->zero_buffer,
+		     zero_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update digest value with unmapped data.",
+			 function );
+
+			return( -1 );
+		}
+		digest_value->hashed_offset += (off64_t) zero_data_size;
+	}
+	if( export_handle_digest_value_update(
+	     digest_value,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update digest value.",
+		 function );
+
+		return( -1 );
+	}
+	digest_value->hashed_offset += (off64_t) data_size;
+
+	return( 1 );
+}
+
+/* Finalizes the digest values of the logical volumes
+ * The data of logical volumes that was not provided in order is read to calculate their digest hashes
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int export_handle_finalize_digest_values(
+     export_handle_t *export_handle,
+     libvslvm_volume_group_t *volume_group,
+     libcerror_error_t **error )
+{
+	uint8_t md5_hash[ LIBHMAC_MD5_HASH_SIZE ];
+	uint8_t sha1_hash[ LIBHMAC_SHA1_HASH_SIZE ];
+	uint8_t sha256_hash[ LIBHMAC_SHA256_HASH_SIZE ];
+
+	export_handle_digest_value_t *digest_value = NULL;
+	libvslvm_logical_volume_t *logical_volume  = NULL;
+	uint8_t *buffer                            = NULL;
+	static char *function                      = "export_handle_finalize_digest_values";
+	size64_t logical_volume_size               = 0;
+	size_t data_size                           = 0;
+	ssize_t read_count                         = 0;
+	int logical_volume_index                   = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->digest_values == NULL )
+	{
+		return( 1 );
+	}
+	for( logical_volume_index = 0;
+	     logical_volume_index < export_handle->number_of_digest_values;
+	     logical_volume_index++ )
+	{
+		digest_value = export_handle->digest_values[ logical_volume_index ];
+
+		if( digest_value == NULL )
+		{
+			continue;
+		}
+		if( digest_value->is_ordered == 0 )
+		{
+			/* The digest contexts can contain partial data, start over with new contexts
+			 */
+			logical_volume_size = digest_value->logical_volume_size;
+
+			if( export_handle_digest_value_free(
+			     &( export_handle->digest_values[ logical_volume_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free digest value: %d.",
+				 function,
+				 logical_volume_index );
+
+				goto on_error;
+			}
+			if( export_handle_digest_value_initialize(
+			     export_handle,
+			     &( export_handle->digest_values[ logical_volume_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create digest value: %d.",
+				 function,
+				 logical_volume_index );
+
+				goto on_error;
+			}
+			digest_value = export_handle->digest_values[ logical_volume_index ];
+
+			digest_value->logical_volume_size = logical_volume_size;
+
+			if( buffer == NULL )
+			{
+				buffer = (uint8_t *) memory_allocate(
+				                      sizeof( uint8_t ) * export_handle->buffer_size );
+
+				if( buffer == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create buffer.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( libvslvm_volume_group_get_logical_volume(
+			     volume_group,
+			     logical_volume_index,
+			     &logical_volume,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve logical volume: %d.",
+				 function,
+				 logical_volume_index );
+
+				goto on_error;
+			}
+			fprintf(
+			 export_handle->notify_stream,
+			 "Reading logical volume: %d to calculate digest hashes.\n",
+			 logical_volume_index + 1 );
+
+			while( (size64_t) digest_value->hashed_offset < digest_value->logical_volume_size )
+			{
+				if( export_handle->abort != 0 )
+				{
+					break;
+				}
+				data_size = export_handle->buffer_size;
+
+				if( (size64_t) data_size > ( digest_value->logical_volume_size - digest_value->hashed_offset ) )
+				{
+					data_size = (size_t) ( digest_value->logical_volume_size - digest_value->hashed_offset );
+				}
+				read_count = libvslvm_logical_volume_read_buffer_at_offset(
+				              logical_volume,
+				              buffer,
+				              data_size,
+				              digest_value->hashed_offset,
+				              error );
+
+				if( read_count != (ssize_t) data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read logical volume: %d data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 logical_volume_index,
+					 digest_value->hashed_offset,
+					 digest_value->hashed_offset );
+
+					goto on_error;
+				}
+				if( export_handle_digest_value_update(
+				     digest_value,
+				     buffer,
+				     data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to update digest value: %d.",
+					 function,
+					 logical_volume_index );
+
+					goto on_error;
+				}
+				digest_value->hashed_offset += (off64_t) data_size;
+			}
+			if( libvslvm_logical_volume_free(
+			     &logical_volume,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free logical volume: %d.",
+				 function,
+				 logical_volume_index );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			/* Unmapped data at the end of a logical volume is not provided by the sweep
+			 */
+			while( (size64_t) digest_value->hashed_offset < digest_value->logical_volume_size )
+			{
+				data_size = export_handle->buffer_size;
+
+				if( (size64_t) data_size > ( digest_value->logical_volume_size - digest_value->hashed_offset ) )
+				{
+					data_size = (size_t) ( digest_value->logical_volume_size - digest_value->hashed_offset );
+				}
+				if( export_handle_digest_value_update(
+				     digest_value,
+				     export_handle->zero_buffer,
+				     data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to update digest value: %d with unmapped data.",
+					 function,
+					 logical_volume_index );
+
+					goto on_error;
+				}
+				digest_value->hashed_offset += (off64_t) data_size;
+			}
+		}
+		if( export_handle->abort != 0 )
+		{
+			break;
+		}
+		if( digest_value->md5_context != NULL )
+		{
+			if( libhmac_md5_finalize(
+			     digest_value->md5_context,
+			     md5_hash,
+			     LIBHMAC_MD5_HASH_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to finalize MD5 hash.",
+				 function );
+
+				goto on_error;
+			}
+			if( digest_hash_copy_to_string(
+			     md5_hash,
+			     LIBHMAC_MD5_HASH_SIZE,
+			     digest_value->md5_hash_string,
+			     33,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to create MD5 hash string.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( digest_value->sha1_context != NULL )
+		{
+			if( libhmac_sha1_finalize(
+			     digest_value->sha1_context,
+			     sha1_hash,
+			     LIBHMAC_SHA1_HASH_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to finalize SHA1 hash.",
+				 function );
+
+				goto on_error;
+			}
+			if( digest_hash_copy_to_string(
+			     sha1_hash,
+			     LIBHMAC_SHA1_HASH_SIZE,
+			     digest_value->sha1_hash_string,
+			     41,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to create SHA1 hash string.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( digest_value->sha256_context != NULL )
+		{
+			if( libhmac_sha256_finalize(
+			     digest_value->sha256_context,
+			     sha256_hash,
+			     LIBHMAC_SHA256_HASH_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to finalize SHA256 hash.",
+				 function );
+
+				goto on_error;
+			}
+			if( digest_hash_copy_to_string(
+			     sha256_hash,
+			     LIBHMAC_SHA256_HASH_SIZE,
+			     digest_value->sha256_hash_string,
+			     65,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to create SHA256 hash string.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( export_handle->abort != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( logical_volume != NULL )
+	{
+		libvslvm_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
+/* Initializes the extent hashes of the logical volumes
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_initialize_extent_hashes(
+     export_handle_t *export_handle,
+     libvslvm_volume_group_t *volume_group,
+     libcerror_error_t **error )
+{
+	libvslvm_logical_volume_t *logical_volume = NULL;
+	static char *function                     = "export_handle_initialize_extent_hashes";
+	size64_t extent_size                      = 0;
+	size64_t logical_volume_size              = 0;
+	int logical_volume_index                  = 0;
+	int number_of_logical_volumes             = 0;
+	int result                                = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->extent_hashes != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - extent hashes value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( export_handle->extent_hash_filename == NULL )
+	 && ( export_handle->previous_extent_hash_filename == NULL ) )
+	{
+		return( 1 );
+	}
+	if( libvslvm_volume_group_get_extent_size(
+	     volume_group,
+	     &extent_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extent size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvslvm_volume_group_get_number_of_logical_volumes(
+	     volume_group,
+	     &number_of_logical_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of logical volumes.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_logical_volumes <= 0 )
+	 || ( (size_t) number_of_logical_volumes > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( extent_hashes_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of logical volumes value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	export_handle->extent_hashes = (extent_hashes_t **) memory_allocate(
+	                                                     sizeof( extent_hashes_t * ) * number_of_logical_volumes );
+
+	if( export_handle->extent_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create extent hashes.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     export_handle->extent_hashes,
+	     0,
+	     sizeof( extent_hashes_t * ) * number_of_logical_volumes ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear extent hashes.",
+		 function );
+
+		memory_free(
+		 export_handle->extent_hashes );
+
+		export_handle->extent_hashes = NULL;
+
+		goto on_error;
+	}
+	export_handle->number_of_extent_hashes = number_of_logical_volumes;
+
+	for( logical_volume_index = 0;
+	     logical_volume_index < number_of_logical_volumes;
+	     logical_volume_index++ )
+	{
+		/* Logical volumes with a layout that is not supported are not exported
+		 * and have no extent hashes
+		 */
+		result = export_handle_get_logical_volume(
+		          volume_group,
+		          logical_volume_index,
+		          &logical_volume,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve logical volume: %d.",
+			 function,
+			 logical_volume_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( libvslvm_logical_volume_get_size(
+		     logical_volume,
+		     &logical_volume_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of logical volume: %d.",
+			 function,
+			 logical_volume_index );
+
+			goto on_error;
+		}
+		if( extent_hashes_initialize(
+		     &( export_handle->extent_hashes[ logical_volume_index ] ),
+		     logical_volume_size,
+		     extent_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create extent hashes: %d.",
+			 function,
+			 logical_volume_index );
+
+			goto on_error;
+		}
+		if( libvslvm_logical_volume_free(
+		     &logical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free logical volume: %d.",
+			 function,
+			 logical_volume_index );
+
+			goto on_error;
+		}
+	}
+	if( export_handle->previous_extent_hash_filename != NULL )
+	{
+		if( extent_hash_file_read(
+		     export_handle->previous_extent_hash_filename,
+		     &( export_handle->previous_extent_hashes ),
+		     &( export_handle->number_of_previous_extent_hashes ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read previous extent hash file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	export_handle->number_of_extents         = 0;
+	export_handle->number_of_changed_extents = 0;
+
+	return( 1 );
+
+on_error:
+	if( logical_volume != NULL )
+	{
+		libvslvm_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	export_handle_free_extent_hashes(
+	 export_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Frees the extent hashes of the logical volumes
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_free_extent_hashes(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_free_extent_hashes";
+	int result            = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_hash_file_free_extent_hashes_array(
+	     &( export_handle->extent_hashes ),
+	     &( export_handle->number_of_extent_hashes ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free extent hashes.",
+		 function );
+
+		result = -1;
+	}
+	if( extent_hash_file_free_extent_hashes_array(
+	     &( export_handle->previous_extent_hashes ),
+	     &( export_handle->number_of_previous_extent_hashes ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free previous extent hashes.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Updates the extent hashes of a logical volume with data provided by the sweep
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_update_extent_hashes(
+     export_handle_t *export_handle,
+     int logical_volume_index,
+     off64_t logical_volume_offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_update_extent_hashes";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->extent_hashes == NULL )
+	{
+		return( 1 );
+	}
+	if( ( logical_volume_index < 0 )
+	 || ( logical_volume_index >= export_handle->number_of_extent_hashes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid logical volume index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->extent_hashes[ logical_volume_index ] == NULL )
+	{
+		return( 1 );
+	}
+	/* The sweep reads the allocations of the logical volumes in extent sized units,
+	 * hence the data of an extent is provided in order
+	 */
+	if( extent_hashes_update(
+	     export_handle->extent_hashes[ logical_volume_index ],
+	     logical_volume_offset,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update extent hashes of logical volume: %d.",
+		 function,
+		 logical_volume_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Finalizes the extent hashes of the logical volumes
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_finalize_extent_hashes(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function    = "export_handle_finalize_extent_hashes";
+	int logical_volume_index = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->extent_hashes == NULL )
+	{
+		return( 1 );
+	}
+	for( logical_volume_index = 0;
+	     logical_volume_index < export_handle->number_of_extent_hashes;
+	     logical_volume_index++ )
+	{
+		if( export_handle->extent_hashes[ logical_volume_index ] == NULL )
+		{
+			continue;
+		}
+		if( extent_hashes_finalize(
+		     export_handle->extent_hashes[ logical_volume_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize extent hashes of logical volume: %d.",
+			 function,
+			 logical_volume_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Determines if a logical volume is exported incrementally
+ * A logical volume is exported incrementally if the previous export has extent hashes
+ * of the logical volume with the same size and extent size
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_logical_volume_is_incremental(
+     export_handle_t *export_handle,
+     int logical_volume_index,
+     uint8_t *is_incremental,
+     libcerror_error_t **error )
+{
+	extent_hashes_t *extent_hashes          = NULL;
+	extent_hashes_t *previous_extent_hashes = NULL;
+	static char *function                   = "export_handle_get_logical_volume_is_incremental";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( logical_volume_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid logical volume index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_incremental == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid is incremental.",
+		 function );
+
+		return( -1 );
+	}
+	*is_incremental = 0;
+
+	if( ( export_handle->extent_hashes == NULL )
+	 || ( export_handle->previous_extent_hashes == NULL )
+	 || ( logical_volume_index >= export_handle->number_of_extent_hashes )
+	 || ( logical_volume_index >= export_handle->number_of_previous_extent_hashes ) )
+	{
+		return( 1 );
+	}
+	extent_hashes          = export_handle->extent_hashes[ logical_volume_index ];
+	previous_extent_hashes = export_handle->previous_extent_hashes[ logical_volume_index ];
+
+	if( ( extent_hashes != NULL )
+	 && ( previous_extent_hashes != NULL )
+	 && ( extent_hashes->logical_volume_size == previous_extent_hashes->logical_volume_size )
+	 && ( extent_hashes->extent_size == previous_extent_hashes->extent_size ) )
+	{
+		*is_incremental = 1;
+	}
+	return( 1 );
+}
+
+/* Prints the digest hashes and extent hashes root hash of the logical volumes
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_digest_values_fprint(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	system_character_t root_hash_string[ 65 ];
+
+	export_handle_digest_value_t *digest_value = NULL;
+	extent_hashes_t *extent_hashes             = NULL;
+	static char *function                      = "export_handle_digest_values_fprint";
+	int logical_volume_index                   = 0;
+	int number_of_logical_volumes              = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_logical_volumes = export_handle->number_of_digest_values;
+
+	if( number_of_logical_volumes < export_handle->number_of_extent_hashes )
+	{
+		number_of_logical_volumes = export_handle->number_of_extent_hashes;
+	}
+	for( logical_volume_index = 0;
+	     logical_volume_index < number_of_logical_volumes;
+	     logical_volume_index++ )
+	{
+		digest_value  = NULL;
+		extent_hashes = NULL;
+
+		if( ( export_handle->digest_values != NULL )
+		 && ( logical_volume_index < export_handle->number_of_digest_values ) )
+		{
+			digest_value = export_handle->digest_values[ logical_volume_index ];
+		}
+		if( ( export_handle->extent_hashes != NULL )
+		 && ( logical_volume_index < export_handle->number_of_extent_hashes ) )
+		{
+			extent_hashes = export_handle->extent_hashes[ logical_volume_index ];
+		}
+		if( ( digest_value == NULL )
+		 && ( extent_hashes == NULL ) )
+		{
+			continue;
+		}
+		fprintf(
+		 export_handle->notify_stream,
+		 "\nLogical volume: %d\n",
+		 logical_volume_index + 1 );
+
+		if( extent_hashes != NULL )
+		{
+			if( digest_hash_copy_to_string(
+			     extent_hashes->root_hash,
+			     EXTENT_HASHES_HASH_SIZE,
+			     root_hash_string,
+			     65,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to create extent hashes root hash string.",
+				 function );
+
+				return( -1 );
+			}
+			fprintf(
+			 export_handle->notify_stream,
+			 "Extent hashes root hash:\t\t%" PRIs_SYSTEM "\n",
+			 root_hash_string );
+		}
+		if( digest_value == NULL )
+		{
+			continue;
+		}
+		if( digest_value->md5_context != NULL )
+		{
+			fprintf(
+			 export_handle->notify_stream,
+			 "MD5 hash calculated over data:\t\t%" PRIs_SYSTEM "\n",
+			 digest_value->md5_hash_string );
+		}
+		if( digest_value->sha1_context != NULL )
+		{
+			fprintf(
+			 export_handle->notify_stream,
+			 "SHA1 hash calculated over data:\t\t%" PRIs_SYSTEM "\n",
+			 digest_value->sha1_hash_string );
+		}
+		if( digest_value->sha256_context != NULL )
+		{
+			fprintf(
+			 export_handle->notify_stream,
+			 "SHA256 hash calculated over data:\t%" PRIs_SYSTEM "\n",
+			 digest_value->sha256_hash_string );
+		}
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Updates the digest values and extent hashes with logical volume data and passes the data on to the write threads
+ * Callback function for the hash thread pool
+ * The hash thread pool uses a single thread so that the data is hashed in the order it was read
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_hash_thread_callback(
+     export_handle_write_value_t *write_value,
+     export_handle_t *export_handle )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "export_handle_hash_thread_callback";
+	int result               = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		result = -1;
+	}
+	else if( write_value == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write value.",
+		 function );
+
+		result = -1;
+	}
+	else if( export_handle_update_digest_values(
+	          export_handle,
+	          write_value->logical_volume_index,
+	          write_value->logical_volume_offset,
+	          write_value->data,
+	          write_value->data_size,
+	          &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update digest values.",
+		 function );
+
+		result = -1;
+	}
+	else if( export_handle_update_extent_hashes(
+	          export_handle,
+	          write_value->logical_volume_index,
+	          write_value->logical_volume_offset,
+	          write_value->data,
+	          write_value->data_size,
+	          &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update extent hashes.",
+		 function );
+
+		result = -1;
+	}
+	else if( libcthreads_thread_pool_push(
+	          export_handle->write_thread_pool,
+	          (intptr_t *) write_value,
+	          &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push write value onto write thread pool queue.",
+		 function );
+
+		result = -1;
+	}
+	if( result != 1 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+
+		/* The write error is checked by the thread that pushes the write values
+		 */
+		if( export_handle != NULL )
+		{
+			export_handle->write_error = 1;
+		}
+		if( write_value != NULL )
+		{
+			memory_free(
+			 write_value );
+		}
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Writes logical volume data to the corresponding output file
+ * Callback function for the write thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_thread_callback(
+     export_handle_write_value_t *write_value,
+     export_handle_t *export_handle )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "export_handle_write_thread_callback";
+	int result               = 1;
+
+	if( write_value == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write value.",
+		 function );
+
+		result = -1;
+	}
+	else if( export_handle_write_data(
+	          export_handle,
+	          write_value->logical_volume_index,
+	          write_value->logical_volume_offset,
+	          write_value->data,
+	          write_value->data_size,
+	          write_value->force_write,
+	          &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data.",
+		 function );
+
+		result = -1;
+	}
+	if( result != 1 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+
+		/* The write error is checked by the thread that pushes the write values
+		 */
+		if( export_handle != NULL )
+		{
+			export_handle->write_error = 1;
+		}
+	}
+	if( write_value != NULL )
+	{
+		/* The data is stored in the same allocation as the write value
+		 */
+		memory_free(
+		 write_value );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Writes logical volume data to the corresponding output file
+ * Callback function for libvslvm_volume_group_sweep_logical_volumes
+ * If write threads are used the data is copied and queued to be written by the write threads
+ * Returns 1 if successful, 0 if abort was signalled or -1 on error
+ */
+int export_handle_write_callback(
+     intptr_t *callback_data,
+     int logical_volume_index,
+     off64_t logical_volume_offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	export_handle_write_value_t *write_value = NULL;
+	libcthreads_thread_pool_t *thread_pool   = NULL;
+#endif
+
+	export_handle_t *export_handle           = NULL;
+	static char *function                    = "export_handle_write_callback";
+	uint8_t force_write                      = 0;
+
+	if( callback_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle = (export_handle_t *) callback_data;
+
+	if( export_handle->abort != 0 )
+	{
+		return( 0 );
+	}
+	/* The sweep of a physical volume is stopped if the sweep of another physical volume failed
+	 */
+	if( export_handle->read_error != 0 )
+	{
+		return( 0 );
+	}
+	if( export_handle->write_error != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: write thread failed.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( export_handle->logical_volume_sizes == NULL )
+	 || ( export_handle->logical_volume_end_written == NULL )
+	 || ( export_handle->output_file_io_handles == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing logical volume values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( logical_volume_index < 0 )
+	 || ( logical_volume_index >= export_handle->number_of_output_file_io_handles ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid logical volume index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Logical volumes that are not exported have no output file IO handle
+	 */
+	if( export_handle->output_file_io_handles[ logical_volume_index ] == NULL )
+	{
+		return( 1 );
+	}
+	/* The last block of a logical volume is always written so that the output file
+	 * has the size of the logical volume
+	 */
+	if( (size64_t) logical_volume_offset + buffer_size == export_handle->logical_volume_sizes[ logical_volume_index ] )
+	{
+		export_handle->logical_volume_end_written[ logical_volume_index ] = 1;
+
+		force_write = 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The write callback is called by multiple read threads if the physical volumes are read concurrently
+	 */
+	if( libcthreads_mutex_grab(
+	     export_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	export_handle->read_size += buffer_size;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     export_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->write_thread_pool != NULL )
+	{
+		if( buffer_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - sizeof( export_handle_write_value_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid buffer size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		/* The data is stored in the same allocation as the write value
+		 * and is freed by the write thread
+		 */
+		write_value = (export_handle_write_value_t *) memory_allocate(
+		                                               sizeof( export_handle_write_value_t ) + buffer_size );
+
+		if( write_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create write value.",
+			 function );
+
+			return( -1 );
+		}
+		write_value->logical_volume_index  = logical_volume_index;
+		write_value->logical_volume_offset = logical_volume_offset;
+		write_value->data                  = &( ( (uint8_t *) write_value )[ sizeof( export_handle_write_value_t ) ] );
+		write_value->data_size             = buffer_size;
+		write_value->force_write           = force_write;
+
+		if( memory_copy(
+		     write_value->data,
+		     buffer,
+		     buffer_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			memory_free(
+			 write_value );
+
+			return( -1 );
+		}
+		/* If digest or extent hashes are calculated the write value is passed to the write threads
+		 * by the hash thread. Pushing blocks when the maximum number of queued write values
+		 * is reached, which bounds the amount of buffered data
+		 */
+		if( export_handle->hash_thread_pool != NULL )
+		{
+			thread_pool = export_handle->hash_thread_pool;
+		}
+		else
+		{
+			thread_pool = export_handle->write_thread_pool;
+		}
+		if( libcthreads_thread_pool_push(
+		     thread_pool,
+		     (intptr_t *) write_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push write value onto thread pool queue.",
+			 function );
+
+			memory_free(
+			 write_value );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	if( export_handle_update_digest_values(
+	     export_handle,
+	     logical_volume_index,
+	     logical_volume_offset,
+	     buffer,
+	     buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update digest values.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_update_extent_hashes(
+	     export_handle,
+	     logical_volume_index,
+	     logical_volume_offset,
+	     buffer,
+	     buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update extent hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_write_data(
+	     export_handle,
+	     logical_volume_index,
+	     logical_volume_offset,
+	     buffer,
+	     buffer_size,
+	     force_write,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Hashes logical volume data without writing it
+ * Callback function for libvslvm_volume_group_sweep_logical_volumes
+ * Used to determine the extents that changed since a previous export
+ * Returns 1 if successful, 0 if abort was signalled or -1 on error
+ */
+int export_handle_hash_callback(
+     intptr_t *callback_data,
+     int logical_volume_index,
+     off64_t logical_volume_offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	export_handle_t *export_handle = NULL;
+	static char *function          = "export_handle_hash_callback";
+
+	if( callback_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle = (export_handle_t *) callback_data;
+
+	if( export_handle->abort != 0 )
+	{
+		return( 0 );
+	}
+	if( export_handle->extent_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing extent hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( logical_volume_index < 0 )
+	 || ( logical_volume_index >= export_handle->number_of_extent_hashes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid logical volume index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Logical volumes that are not exported have no extent hashes
+	 */
+	if( export_handle->extent_hashes[ logical_volume_index ] == NULL )
+	{
+		return( 1 );
+	}
+	export_handle->read_size += buffer_size;
+
+	if( export_handle_update_digest_values(
+	     export_handle,
+	     logical_volume_index,
+	     logical_volume_offset,
+	     buffer,
+	     buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update digest values.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_update_extent_hashes(
+	     export_handle,
+	     logical_volume_index,
+	     logical_volume_offset,
+	     buffer,
+	     buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update extent hashes.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Reads the data of a physical volume and passes it to the write callback
+ * Callback function for the read threads
+ * Returns 1 if successful, 0 if the sweep was stopped or -1 on error
+ */
+int export_handle_read_thread_callback(
+     export_handle_read_value_t *read_value )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "export_handle_read_thread_callback";
+
+	if( read_value == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read value.",
+		 function );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	read_value->result = libvslvm_volume_group_sweep_physical_volume_file_io_handle(
+	                      read_value->volume_group,
+	                      read_value->physical_volume_index,
+	                      read_value->file_io_handle,
+	                      read_value->export_handle->buffer_size,
+	                      &export_handle_write_callback,
+	                      (intptr_t *) read_value->export_handle,
+	                      &error );
+
+	if( read_value->result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to sweep physical volume: %d.",
+		 function,
+		 read_value->physical_volume_index );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+
+		/* The read error stops the sweeps of the other physical volumes
+		 */
+		read_value->export_handle->read_error = 1;
+	}
+	return( read_value->result );
+}
+
+/* Reads the physical volumes concurrently, each by a separate read thread
+ * Every read thread uses its own file IO handle so that the reads are not
+ * serialized by the physical volume file IO pool
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int export_handle_read_physical_volumes_concurrently(
+     export_handle_t *export_handle,
+     libvslvm_volume_group_t *volume_group,
+     int number_of_physical_volumes,
+     libcerror_error_t **error )
+{
+	export_handle_read_value_t *read_values = NULL;
+	libbfio_handle_t *file_io_handle        = NULL;
+	libcthreads_thread_t **read_threads     = NULL;
+	static char *function                   = "export_handle_read_physical_volumes_concurrently";
+	int physical_volume_index               = 0;
+	int result                              = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_physical_volumes <= 0 )
+	 || ( (size_t) number_of_physical_volumes > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( export_handle_read_value_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of physical volumes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	read_values = (export_handle_read_value_t *) memory_allocate(
+	                                              sizeof( export_handle_read_value_t ) * number_of_physical_volumes );
+
+	if( read_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read values.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     read_values,
+	     0,
+	     sizeof( export_handle_read_value_t ) * number_of_physical_volumes ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read values.",
+		 function );
+
+		goto on_error;
+	}
+	read_threads = (libcthreads_thread_t **) memory_allocate(
+	                                          sizeof( libcthreads_thread_t * ) * number_of_physical_volumes );
+
+	if( read_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read threads.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     read_threads,
+	     0,
+	     sizeof( libcthreads_thread_t * ) * number_of_physical_volumes ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read threads.",
+		 function );
+
+		goto on_error;
+	}
+	/* The physical volume index corresponds with the entry in the physical volume file IO pool
+	 */
+	for( physical_volume_index = 0;
+	     physical_volume_index < number_of_physical_volumes;
+	     physical_volume_index++ )
+	{
+		read_values[ physical_volume_index ].export_handle         = export_handle;
+		read_values[ physical_volume_index ].volume_group          = volume_group;
+		read_values[ physical_volume_index ].physical_volume_index = physical_volume_index;
+
+		if( libbfio_pool_get_handle(
+		     export_handle->physical_volume_file_io_pool,
+		     physical_volume_index,
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file IO handle: %d from physical volume file IO pool.",
+			 function,
+			 physical_volume_index );
+
+			goto on_error;
+		}
+		if( libbfio_handle_clone(
+		     &( read_values[ physical_volume_index ].file_io_handle ),
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to clone file IO handle: %d.",
+			 function,
+			 physical_volume_index );
+
+			goto on_error;
+		}
+		result = libbfio_handle_is_open(
+		          read_values[ physical_volume_index ].file_io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if file IO handle: %d is open.",
+			 function,
+			 physical_volume_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libbfio_handle_open(
+			     read_values[ physical_volume_index ].file_io_handle,
+			     LIBBFIO_OPEN_READ,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open file IO handle: %d.",
+				 function,
+				 physical_volume_index );
+
+				goto on_error;
+			}
+		}
+	}
+	export_handle->read_error = 0;
+
+	for( physical_volume_index = 0;
+	     physical_volume_index < number_of_physical_volumes;
+	     physical_volume_index++ )
+	{
+		if( libcthreads_thread_create(
+		     &( read_threads[ physical_volume_index ] ),
+		     NULL,
+		     (int (*)(void *)) &export_handle_read_thread_callback,
+		     (void *) &( read_values[ physical_volume_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create read thread: %d.",
+			 function,
+			 physical_volume_index );
+
+			goto on_error;
+		}
+	}
+	for( physical_volume_index = 0;
+	     physical_volume_index < number_of_physical_volumes;
+	     physical_volume_index++ )
+	{
+		if( libcthreads_thread_join(
+		     &( read_threads[ physical_volume_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join read thread: %d.",
+			 function,
+			 physical_volume_index );
+
+			goto on_error;
+		}
+	}
+	/* A sweep that failed takes precedence over a sweep that was stopped
+	 */
+	result = 1;
+
+	for( physical_volume_index = 0;
+	     physical_volume_index < number_of_physical_volumes;
+	     physical_volume_index++ )
+	{
+		if( read_values[ physical_volume_index ].result == -1 )
+		{
+			result = -1;
+		}
+		else if( ( result == 1 )
+		      && ( read_values[ physical_volume_index ].result == 0 ) )
+		{
+			result = 0;
+		}
+		if( libbfio_handle_close(
+		     read_values[ physical_volume_index ].file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle: %d.",
+			 function,
+			 physical_volume_index );
+
+			goto on_error;
+		}
+		if( libbfio_handle_free(
+		     &( read_values[ physical_volume_index ].file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle: %d.",
+			 function,
+			 physical_volume_index );
+
+			goto on_error;
+		}
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to sweep physical volumes.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 read_threads );
+
+	memory_free(
+	 read_values );
+
+	return( result );
+
+on_error:
+	if( read_threads != NULL )
+	{
+		/* The read error stops the read threads that were already created
+		 */
+		export_handle->read_error = 1;
+
+		for( physical_volume_index = 0;
+		     physical_volume_index < number_of_physical_volumes;
+		     physical_volume_index++ )
+		{
+			if( read_threads[ physical_volume_index ] != NULL )
+			{
+				libcthreads_thread_join(
+				 &( read_threads[ physical_volume_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 read_threads );
+	}
+	if( read_values != NULL )
+	{
+		for( physical_volume_index = 0;
+		     physical_volume_index < number_of_physical_volumes;
+		     physical_volume_index++ )
+		{
+			if( read_values[ physical_volume_index ].file_io_handle != NULL )
+			{
+				libbfio_handle_close(
+				 read_values[ physical_volume_index ].file_io_handle,
+				 NULL );
+				libbfio_handle_free(
+				 &( read_values[ physical_volume_index ].file_io_handle ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 read_values );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Sweeps the physical volumes and passes their data to the write callback
+ * If write threads are used and the volume group contains multiple physical volumes,
+ * the physical volumes are read concurrently, otherwise in one sequential sweep
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int export_handle_sweep_physical_volumes(
+     export_handle_t *export_handle,
+     libvslvm_volume_group_t *volume_group,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libvslvm_logical_volume_t *logical_volume = NULL;
+	uint8_t spans_physical_volumes            = 0;
+	uint8_t is_hashed                         = 0;
+	int logical_volume_index                  = 0;
+	int number_of_logical_volumes             = 0;
+	int number_of_physical_volumes            = 0;
+#endif
+
+	static char *function                     = "export_handle_sweep_physical_volumes";
+	int result                                = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->write_thread_pool != NULL )
+	{
+		if( libvslvm_volume_group_get_number_of_physical_volumes(
+		     volume_group,
+		     &number_of_physical_volumes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of physical volumes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The data of a logical volume is hashed in the order it is read, hence the physical volumes
+	 * are only read concurrently if none of the hashed logical volumes spans multiple physical volumes
+	 */
+	if( ( number_of_physical_volumes > 1 )
+	 && ( export_handle->hash_thread_pool != NULL ) )
+	{
+		if( libvslvm_volume_group_get_number_of_logical_volumes(
+		     volume_group,
+		     &number_of_logical_volumes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of logical volumes.",
+			 function );
+
+			goto on_error;
+		}
+		for( logical_volume_index = 0;
+		     logical_volume_index < number_of_logical_volumes;
+		     logical_volume_index++ )
+		{
+			is_hashed = 0;
+
+			if( ( export_handle->digest_values != NULL )
+			 && ( logical_volume_index < export_handle->number_of_digest_values )
+			 && ( export_handle->digest_values[ logical_volume_index ] != NULL ) )
+			{
+				is_hashed = 1;
+			}
+			if( ( export_handle->extent_hashes != NULL )
+			 && ( logical_volume_index < export_handle->number_of_extent_hashes )
+			 && ( export_handle->extent_hashes[ logical_volume_index ] != NULL ) )
+			{
+				is_hashed = 1;
+			}
+			if( is_hashed == 0 )
+			{
+				continue;
+			}
+			result = export_handle_get_logical_volume(
+			          volume_group,
+			          logical_volume_index,
+			          &logical_volume,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve logical volume: %d.",
+				 function,
+				 logical_volume_index );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				continue;
+			}
+			if( export_handle_get_logical_volume_spans_physical_volumes(
+			     logical_volume,
+			     &spans_physical_volumes,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if logical volume: %d spans physical volumes.",
+				 function,
+				 logical_volume_index );
+
+				goto on_error;
+			}
+			if( libvslvm_logical_volume_free(
+			     &logical_volume,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free logical volume: %d.",
+				 function,
+				 logical_volume_index );
+
+				goto on_error;
+			}
+			if( spans_physical_volumes != 0 )
+			{
+				number_of_physical_volumes = 1;
+
+				break;
+			}
+		}
+	}
+	if( number_of_physical_volumes > 1 )
+	{
+		result = export_handle_read_physical_volumes_concurrently(
+		          export_handle,
+		          volume_group,
+		          number_of_physical_volumes,
+		          error );
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	{
+		result = libvslvm_volume_group_sweep_logical_volumes(
+		          volume_group,
+		          export_handle->buffer_size,
+		          &export_handle_write_callback,
+		          (intptr_t *) export_handle,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to sweep logical volumes.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( logical_volume != NULL )
+	{
+		libvslvm_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
+/* Exports the extents of the logical volumes that changed since the previous export
+ * The extent hashes must be finalized. Logical volumes without extent hashes of the
+ * previous export, or with a different size or extent size, are exported entirely
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int export_handle_export_changed_extents(
+     export_handle_t *export_handle,
+     libvslvm_volume_group_t *volume_group,
+     libcerror_error_t **error )
+{
+	extent_hashes_t *extent_hashes            = NULL;
+	libvslvm_logical_volume_t *logical_volume = NULL;
+	uint8_t *buffer                           = NULL;
+	static char *function                     = "export_handle_export_changed_extents";
+	size64_t extent_data_size                 = 0;
+	size64_t remaining_size                   = 0;
+	size_t read_size                          = 0;
+	ssize_t read_count                        = 0;
+	off64_t logical_volume_offset             = 0;
+	uint32_t extent_index                     = 0;
+	uint8_t force_write                       = 0;
+	uint8_t is_incremental                    = 0;
+	int logical_volume_index                  = 0;
+	int result                                = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->extent_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing extent hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_open_output(
+	     export_handle,
+	     volume_group,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output.",
+		 function );
+
+		goto on_error;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * export_handle->buffer_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	for( logical_volume_index = 0;
+	     logical_volume_index < export_handle->number_of_extent_hashes;
+	     logical_volume_index++ )
+	{
+		extent_hashes = export_handle->extent_hashes[ logical_volume_index ];
+
+		if( extent_hashes == NULL )
+		{
+			continue;
+		}
+		if( libvslvm_volume_group_get_logical_volume(
+		     volume_group,
+		     logical_volume_index,
+		     &logical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve logical volume: %d.",
+			 function,
+			 logical_volume_index );
+
+			goto on_error;
+		}
+		if( export_handle_get_logical_volume_is_incremental(
+		     export_handle,
+		     logical_volume_index,
+		     &is_incremental,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if logical volume: %d is exported incrementally.",
+			 function,
+			 logical_volume_index );
+
+			goto on_error;
+		}
+		for( extent_index = 0;
+		     extent_index < extent_hashes->number_of_extents;
+		     extent_index++ )
+		{
+			export_handle->number_of_extents += 1;
+
+			if( is_incremental != 0 )
+			{
+				result = extent_hashes_compare_extent(
+				          extent_hashes,
+				          export_handle->previous_extent_hashes[ logical_volume_index ],
+				          extent_index,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to compare extent: %" PRIu32 " of logical volume: %d.",
+					 function,
+					 extent_index,
+					 logical_volume_index );
+
+					goto on_error;
+				}
+				else if( result == 1 )
+				{
+					continue;
+				}
+			}
+			export_handle->number_of_changed_extents += 1;
+
+			if( extent_hashes_get_extent_data_size(
+			     extent_hashes,
+			     extent_index,
+			     &extent_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve extent: %" PRIu32 " data size.",
+				 function,
+				 extent_index );
+
+				goto on_error;
+			}
+			logical_volume_offset = (off64_t) extent_index * (off64_t) extent_hashes->extent_size;
+			remaining_size        = extent_data_size;
+
+			while( remaining_size > 0 )
+			{
+				if( export_handle->abort != 0 )
+				{
+					break;
+				}
+				read_size = export_handle->buffer_size;
+
+				if( (size64_t) read_size > remaining_size )
+				{
+					read_size = (size_t) remaining_size;
+				}
+				read_count = libvslvm_logical_volume_read_buffer_at_offset(
+				              logical_volume,
+				              buffer,
+				              read_size,
+				              logical_volume_offset,
+				              error );
+
+				if( read_count != (ssize_t) read_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read logical volume: %d data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 logical_volume_index,
+					 logical_volume_offset,
+					 logical_volume_offset );
+
+					goto on_error;
+				}
+				/* The output file of an incremental export is updated in place, hence
+				 * changed data that only contains 0-byte values must be written as well.
+				 * The last block of a logical volume is always written so that the output
+				 * file has the size of the logical volume
+				 */
+				force_write = is_incremental;
+
+				if( (size64_t) logical_volume_offset + read_size == extent_hashes->logical_volume_size )
+				{
+					force_write = 1;
+				}
+				if( export_handle_write_data(
+				     export_handle,
+				     logical_volume_index,
+				     logical_volume_offset,
+				     buffer,
+				     read_size,
+				     force_write,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write data.",
+					 function );
+
+					goto on_error;
+				}
+				logical_volume_offset += (off64_t) read_size;
+				remaining_size        -= read_size;
+			}
+			if( export_handle->abort != 0 )
+			{
+				break;
+			}
+		}
+		if( libvslvm_logical_volume_free(
+		     &logical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free logical volume: %d.",
+			 function,
+			 logical_volume_index );
+
+			goto on_error;
+		}
+		if( export_handle->abort != 0 )
+		{
+			break;
+		}
+	}
+	memory_free(
+	 buffer );
+
+	buffer = NULL;
+
+	if( export_handle_close_output(
+	     export_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close output.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle->abort != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( logical_volume != NULL )
+	{
+		libvslvm_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( export_handle->output_file_io_handles != NULL )
+	{
+		export_handle_close_output(
+		 export_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_EXPORT_HANDLE_KERNEL_COPY )
+
+/* Copies an extent run of a logical volume to the target file
+ * The extent run is cloned using a reflink (FICLONERANGE) if possible, otherwise
+ * it is copied kernel-side using copy_file_range. If neither is supported the data
+ * is read through the logical volume and written from user space
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_copy_extent_run(
+     export_handle_t *export_handle,
+     libvslvm_logical_volume_t *logical_volume,
+     int source_file_descriptor,
+     int target_file_descriptor,
+     off64_t logical_volume_offset,
+     size64_t size,
+     int physical_volume_index,
+     off64_t physical_volume_offset,
+     uint8_t *buffer,
+     libcerror_error_t **error )
+{
+#if defined( FICLONERANGE )
+	struct file_clone_range clone_range;
+#endif
+
+	static char *function = "export_handle_copy_extent_run";
+	off64_t source_offset = 0;
+	off64_t target_offset = 0;
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+	ssize_t write_count   = 0;
+
+#if defined( HAVE_COPY_FILE_RANGE )
+	ssize_t copy_count    = 0;
+#endif
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( logical_volume_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid logical volume offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	source_offset = export_handle->volume_offset + physical_volume_offset;
+	target_offset = logical_volume_offset;
+
+	/* Only the source file is opened as a physical volume, other physical volumes
+	 * cannot be accessed by file descriptor
+	 */
+	if( ( source_file_descriptor != -1 )
+	 && ( physical_volume_index == 0 ) )
+	{
+#if defined( FICLONERANGE )
+		clone_range.src_fd      = (int64_t) source_file_descriptor;
+		clone_range.src_offset  = (uint64_t) source_offset;
+		clone_range.src_length  = (uint64_t) size;
+		clone_range.dest_offset = (uint64_t) target_offset;
+
+		if( ioctl(
+		     target_file_descriptor,
+		     FICLONERANGE,
+		     &clone_range ) == 0 )
+		{
+			export_handle->cloned_size += size;
+			export_handle->read_size   += size;
+
+			return( 1 );
+		}
+#endif /* defined( FICLONERANGE ) */
+
+#if defined( HAVE_COPY_FILE_RANGE )
+		while( size > 0 )
+		{
+			if( export_handle->abort != 0 )
+			{
+				return( 1 );
+			}
+			copy_count = copy_file_range(
+			              source_file_descriptor,
+			              &source_offset,
+			              target_file_descriptor,
+			              &target_offset,
+			              (size_t) ( ( size > (size64_t) SSIZE_MAX ) ? SSIZE_MAX : size ),
+			              0 );
+
+			/* Fall back to a user space copy if copy_file_range is not supported
+			 * for the source and target, for example if they are on different file systems
+			 * on an older kernel
+			 */
+			if( copy_count <= 0 )
+			{
+				break;
+			}
+			export_handle->kernel_copied_size += (size64_t) copy_count;
+			export_handle->read_size          += (size64_t) copy_count;
+
+			size -= (size64_t) copy_count;
+		}
+		if( size == 0 )
+		{
+			return( 1 );
+		}
+#endif /* defined( HAVE_COPY_FILE_RANGE ) */
+	}
+	while( size > 0 )
+	{
+		if( export_handle->abort != 0 )
+		{
+			return( 1 );
+		}
+		read_size = export_handle->buffer_size;
+
+		if( (size64_t) read_size > size )
+		{
+			read_size = (size_t) size;
+		}
+		read_count = libvslvm_logical_volume_read_buffer_at_offset(
+		              logical_volume,
+		              buffer,
+		              read_size,
+		              target_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read logical volume data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 target_offset,
+			 target_offset );
+
+			return( -1 );
+		}
+		if( ( export_handle->write_sparse == 0 )
+		 || ( export_handle_data_is_zero(
+		       buffer,
+		       read_size ) == 0 ) )
+		{
+			write_count = pwrite(
+			               target_file_descriptor,
+			               buffer,
+			               read_size,
+			               target_offset );
+
+			if( write_count != (ssize_t) read_size )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 errno,
+				 "%s: unable to write data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 target_offset,
+				 target_offset );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			export_handle->sparse_size += read_size;
+		}
+		export_handle->read_size += read_size;
+
+		target_offset += (off64_t) read_size;
+		size          -= read_size;
+	}
+	return( 1 );
+}
+
+/* Copies a logical volume to its target file using its extent runs
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int export_handle_copy_logical_volume(
+     export_handle_t *export_handle,
+     libvslvm_logical_volume_t *logical_volume,
+     int logical_volume_index,
+     int source_file_descriptor,
+     uint8_t *buffer,
+     libcerror_error_t **error )
+{
+	system_character_t filename[ 512 ];
+
+	static char *function         = "export_handle_copy_logical_volume";
+	size64_t extent_run_size      = 0;
+	size64_t logical_volume_size  = 0;
+	size_t filename_length        = 0;
+	off64_t logical_offset        = 0;
+	off64_t physical_offset       = 0;
+	uint8_t extent_run_type       = 0;
+	int extent_run_index          = 0;
+	int number_of_extent_runs     = 0;
+	int physical_volume_index     = 0;
+	int target_file_descriptor    = -1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_get_target_filename(
+	     export_handle,
+	     logical_volume_index,
+	     filename,
+	     512,
+	     &filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve target filename of logical volume: %d.",
+		 function,
+		 logical_volume_index );
+
+		goto on_error;
+	}
+	if( libvslvm_logical_volume_get_size(
+	     logical_volume,
+	     &logical_volume_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvslvm_logical_volume_get_number_of_extent_runs(
+	     logical_volume,
+	     &number_of_extent_runs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extent runs.",
+		 function );
+
+		goto on_error;
+	}
+	target_file_descriptor = open(
+	                          filename,
+	                          O_WRONLY | O_CREAT | O_TRUNC,
+	                          0644 );
+
+	if( target_file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open output file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	fprintf(
+	 export_handle->notify_stream,
+	 "Exporting logical volume: %d to: %" PRIs_SYSTEM "\n",
+	 logical_volume_index + 1,
+	 filename );
+
+	/* Set the size first so that unmapped regions remain sparse
+	 */
+	if( ftruncate(
+	     target_file_descriptor,
+	     (off_t) logical_volume_size ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_RESIZE_FAILED,
+		 errno,
+		 "%s: unable to resize output file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	for( extent_run_index = 0;
+	     extent_run_index < number_of_extent_runs;
+	     extent_run_index++ )
+	{
+		if( export_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libvslvm_logical_volume_get_extent_run_by_index(
+		     logical_volume,
+		     extent_run_index,
+		     &logical_offset,
+		     &extent_run_size,
+		     &physical_volume_index,
+		     &physical_offset,
+		     &extent_run_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent run: %d.",
+			 function,
+			 extent_run_index );
+
+			goto on_error;
+		}
+		if( extent_run_type != LIBVSLVM_EXTENT_RUN_TYPE_LINEAR )
+		{
+			continue;
+		}
+		if( export_handle_copy_extent_run(
+		     export_handle,
+		     logical_volume,
+		     source_file_descriptor,
+		     target_file_descriptor,
+		     logical_offset,
+		     extent_run_size,
+		     physical_volume_index,
+		     physical_offset,
+		     buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to copy extent run: %d.",
+			 function,
+			 extent_run_index );
+
+			goto on_error;
+		}
+	}
+	if( close(
+	     target_file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close output file: %s.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	if( export_handle->abort != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( target_file_descriptor != -1 )
+	{
+		close(
+		 target_file_descriptor );
+	}
+	return( -1 );
+}
+
+/* Copies the logical volumes to their target files using their extent runs
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int export_handle_copy_logical_volumes(
+     export_handle_t *export_handle,
+     libvslvm_volume_group_t *volume_group,
+     libcerror_error_t **error )
+{
+	libvslvm_logical_volume_t *logical_volume = NULL;
+	uint8_t *buffer                           = NULL;
+	static char *function                     = "export_handle_copy_logical_volumes";
+	int logical_volume_index                  = 0;
+	int number_of_logical_volumes             = 0;
+	int result                                = 1;
+	int source_file_descriptor                = -1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->source_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing source filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvslvm_volume_group_get_number_of_logical_volumes(
+	     volume_group,
+	     &number_of_logical_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of logical volumes.",
+		 function );
+
+		goto on_error;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * export_handle->buffer_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	/* If the source cannot be opened by file descriptor all data is copied from user space
+	 */
+	source_file_descriptor = open(
+	                          export_handle->source_filename,
+	                          O_RDONLY );
+
+	for( logical_volume_index = 0;
+	     ( result == 1 ) && ( logical_volume_index < number_of_logical_volumes );
+	     logical_volume_index++ )
+	{
+		/* Logical volumes with a layout that is not supported, such as multiple stripes,
+		 * cannot be retrieved and are not exported
+		 */
+		result = export_handle_get_logical_volume(
+		          volume_group,
+		          logical_volume_index,
+		          &logical_volume,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve logical volume: %d.",
+			 function,
+			 logical_volume_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 export_handle->notify_stream,
+			 "Unable to export logical volume: %d unsupported layout.\n",
+			 logical_volume_index + 1 );
+
+			export_handle->number_of_unsupported_logical_volumes += 1;
+
+			result = 1;
+
+			continue;
+		}
+		result = export_handle_copy_logical_volume(
+		          export_handle,
+		          logical_volume,
+		          logical_volume_index,
+		          source_file_descriptor,
+		          buffer,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to copy logical volume: %d.",
+			 function,
+			 logical_volume_index );
+
+			goto on_error;
+		}
+		if( libvslvm_logical_volume_free(
+		     &logical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free logical volume: %d.",
+			 function,
+			 logical_volume_index );
+
+			goto on_error;
+		}
+	}
+	if( source_file_descriptor != -1 )
+	{
+		close(
+		 source_file_descriptor );
+	}
+	memory_free(
+	 buffer );
+
+	return( result );
+
+on_error:
+	if( logical_volume != NULL )
+	{
+		libvslvm_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( source_file_descriptor != -1 )
+	{
+		close(
+		 source_file_descriptor );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_EXPORT_HANDLE_KERNEL_COPY ) */
+
+/* Prints the export statistics
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_statistics_fprint(
+     export_handle_t *export_handle,
+     time_t elapsed_time,
+     libcerror_error_t **error )
+{
+	system_character_t size_string[ 16 ];
+
+	static char *function = "export_handle_statistics_fprint";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = byte_size_string_create(
+	          size_string,
+	          16,
+	          export_handle->read_size,
+	          BYTE_SIZE_STRING_UNIT_MEBIBYTE,
+	          NULL );
+
+	fprintf(
+	 export_handle->notify_stream,
+	 "Exported:\t\t" );
+
+	if( result == 1 )
+	{
+		fprintf(
+		 export_handle->notify_stream,
+		 "%" PRIs_SYSTEM " (%" PRIu64 " bytes)",
+		 size_string,
+		 export_handle->read_size );
+	}
+	else
+	{
+		fprintf(
+		 export_handle->notify_stream,
+		 "%" PRIu64 " bytes",
+		 export_handle->read_size );
+	}
+	fprintf(
+	 export_handle->notify_stream,
+	 " in %" PRIi64 " second(s)\n",
+	 (int64_t) elapsed_time );
+
+	if( elapsed_time > 0 )
+	{
+		result = byte_size_string_create(
+		          size_string,
+		          16,
+		          export_handle->read_size / (uint64_t) elapsed_time,
+		          BYTE_SIZE_STRING_UNIT_MEBIBYTE,
+		          NULL );
+
+		fprintf(
+		 export_handle->notify_stream,
+		 "Throughput:\t\t" );
+
+		if( result == 1 )
+		{
+			fprintf(
+			 export_handle->notify_stream,
+			 "%" PRIs_SYSTEM "/s",
+			 size_string );
+		}
+		fprintf(
+		 export_handle->notify_stream,
+		 " (%" PRIu64 " bytes/s)\n",
+		 export_handle->read_size / (uint64_t) elapsed_time );
+	}
+	if( export_handle->write_sparse != 0 )
+	{
+		fprintf(
+		 export_handle->notify_stream,
+		 "Sparse:\t\t\t%" PRIu64 " bytes of 0-byte values not written\n",
+		 export_handle->sparse_size );
+	}
+	if( export_handle->use_kernel_copy != 0 )
+	{
+		fprintf(
+		 export_handle->notify_stream,
+		 "Cloned:\t\t\t%" PRIu64 " bytes\n",
+		 export_handle->cloned_size );
+
+		fprintf(
+		 export_handle->notify_stream,
+		 "Kernel copied:\t\t%" PRIu64 " bytes\n",
+		 export_handle->kernel_copied_size );
+	}
+	if( export_handle->previous_extent_hash_filename != NULL )
+	{
+		fprintf(
+		 export_handle->notify_stream,
+		 "Changed extents:\t%" PRIu64 " of %" PRIu64 "\n",
+		 export_handle->number_of_changed_extents,
+		 export_handle->number_of_extents );
+	}
+	return( 1 );
+}
+
+/* Exports the logical volumes
+ * The physical volumes are read in one sequential sweep and the data is written to the output file of
+ * the logical volume it belongs to. If a previous extent hash file was set only the extents that changed
+ * since the previous export are written
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int export_handle_export_logical_volumes(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	uint8_t zero_byte[ 1 ]                = { 0 };
+
+	libvslvm_volume_group_t *volume_group = NULL;
+	static char *function                 = "export_handle_export_logical_volumes";
+	size64_t logical_volume_size          = 0;
+	time_t start_time                     = 0;
+	ssize_t write_count                   = 0;
+	int logical_volume_index              = 0;
+	int number_of_logical_volumes         = 0;
+	int result                            = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvslvm_handle_get_volume_group(
+	     export_handle->input_handle,
+	     &volume_group,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume group.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvslvm_volume_group_get_number_of_logical_volumes(
+	     volume_group,
+	     &number_of_logical_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of logical volumes.",
+		 function );
+
+		goto on_error;
+	}
+	export_handle->number_of_unsupported_logical_volumes = 0;
+
+	if( number_of_logical_volumes == 0 )
+	{
+		fprintf(
+		 export_handle->notify_stream,
+		 "No logical volumes to export.\n" );
+	}
+#if defined( HAVE_EXPORT_HANDLE_KERNEL_COPY )
+	else if( ( export_handle->use_kernel_copy != 0 )
+	      && ( export_handle->extent_hash_filename == NULL )
+	      && ( export_handle->previous_extent_hash_filename == NULL ) )
+	{
+		/* The data of kernel-side copies does not pass through user space,
+		 * hence the digest hashes are calculated after the copy
+		 */
+		if( export_handle_initialize_digest_values(
+		     export_handle,
+		     volume_group,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize digest values.",
+			 function );
+
+			goto on_error;
+		}
+		export_handle->read_size          = 0;
+		export_handle->sparse_size        = 0;
+		export_handle->cloned_size        = 0;
+		export_handle->kernel_copied_size = 0;
+
+		start_time = time(
+		              NULL );
+
+		result = export_handle_copy_logical_volumes(
+		          export_handle,
+		          volume_group,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to copy logical volumes.",
+			 function );
+
+			goto on_error;
+		}
+		if( result == 1 )
+		{
+			result = export_handle_finalize_digest_values(
+			          export_handle,
+			          volume_group,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to finalize digest values.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( export_handle_statistics_fprint(
+		     export_handle,
+		     time( NULL ) - start_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print statistics.",
+			 function );
+
+			goto on_error;
+		}
+		if( result == 1 )
+		{
+			if( export_handle_digest_values_fprint(
+			     export_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print digest hashes.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( export_handle_free_digest_values(
+		     export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free digest values.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_EXPORT_HANDLE_KERNEL_COPY ) */
+	else
+	{
+		if( export_handle_initialize_digest_values(
+		     export_handle,
+		     volume_group,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize digest values.",
+			 function );
+
+			goto on_error;
+		}
+		if( export_handle_initialize_extent_hashes(
+		     export_handle,
+		     volume_group,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize extent hashes.",
+			 function );
+
+			goto on_error;
+		}
+		export_handle->read_size   = 0;
+		export_handle->sparse_size = 0;
+		export_handle->write_error = 0;
+		export_handle->read_error  = 0;
+
+		start_time = time(
+		              NULL );
+
+		if( export_handle->previous_extent_hash_filename != NULL )
+		{
+			/* The extents that changed since the previous export are determined by
+			 * hashing the logical volumes in one sequential sweep, after which only
+			 * the changed extents are read again and written
+			 */
+			result = libvslvm_volume_group_sweep_logical_volumes(
+			          volume_group,
+			          export_handle->buffer_size,
+			          &export_handle_hash_callback,
+			          (intptr_t *) export_handle,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to sweep logical volumes.",
+				 function );
+
+				goto on_error;
+			}
+			if( result == 1 )
+			{
+				if( export_handle_finalize_extent_hashes(
+				     export_handle,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to finalize extent hashes.",
+					 function );
+
+					goto on_error;
+				}
+				result = export_handle_export_changed_extents(
+				          export_handle,
+				          volume_group,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to export changed extents.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+		else
+		{
+			if( export_handle_open_output(
+			     export_handle,
+			     volume_group,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open output.",
+				 function );
+
+				goto on_error;
+			}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			if( export_handle->number_of_threads > 0 )
+			{
+				if( libcthreads_thread_pool_create(
+				     &( export_handle->write_thread_pool ),
+				     NULL,
+				     export_handle->number_of_threads,
+				     2 * export_handle->number_of_threads,
+				     (int (*)(intptr_t *, void *)) &export_handle_write_thread_callback,
+				     (void *) export_handle,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create write thread pool.",
+					 function );
+
+					goto on_error;
+				}
+				/* A single hash thread is used so that the data of a logical volume
+				 * is hashed in the order it was read
+				 */
+				if( ( export_handle->digest_values != NULL )
+				 || ( export_handle->extent_hashes != NULL ) )
+				{
+					if( libcthreads_thread_pool_create(
+					     &( export_handle->hash_thread_pool ),
+					     NULL,
+					     1,
+					     2 * export_handle->number_of_threads,
+					     (int (*)(intptr_t *, void *)) &export_handle_hash_thread_callback,
+					     (void *) export_handle,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+						 "%s: unable to create hash thread pool.",
+						 function );
+
+						goto on_error;
+					}
+				}
+			}
+#endif
+			result = export_handle_sweep_physical_volumes(
+			          export_handle,
+			          volume_group,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to sweep physical volumes.",
+				 function );
+
+				goto on_error;
+			}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			/* Joining waits until all queued write values have been hashed and written,
+			 * the hash thread pool is joined first since it passes the write values
+			 * on to the write thread pool
+			 */
+			if( export_handle->hash_thread_pool != NULL )
+			{
+				if( libcthreads_thread_pool_join(
+				     &( export_handle->hash_thread_pool ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to join hash thread pool.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( export_handle->write_thread_pool != NULL )
+			{
+				if( libcthreads_thread_pool_join(
+				     &( export_handle->write_thread_pool ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to join write thread pool.",
+					 function );
+
+					goto on_error;
+				}
+			}
+#endif
+			if( export_handle->write_error != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write logical volume data.",
+				 function );
+
+				goto on_error;
+			}
+			/* Unmapped data at the end of a logical volume is not read by the sweep,
+			 * write the last byte so that the output file has the size of the logical volume
+			 */
+			for( logical_volume_index = 0;
+			     ( result == 1 ) && ( logical_volume_index < number_of_logical_volumes );
+			     logical_volume_index++ )
+			{
+				logical_volume_size = export_handle->logical_volume_sizes[ logical_volume_index ];
+
+				if( ( logical_volume_size == 0 )
+				 || ( export_handle->logical_volume_end_written[ logical_volume_index ] != 0 ) )
+				{
+					continue;
+				}
+				write_count = libbfio_handle_write_buffer_at_offset(
+				               export_handle->output_file_io_handles[ logical_volume_index ],
+				               zero_byte,
+				               1,
+				               (off64_t) logical_volume_size - 1,
+				               error );
+
+				if( write_count != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write end of logical volume: %d.",
+					 function,
+					 logical_volume_index );
+
+					goto on_error;
+				}
+			}
+			if( export_handle_close_output(
+			     export_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close output.",
+				 function );
+
+				goto on_error;
+			}
+			if( result == 1 )
+			{
+				if( export_handle_finalize_extent_hashes(
+				     export_handle,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to finalize extent hashes.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+		if( result == 1 )
+		{
+			result = export_handle_finalize_digest_values(
+			          export_handle,
+			          volume_group,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to finalize digest values.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( export_handle_statistics_fprint(
+		     export_handle,
+		     time( NULL ) - start_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print statistics.",
+			 function );
+
+			goto on_error;
+		}
+		if( result == 1 )
+		{
+			if( export_handle_digest_values_fprint(
+			     export_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print digest hashes.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( ( result == 1 )
+		 && ( export_handle->extent_hash_filename != NULL ) )
+		{
+			if( extent_hash_file_write(
+			     export_handle->extent_hash_filename,
+			     export_handle->extent_hashes,
+			     export_handle->number_of_extent_hashes,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write extent hash file.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( export_handle_free_digest_values(
+		     export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free digest values.",
+			 function );
+
+			goto on_error;
+		}
+		if( export_handle_free_extent_hashes(
+		     export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free extent hashes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libvslvm_volume_group_free(
+	     &volume_group,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free volume group.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->hash_thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &( export_handle->hash_thread_pool ),
+		 NULL );
+	}
+	if( export_handle->write_thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &( export_handle->write_thread_pool ),
+		 NULL );
+	}
+#endif
+	if( export_handle->digest_values != NULL )
+	{
+		export_handle_free_digest_values(
+		 export_handle,
+		 NULL );
+	}
+	export_handle_free_extent_hashes(
+	 export_handle,
+	 NULL );
+
+	if( export_handle->output_file_io_handles != NULL )
+	{
+		export_handle_close_output(
+		 export_handle,
+		 NULL );
+	}
+	if( volume_group != NULL )
+	{
+		libvslvm_volume_group_free(
+		 &volume_group,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,604 @@
+/*
+ * Export handle
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXPORT_HANDLE_H )
+#define _EXPORT_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( TIME_WITH_SYS_TIME )
+#include <sys/time.h>
+#include <time.h>
+#elif defined( HAVE_SYS_TIME_H )
+#include <sys/time.h>
+#else
+#include <time.h>
+#endif
+
+#include "extent_hashes.h"
+#include "vslvmtools_libbfio.h"
+#include "vslvmtools_libcerror.h"
+#include "vslvmtools_libcthreads.h"
+#include "vslvmtools_libhmac.h"
+#include "vslvmtools_libvslvm.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define EXPORT_HANDLE_DEFAULT_BUFFER_SIZE		1024 * 1024
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS		64
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+#define EXPORT_HANDLE_DEFAULT_NUMBER_OF_THREADS		4
+#else
+#define EXPORT_HANDLE_DEFAULT_NUMBER_OF_THREADS		0
+#endif
+
+/* Kernel-side copies of the logical volume extents require file descriptors
+ */
+#if defined( HAVE_OPEN ) && defined( HAVE_FTRUNCATE ) && defined( HAVE_PWRITE ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) && !defined( WINAPI )
+#define HAVE_EXPORT_HANDLE_KERNEL_COPY
+#endif
+
+typedef struct export_handle_write_value export_handle_write_value_t;
+
+struct export_handle_write_value
+{
+	/* The logical volume index
+	 */
+	int logical_volume_index;
+
+	/* The logical volume offset
+	 */
+	off64_t logical_volume_offset;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* Value to indicate the data should be written even if it only contains 0-byte values
+	 */
+	uint8_t force_write;
+};
+
+typedef struct export_handle export_handle_t;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct export_handle_read_value export_handle_read_value_t;
+
+struct export_handle_read_value
+{
+	/* The export handle
+	 */
+	export_handle_t *export_handle;
+
+	/* The volume group
+	 */
+	libvslvm_volume_group_t *volume_group;
+
+	/* The physical volume index
+	 */
+	int physical_volume_index;
+
+	/* The file IO handle used to read the physical volume
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The result of the sweep of the physical volume
+	 */
+	int result;
+};
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+typedef struct export_handle_digest_value export_handle_digest_value_t;
+
+struct export_handle_digest_value
+{
+	/* The logical volume size
+	 */
+	size64_t logical_volume_size;
+
+	/* The offset up to which the logical volume data has been hashed
+	 */
+	off64_t hashed_offset;
+
+	/* Value to indicate the sweep provides the logical volume data in order
+	 * Digest hashes of logical volumes that are not provided in order are
+	 * calculated after the export
+	 */
+	uint8_t is_ordered;
+
+	/* The MD5 context
+	 */
+	libhmac_md5_context_t *md5_context;
+
+	/* The MD5 hash string
+	 */
+	system_character_t md5_hash_string[ 33 ];
+
+	/* The SHA1 context
+	 */
+	libhmac_sha1_context_t *sha1_context;
+
+	/* The SHA1 hash string
+	 */
+	system_character_t sha1_hash_string[ 41 ];
+
+	/* The SHA256 context
+	 */
+	libhmac_sha256_context_t *sha256_context;
+
+	/* The SHA256 hash string
+	 */
+	system_character_t sha256_hash_string[ 65 ];
+};
+
+struct export_handle
+{
+	/* The volume offset
+	 */
+	off64_t volume_offset;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The number of write threads
+	 */
+	int number_of_threads;
+
+	/* Value to indicate if the logical volume extents should be copied kernel-side
+	 * using reflinks or copy_file_range instead of reading them through the sweep
+	 */
+	uint8_t use_kernel_copy;
+
+	/* Value to indicate if the output should be written sparse
+	 * Blocks that only contain 0-byte values are not written
+	 */
+	uint8_t write_sparse;
+
+	/* Value to indicate if the MD5 digest hash should be calculated
+	 */
+	uint8_t calculate_md5;
+
+	/* Value to indicate if the SHA1 digest hash should be calculated
+	 */
+	uint8_t calculate_sha1;
+
+	/* Value to indicate if the SHA256 digest hash should be calculated
+	 */
+	uint8_t calculate_sha256;
+
+	/* The source filename
+	 */
+	system_character_t *source_filename;
+
+	/* The target path prefix
+	 */
+	system_character_t *target_path_prefix;
+
+	/* The target path prefix size
+	 */
+	size_t target_path_prefix_size;
+
+	/* The libbfio physical volume file IO pool
+	 */
+	libbfio_pool_t *physical_volume_file_io_pool;
+
+	/* The libvslvm input handle
+	 */
+	libvslvm_handle_t *input_handle;
+
+	/* The output file IO handles, one per logical volume
+	 */
+	libbfio_handle_t **output_file_io_handles;
+
+	/* The number of output file IO handles
+	 */
+	int number_of_output_file_io_handles;
+
+	/* The sizes of the logical volumes
+	 */
+	size64_t *logical_volume_sizes;
+
+	/* Values to indicate the last block of a logical volume was written
+	 */
+	uint8_t *logical_volume_end_written;
+
+	/* The number of bytes read
+	 */
+	size64_t read_size;
+
+	/* The number of bytes not written because they only contain 0-byte values
+	 */
+	size64_t sparse_size;
+
+	/* The number of bytes cloned using reflinks
+	 */
+	size64_t cloned_size;
+
+	/* The number of bytes copied using copy_file_range
+	 */
+	size64_t kernel_copied_size;
+
+	/* The digest values, one per logical volume
+	 */
+	export_handle_digest_value_t **digest_values;
+
+	/* The number of digest values
+	 */
+	int number_of_digest_values;
+
+	/* Buffer with 0-byte values used to hash unmapped regions
+	 */
+	uint8_t *zero_buffer;
+
+	/* The extent hash filename
+	 */
+	system_character_t *extent_hash_filename;
+
+	/* The extent hash filename of a previous export
+	 * If set only the extents that changed since the previous export are written
+	 */
+	system_character_t *previous_extent_hash_filename;
+
+	/* The extent hashes, one per logical volume
+	 */
+	extent_hashes_t **extent_hashes;
+
+	/* The number of extent hashes
+	 */
+	int number_of_extent_hashes;
+
+	/* The extent hashes of the previous export
+	 */
+	extent_hashes_t **previous_extent_hashes;
+
+	/* The number of extent hashes of the previous export
+	 */
+	int number_of_previous_extent_hashes;
+
+	/* The number of extents
+	 */
+	uint64_t number_of_extents;
+
+	/* The number of extents that changed since the previous export
+	 */
+	uint64_t number_of_changed_extents;
+
+	/* The number of logical volumes that were not exported
+	 * because their layout is not supported
+	 */
+	int number_of_unsupported_logical_volumes;
+
+	/* Value to indicate a write error occurred in a write thread
+	 */
+	int write_error;
+
+	/* Value to indicate a read error occurred in a read thread
+	 */
+	int read_error;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The hash thread pool
+	 */
+	libcthreads_thread_pool_t *hash_thread_pool;
+
+	/* The write thread pool
+	 */
+	libcthreads_thread_pool_t *write_thread_pool;
+
+	/* The mutex that protects the values updated by the read and write threads
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int export_handle_system_string_copy_from_64_bit_in_decimal(
+     const system_character_t *string,
+     size_t string_size,
+     uint64_t *value_64bit,
+     libcerror_error_t **error );
+
+int export_handle_initialize(
+     export_handle_t **export_handle,
+     libcerror_error_t **error );
+
+int export_handle_free(
+     export_handle_t **export_handle,
+     libcerror_error_t **error );
+
+int export_handle_signal_abort(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_set_volume_offset(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_buffer_size(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_number_of_threads(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_digest_types(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_extent_hash_filename(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_set_previous_extent_hash_filename(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_set_target_path_prefix(
+     export_handle_t *export_handle,
+     const system_character_t *target_path_prefix,
+     size_t target_path_prefix_size,
+     libcerror_error_t **error );
+
+int export_handle_open_input(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_close_input(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_get_target_filename(
+     export_handle_t *export_handle,
+     int logical_volume_index,
+     system_character_t *filename,
+     size_t filename_size,
+     size_t *filename_length,
+     libcerror_error_t **error );
+
+int export_handle_open_output(
+     export_handle_t *export_handle,
+     libvslvm_volume_group_t *volume_group,
+     libcerror_error_t **error );
+
+int export_handle_close_output(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_data_is_zero(
+     const uint8_t *data,
+     size_t data_size );
+
+int export_handle_write_data(
+     export_handle_t *export_handle,
+     int logical_volume_index,
+     off64_t logical_volume_offset,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t force_write,
+     libcerror_error_t **error );
+
+int export_handle_get_logical_volume(
+     libvslvm_volume_group_t *volume_group,
+     int logical_volume_index,
+     libvslvm_logical_volume_t **logical_volume,
+     libcerror_error_t **error );
+
+int export_handle_get_logical_volume_is_ordered(
+     libvslvm_logical_volume_t *logical_volume,
+     uint8_t *is_ordered,
+     libcerror_error_t **error );
+
+int export_handle_get_logical_volume_spans_physical_volumes(
+     libvslvm_logical_volume_t *logical_volume,
+     uint8_t *spans_physical_volumes,
+     libcerror_error_t **error );
+
+int export_handle_digest_value_initialize(
+     export_handle_t *export_handle,
+     export_handle_digest_value_t **digest_value,
+     libcerror_error_t **error );
+
+int export_handle_digest_value_free(
+     export_handle_digest_value_t **digest_value,
+     libcerror_error_t **error );
+
+int export_handle_digest_value_update(
+     export_handle_digest_value_t *digest_value,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int export_handle_initialize_digest_values(
+     export_handle_t *export_handle,
+     libvslvm_volume_group_t *volume_group,
+     uint8_t use_sweep,
+     libcerror_error_t **error );
+
+int export_handle_free_digest_values(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_update_digest_values(
+     export_handle_t *export_handle,
+     int logical_volume_index,
+     off64_t logical_volume_offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int export_handle_finalize_digest_values(
+     export_handle_t *export_handle,
+     libvslvm_volume_group_t *volume_group,
+     libcerror_error_t **error );
+
+int export_handle_initialize_extent_hashes(
+     export_handle_t *export_handle,
+     libvslvm_volume_group_t *volume_group,
+     libcerror_error_t **error );
+
+int export_handle_free_extent_hashes(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_update_extent_hashes(
+     export_handle_t *export_handle,
+     int logical_volume_index,
+     off64_t logical_volume_offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int export_handle_finalize_extent_hashes(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_get_logical_volume_is_incremental(
+     export_handle_t *export_handle,
+     int logical_volume_index,
+     uint8_t *is_incremental,
+     libcerror_error_t **error );
+
+int export_handle_digest_values_fprint(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int export_handle_hash_thread_callback(
+     export_handle_write_value_t *write_value,
+     export_handle_t *export_handle );
+
+int export_handle_write_thread_callback(
+     export_handle_write_value_t *write_value,
+     export_handle_t *export_handle );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int export_handle_write_callback(
+     intptr_t *callback_data,
+     int logical_volume_index,
+     off64_t logical_volume_offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int export_handle_hash_callback(
+     intptr_t *callback_data,
+     int logical_volume_index,
+     off64_t logical_volume_offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int export_handle_read_thread_callback(
+     export_handle_read_value_t *read_value );
+
+int export_handle_read_physical_volumes_concurrently(
+     export_handle_t *export_handle,
+     libvslvm_volume_group_t *volume_group,
+     int number_of_physical_volumes,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int export_handle_sweep_physical_volumes(
+     export_handle_t *export_handle,
+     libvslvm_volume_group_t *volume_group,
+     libcerror_error_t **error );
+
+int export_handle_export_changed_extents(
+     export_handle_t *export_handle,
+     libvslvm_volume_group_t *volume_group,
+     libcerror_error_t **error );
+
+#if defined( HAVE_EXPORT_HANDLE_KERNEL_COPY )
+
+int export_handle_copy_extent_run(
+     export_handle_t *export_handle,
+     libvslvm_logical_volume_t *logical_volume,
+     int source_file_descriptor,
+     int target_file_descriptor,
+     off64_t logical_volume_offset,
+     size64_t size,
+     int physical_volume_index,
+     off64_t physical_volume_offset,
+     uint8_t *buffer,
+     libcerror_error_t **error );
+
+int export_handle_copy_logical_volume(
+     export_handle_t *export_handle,
+     libvslvm_logical_volume_t *logical_volume,
+     int logical_volume_index,
+     int source_file_descriptor,
+     uint8_t *buffer,
+     libcerror_error_t **error );
+
+int export_handle_copy_logical_volumes(
+     export_handle_t *export_handle,
+     libvslvm_volume_group_t *volume_group,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_EXPORT_HANDLE_KERNEL_COPY ) */
+
+int export_handle_statistics_fprint(
+     export_handle_t *export_handle,
+     time_t elapsed_time,
+     libcerror_error_t **error );
+
+int export_handle_export_logical_volumes(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EXPORT_HANDLE_H ) */
+
@@ -0,0 +1,820 @@
+/*
+ * Extent hash file functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "extent_hash_file.h"
+#include "extent_hashes.h"
+#include "vslvmtools_libbfio.h"
+#include "vslvmtools_libcerror.h"
+
+/* The extent hash file consists of:
+ * a file header:
+ *   0x00 signature "VSLVMEXH"
+ *   0x08 format version (32-bit little-endian)
+ *   0x0c number of entries (32-bit little-endian)
+ * followed by an entry per logical volume:
+ *   0x00 logical volume size (64-bit little-endian)
+ *   0x08 extent size (64-bit little-endian)
+ *   0x10 number of extents (32-bit little-endian)
+ *   0x14 flags (32-bit little-endian)
+ *   0x18 Merkle tree root hash (32 bytes), see extent_hashes_calculate_root_hash
+ *   0x38 extent hashes (32 bytes per extent), only if the entry is set
+ *
+ * Format version 2 uses the RFC 6962 node type prefixes to calculate
+ * the root hash, format version 1 hash files are not supported
+ */
+
+/* Creates and opens a file IO handle of an extent hash file
+ * Make sure the value file_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int extent_hash_file_open_file_io_handle(
+     const system_character_t *filename,
+     int access_flags,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function  = "extent_hash_file_open_file_io_handle";
+	size_t filename_length = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+	if( libbfio_file_initialize(
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_set_name_wide(
+	     *file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#else
+	if( libbfio_file_set_name(
+	     *file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name of file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     *file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open extent hash file: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the extent hashes of the logical volumes to an extent hash file
+ * The extent hashes must be finalized
+ * Returns 1 if successful or -1 on error
+ */
+int extent_hash_file_write(
+     const system_character_t *filename,
+     extent_hashes_t **extent_hashes_array,
+     int number_of_extent_hashes,
+     libcerror_error_t **error )
+{
+	uint8_t entry_header_data[ EXTENT_HASH_FILE_ENTRY_HEADER_SIZE ];
+	uint8_t file_header_data[ EXTENT_HASH_FILE_HEADER_SIZE ];
+
+	extent_hashes_t *extent_hashes   = NULL;
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "extent_hash_file_write";
+	size_t hashes_size               = 0;
+	ssize_t write_count              = 0;
+	int entry_index                  = 0;
+
+	if( ( extent_hashes_array == NULL )
+	 && ( number_of_extent_hashes != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent hashes array.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_extent_hashes < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of extent hashes value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_hash_file_open_file_io_handle(
+	     filename,
+	     LIBBFIO_OPEN_WRITE_TRUNCATE,
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open extent hash file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     file_header_data,
+	     EXTENT_HASH_FILE_SIGNATURE,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_header_data[ 8 ] ),
+	 EXTENT_HASH_FILE_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_header_data[ 12 ] ),
+	 (uint32_t) number_of_extent_hashes );
+
+	write_count = libbfio_handle_write_buffer(
+	               file_io_handle,
+	               file_header_data,
+	               EXTENT_HASH_FILE_HEADER_SIZE,
+	               error );
+
+	if( write_count != (ssize_t) EXTENT_HASH_FILE_HEADER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file header.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_extent_hashes;
+	     entry_index++ )
+	{
+		extent_hashes = extent_hashes_array[ entry_index ];
+
+		if( memory_set(
+		     entry_header_data,
+		     0,
+		     EXTENT_HASH_FILE_ENTRY_HEADER_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear entry header data.",
+			 function );
+
+			goto on_error;
+		}
+		if( extent_hashes != NULL )
+		{
+			byte_stream_copy_from_uint64_little_endian(
+			 &( entry_header_data[ 0 ] ),
+			 extent_hashes->logical_volume_size );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 &( entry_header_data[ 8 ] ),
+			 extent_hashes->extent_size );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 &( entry_header_data[ 16 ] ),
+			 extent_hashes->number_of_extents );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 &( entry_header_data[ 20 ] ),
+			 EXTENT_HASH_FILE_ENTRY_FLAG_IS_SET );
+
+			if( memory_copy(
+			     &( entry_header_data[ 24 ] ),
+			     extent_hashes->root_hash,
+			     EXTENT_HASHES_HASH_SIZE ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy root hash.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		write_count = libbfio_handle_write_buffer(
+		               file_io_handle,
+		               entry_header_data,
+		               EXTENT_HASH_FILE_ENTRY_HEADER_SIZE,
+		               error );
+
+		if( write_count != (ssize_t) EXTENT_HASH_FILE_ENTRY_HEADER_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write entry: %d header.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( ( extent_hashes == NULL )
+		 || ( extent_hashes->number_of_extents == 0 ) )
+		{
+			continue;
+		}
+		hashes_size = (size_t) extent_hashes->number_of_extents * EXTENT_HASHES_HASH_SIZE;
+
+		write_count = libbfio_handle_write_buffer(
+		               file_io_handle,
+		               extent_hashes->hashes,
+		               hashes_size,
+		               error );
+
+		if( write_count != (ssize_t) hashes_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write entry: %d extent hashes.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	if( libbfio_handle_close(
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close extent hash file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the extent hashes of the logical volumes from an extent hash file
+ * Entries of logical volumes that were not exported are set to NULL
+ * Make sure the value extent_hashes_array is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int extent_hash_file_read(
+     const system_character_t *filename,
+     extent_hashes_t ***extent_hashes_array,
+     int *number_of_extent_hashes,
+     libcerror_error_t **error )
+{
+	uint8_t entry_header_data[ EXTENT_HASH_FILE_ENTRY_HEADER_SIZE ];
+	uint8_t file_header_data[ EXTENT_HASH_FILE_HEADER_SIZE ];
+
+	extent_hashes_t *extent_hashes   = NULL;
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "extent_hash_file_read";
+	size64_t extent_size             = 0;
+	size64_t logical_volume_size     = 0;
+	size_t hashes_size               = 0;
+	ssize_t read_count               = 0;
+	uint32_t flags                   = 0;
+	uint32_t format_version          = 0;
+	uint32_t number_of_entries       = 0;
+	uint32_t number_of_extents       = 0;
+	int entry_index                  = 0;
+
+	if( extent_hashes_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent hashes array.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extent_hashes_array != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid extent hashes array value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_extent_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extent hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_hash_file_open_file_io_handle(
+	     filename,
+	     LIBBFIO_OPEN_READ,
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open extent hash file.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              file_header_data,
+	              EXTENT_HASH_FILE_HEADER_SIZE,
+	              error );
+
+	if( read_count != (ssize_t) EXTENT_HASH_FILE_HEADER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_compare(
+	     file_header_data,
+	     EXTENT_HASH_FILE_SIGNATURE,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( file_header_data[ 8 ] ),
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( file_header_data[ 12 ] ),
+	 number_of_entries );
+
+	if( format_version != EXTENT_HASH_FILE_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		goto on_error;
+	}
+	if( ( number_of_entries > (uint32_t) INT_MAX )
+	 || ( (size_t) number_of_entries > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( extent_hashes_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_entries > 0 )
+	{
+		*extent_hashes_array = (extent_hashes_t **) memory_allocate(
+		                                             sizeof( extent_hashes_t * ) * number_of_entries );
+
+		if( *extent_hashes_array == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create extent hashes array.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     *extent_hashes_array,
+		     0,
+		     sizeof( extent_hashes_t * ) * number_of_entries ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear extent hashes array.",
+			 function );
+
+			memory_free(
+			 *extent_hashes_array );
+
+			*extent_hashes_array = NULL;
+
+			goto on_error;
+		}
+	}
+	*number_of_extent_hashes = (int) number_of_entries;
+
+	for( entry_index = 0;
+	     entry_index < (int) number_of_entries;
+	     entry_index++ )
+	{
+		read_count = libbfio_handle_read_buffer(
+		              file_io_handle,
+		              entry_header_data,
+		              EXTENT_HASH_FILE_ENTRY_HEADER_SIZE,
+		              error );
+
+		if( read_count != (ssize_t) EXTENT_HASH_FILE_ENTRY_HEADER_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read entry: %d header.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( entry_header_data[ 20 ] ),
+		 flags );
+
+		if( ( flags & EXTENT_HASH_FILE_ENTRY_FLAG_IS_SET ) == 0 )
+		{
+			continue;
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 &( entry_header_data[ 0 ] ),
+		 logical_volume_size );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( entry_header_data[ 8 ] ),
+		 extent_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( entry_header_data[ 16 ] ),
+		 number_of_extents );
+
+		if( extent_hashes_initialize(
+		     &extent_hashes,
+		     logical_volume_size,
+		     extent_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create entry: %d extent hashes.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( number_of_extents != extent_hashes->number_of_extents )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry: %d number of extents value out of bounds.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( number_of_extents > 0 )
+		{
+			hashes_size = (size_t) number_of_extents * EXTENT_HASHES_HASH_SIZE;
+
+			read_count = libbfio_handle_read_buffer(
+			              file_io_handle,
+			              extent_hashes->hashes,
+			              hashes_size,
+			              error );
+
+			if( read_count != (ssize_t) hashes_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read entry: %d extent hashes.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			if( memory_set(
+			     extent_hashes->hash_is_set,
+			     1,
+			     sizeof( uint8_t ) * number_of_extents ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to set hash is set values.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* The root hash is recalculated to detect a corrupted extent hash file
+		 */
+		if( extent_hashes_calculate_root_hash(
+		     extent_hashes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate entry: %d root hash.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( memory_compare(
+		     extent_hashes->root_hash,
+		     &( entry_header_data[ 24 ] ),
+		     EXTENT_HASHES_HASH_SIZE ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: mismatch in entry: %d root hash.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		( *extent_hashes_array )[ entry_index ] = extent_hashes;
+
+		extent_hashes = NULL;
+	}
+	if( libbfio_handle_close(
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close extent hash file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( extent_hashes != NULL )
+	{
+		extent_hashes_free(
+		 &extent_hashes,
+		 NULL );
+	}
+	if( *extent_hashes_array != NULL )
+	{
+		extent_hash_file_free_extent_hashes_array(
+		 extent_hashes_array,
+		 number_of_extent_hashes,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees an array of extent hashes
+ * Returns 1 if successful or -1 on error
+ */
+int extent_hash_file_free_extent_hashes_array(
+     extent_hashes_t ***extent_hashes_array,
+     int *number_of_extent_hashes,
+     libcerror_error_t **error )
+{
+	static char *function = "extent_hash_file_free_extent_hashes_array";
+	int entry_index       = 0;
+	int result            = 1;
+
+	if( extent_hashes_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent hashes array.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_extent_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extent hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extent_hashes_array != NULL )
+	{
+		for( entry_index = 0;
+		     entry_index < *number_of_extent_hashes;
+		     entry_index++ )
+		{
+			if( ( *extent_hashes_array )[ entry_index ] == NULL )
+			{
+				continue;
+			}
+			if( extent_hashes_free(
+			     &( ( *extent_hashes_array )[ entry_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free extent hashes: %d.",
+				 function,
+				 entry_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *extent_hashes_array );
+
+		*extent_hashes_array = NULL;
+	}
+	*number_of_extent_hashes = 0;
+
+	return( result );
+}
+
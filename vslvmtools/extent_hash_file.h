@@ -0,0 +1,74 @@
+/*
+ * Extent hash file functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXTENT_HASH_FILE_H )
+#define _EXTENT_HASH_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "extent_hashes.h"
+#include "vslvmtools_libbfio.h"
+#include "vslvmtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define EXTENT_HASH_FILE_SIGNATURE		"VSLVMEXH"
+#define EXTENT_HASH_FILE_FORMAT_VERSION		2
+
+#define EXTENT_HASH_FILE_HEADER_SIZE		16
+#define EXTENT_HASH_FILE_ENTRY_HEADER_SIZE	56
+
+/* The extent hashes of the logical volume are stored in the entry
+ */
+#define EXTENT_HASH_FILE_ENTRY_FLAG_IS_SET	0x00000001UL
+
+int extent_hash_file_open_file_io_handle(
+     const system_character_t *filename,
+     int access_flags,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+int extent_hash_file_write(
+     const system_character_t *filename,
+     extent_hashes_t **extent_hashes_array,
+     int number_of_extent_hashes,
+     libcerror_error_t **error );
+
+int extent_hash_file_read(
+     const system_character_t *filename,
+     extent_hashes_t ***extent_hashes_array,
+     int *number_of_extent_hashes,
+     libcerror_error_t **error );
+
+int extent_hash_file_free_extent_hashes_array(
+     extent_hashes_t ***extent_hashes_array,
+     int *number_of_extent_hashes,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EXTENT_HASH_FILE_H ) */
+
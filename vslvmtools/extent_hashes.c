@@ -0,0 +1,1151 @@
+/*
+ * Extent hashes functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "extent_hashes.h"
+#include "vslvmtools_libcerror.h"
+#include "vslvmtools_libhmac.h"
+
+/* Creates extent hashes
+ * Make sure the value extent_hashes is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int extent_hashes_initialize(
+     extent_hashes_t **extent_hashes,
+     size64_t logical_volume_size,
+     size64_t extent_size,
+     libcerror_error_t **error )
+{
+	static char *function      = "extent_hashes_initialize";
+	uint64_t number_of_extents = 0;
+
+	if( extent_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extent_hashes != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid extent hashes value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid extent size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_extents = logical_volume_size / extent_size;
+
+	if( ( logical_volume_size % extent_size ) != 0 )
+	{
+		number_of_extents += 1;
+	}
+	if( ( number_of_extents > (uint64_t) UINT32_MAX )
+	 || ( number_of_extents > (uint64_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / EXTENT_HASHES_HASH_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of extents value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*extent_hashes = memory_allocate_structure(
+	                  extent_hashes_t );
+
+	if( *extent_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create extent hashes.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *extent_hashes,
+	     0,
+	     sizeof( extent_hashes_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear extent hashes.",
+		 function );
+
+		memory_free(
+		 *extent_hashes );
+
+		*extent_hashes = NULL;
+
+		return( -1 );
+	}
+	( *extent_hashes )->logical_volume_size = logical_volume_size;
+	( *extent_hashes )->extent_size         = extent_size;
+	( *extent_hashes )->number_of_extents   = (uint32_t) number_of_extents;
+
+	if( number_of_extents > 0 )
+	{
+		( *extent_hashes )->hashes = (uint8_t *) memory_allocate(
+		                                          sizeof( uint8_t ) * EXTENT_HASHES_HASH_SIZE * (size_t) number_of_extents );
+
+		if( ( *extent_hashes )->hashes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create hashes.",
+			 function );
+
+			goto on_error;
+		}
+		( *extent_hashes )->hash_is_set = (uint8_t *) memory_allocate(
+		                                               sizeof( uint8_t ) * (size_t) number_of_extents );
+
+		if( ( *extent_hashes )->hash_is_set == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create hash is set values.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     ( *extent_hashes )->hash_is_set,
+		     0,
+		     sizeof( uint8_t ) * (size_t) number_of_extents ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear hash is set values.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *extent_hashes != NULL )
+	{
+		extent_hashes_free(
+		 extent_hashes,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees extent hashes
+ * Returns 1 if successful or -1 on error
+ */
+int extent_hashes_free(
+     extent_hashes_t **extent_hashes,
+     libcerror_error_t **error )
+{
+	static char *function = "extent_hashes_free";
+	int result            = 1;
+
+	if( extent_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extent_hashes != NULL )
+	{
+		if( ( *extent_hashes )->context != NULL )
+		{
+			if( libhmac_sha256_free(
+			     &( ( *extent_hashes )->context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free SHA256 context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *extent_hashes )->hash_is_set != NULL )
+		{
+			memory_free(
+			 ( *extent_hashes )->hash_is_set );
+		}
+		if( ( *extent_hashes )->hashes != NULL )
+		{
+			memory_free(
+			 ( *extent_hashes )->hashes );
+		}
+		memory_free(
+		 *extent_hashes );
+
+		*extent_hashes = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the data size of a specific extent
+ * The last extent can be smaller than the extent size
+ * Returns 1 if successful or -1 on error
+ */
+int extent_hashes_get_extent_data_size(
+     extent_hashes_t *extent_hashes,
+     uint32_t extent_index,
+     size64_t *extent_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "extent_hashes_get_extent_data_size";
+	size64_t extent_start = 0;
+
+	if( extent_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_index >= extent_hashes->number_of_extents )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid extent index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent data size.",
+		 function );
+
+		return( -1 );
+	}
+	extent_start = (size64_t) extent_index * extent_hashes->extent_size;
+
+	*extent_data_size = extent_hashes->logical_volume_size - extent_start;
+
+	if( *extent_data_size > extent_hashes->extent_size )
+	{
+		*extent_data_size = extent_hashes->extent_size;
+	}
+	return( 1 );
+}
+
+/* Updates the extent hashes with logical volume data
+ * The data of an extent must be provided in order, but extents can be provided in any order
+ * Returns 1 if successful or -1 on error
+ */
+int extent_hashes_update(
+     extent_hashes_t *extent_hashes,
+     off64_t logical_volume_offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "extent_hashes_update";
+	size64_t extent_data_size = 0;
+	size64_t extent_offset    = 0;
+	size_t update_size        = 0;
+	uint32_t extent_index     = 0;
+
+	if( extent_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( logical_volume_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid logical volume offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_size > 0 )
+	{
+		if( ( (size64_t) logical_volume_offset / extent_hashes->extent_size ) >= (size64_t) extent_hashes->number_of_extents )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid logical volume offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		extent_index  = (uint32_t) ( (size64_t) logical_volume_offset / extent_hashes->extent_size );
+		extent_offset = (size64_t) logical_volume_offset % extent_hashes->extent_size;
+
+		if( extent_hashes_get_extent_data_size(
+		     extent_hashes,
+		     extent_index,
+		     &extent_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %" PRIu32 " data size.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		if( extent_hashes->context == NULL )
+		{
+			if( extent_offset != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: data of extent: %" PRIu32 " not provided from its start.",
+				 function,
+				 extent_index );
+
+				return( -1 );
+			}
+			if( libhmac_sha256_initialize(
+			     &( extent_hashes->context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to initialize SHA256 context.",
+				 function );
+
+				return( -1 );
+			}
+			extent_hashes->current_extent_index     = extent_index;
+			extent_hashes->current_extent_data_size = 0;
+		}
+		if( ( extent_index != extent_hashes->current_extent_index )
+		 || ( extent_offset != extent_hashes->current_extent_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: data of extent: %" PRIu32 " not provided in order.",
+			 function,
+			 extent_hashes->current_extent_index );
+
+			return( -1 );
+		}
+		update_size = data_size;
+
+		if( (size64_t) update_size > ( extent_data_size - extent_offset ) )
+		{
+			update_size = (size_t) ( extent_data_size - extent_offset );
+		}
+		if( libhmac_sha256_update(
+		     extent_hashes->context,
+		     data,
+		     update_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update SHA256 hash of extent: %" PRIu32 ".",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		extent_hashes->current_extent_data_size += update_size;
+
+		logical_volume_offset += (off64_t) update_size;
+		data                  += update_size;
+		data_size             -= update_size;
+
+		if( extent_hashes->current_extent_data_size == extent_data_size )
+		{
+			if( libhmac_sha256_finalize(
+			     extent_hashes->context,
+			     &( extent_hashes->hashes[ (size_t) extent_index * EXTENT_HASHES_HASH_SIZE ] ),
+			     EXTENT_HASHES_HASH_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to finalize SHA256 hash of extent: %" PRIu32 ".",
+				 function,
+				 extent_index );
+
+				return( -1 );
+			}
+			extent_hashes->hash_is_set[ extent_index ] = 1;
+
+			if( libhmac_sha256_free(
+			     &( extent_hashes->context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free SHA256 context.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Finalizes the extent hashes
+ * The extents that were not provided are unmapped and hashed as 0-byte values
+ * Returns 1 if successful or -1 on error
+ */
+int extent_hashes_finalize(
+     extent_hashes_t *extent_hashes,
+     libcerror_error_t **error )
+{
+	uint8_t zero_extent_hash[ EXTENT_HASHES_HASH_SIZE ];
+
+	libhmac_sha256_context_t *context = NULL;
+	uint8_t *zero_buffer              = NULL;
+	static char *function             = "extent_hashes_finalize";
+	size64_t extent_data_size         = 0;
+	size64_t remaining_size           = 0;
+	size64_t zero_extent_data_size    = 0;
+	size_t update_size                = 0;
+	uint32_t extent_index             = 0;
+
+	if( extent_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_hashes->context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: data of extent: %" PRIu32 " incomplete.",
+		 function,
+		 extent_hashes->current_extent_index );
+
+		return( -1 );
+	}
+	for( extent_index = 0;
+	     extent_index < extent_hashes->number_of_extents;
+	     extent_index++ )
+	{
+		if( extent_hashes->hash_is_set[ extent_index ] != 0 )
+		{
+			continue;
+		}
+		if( extent_hashes_get_extent_data_size(
+		     extent_hashes,
+		     extent_index,
+		     &extent_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %" PRIu32 " data size.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+		/* The hash of an unmapped extent only depends on its size
+		 */
+		if( extent_data_size != zero_extent_data_size )
+		{
+			if( zero_buffer == NULL )
+			{
+				zero_buffer = (uint8_t *) memory_allocate(
+				                           sizeof( uint8_t ) * 65536 );
+
+				if( zero_buffer == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create zero buffer.",
+					 function );
+
+					goto on_error;
+				}
+				if( memory_set(
+				     zero_buffer,
+				     0,
+				     sizeof( uint8_t ) * 65536 ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 "%s: unable to clear zero buffer.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( libhmac_sha256_initialize(
+			     &context,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to initialize SHA256 context.",
+				 function );
+
+				goto on_error;
+			}
+			remaining_size = extent_data_size;
+
+			while( remaining_size > 0 )
+			{
+				update_size = 65536;
+
+				if( (size64_t) update_size > remaining_size )
+				{
+					update_size = (size_t) remaining_size;
+				}
+				if( libhmac_sha256_update(
+				     context,
+				     zero_buffer,
+				     update_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to update SHA256 hash.",
+					 function );
+
+					goto on_error;
+				}
+				remaining_size -= update_size;
+			}
+			if( libhmac_sha256_finalize(
+			     context,
+			     zero_extent_hash,
+			     EXTENT_HASHES_HASH_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to finalize SHA256 hash.",
+				 function );
+
+				goto on_error;
+			}
+			if( libhmac_sha256_free(
+			     &context,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free SHA256 context.",
+				 function );
+
+				goto on_error;
+			}
+			zero_extent_data_size = extent_data_size;
+		}
+		if( memory_copy(
+		     &( extent_hashes->hashes[ (size_t) extent_index * EXTENT_HASHES_HASH_SIZE ] ),
+		     zero_extent_hash,
+		     EXTENT_HASHES_HASH_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy hash of extent: %" PRIu32 ".",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+		extent_hashes->hash_is_set[ extent_index ] = 1;
+	}
+	if( zero_buffer != NULL )
+	{
+		memory_free(
+		 zero_buffer );
+
+		zero_buffer = NULL;
+	}
+	if( extent_hashes_calculate_root_hash(
+	     extent_hashes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate root hash.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( context != NULL )
+	{
+		libhmac_sha256_free(
+		 &context,
+		 NULL );
+	}
+	if( zero_buffer != NULL )
+	{
+		memory_free(
+		 zero_buffer );
+	}
+	return( -1 );
+}
+
+/* Calculates the hash of a Merkle tree node
+ * The node hash is the SHA256 of the node type prefix followed by the data,
+ * where the prefix is 0x00 for a leaf node and 0x01 for an interior node
+ * The node hash can be stored in the same buffer as the data
+ * Returns 1 if successful or -1 on error
+ */
+int extent_hashes_calculate_node_hash(
+     uint8_t node_type_prefix,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *node_hash,
+     size_t node_hash_size,
+     libcerror_error_t **error )
+{
+	libhmac_sha256_context_t *context = NULL;
+	static char *function             = "extent_hashes_calculate_node_hash";
+
+	if( ( node_type_prefix != EXTENT_HASHES_NODE_TYPE_PREFIX_LEAF )
+	 && ( node_type_prefix != EXTENT_HASHES_NODE_TYPE_PREFIX_INTERIOR ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported node type prefix: 0x%02" PRIx8 ".",
+		 function,
+		 node_type_prefix );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_hash_size < EXTENT_HASHES_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid node hash size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhmac_sha256_initialize(
+	     &context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize SHA256 context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_sha256_update(
+	     context,
+	     &node_type_prefix,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update SHA256 hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( data_size > 0 )
+	{
+		if( libhmac_sha256_update(
+		     context,
+		     data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update SHA256 hash.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libhmac_sha256_finalize(
+	     context,
+	     node_hash,
+	     EXTENT_HASHES_HASH_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to finalize SHA256 hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_sha256_free(
+	     &context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free SHA256 context.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( context != NULL )
+	{
+		libhmac_sha256_free(
+		 &context,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Calculates the Merkle tree root hash of the extent hashes
+ * The tree is the Merkle hash tree of RFC 6962, with the extent hashes as leaves.
+ * The hash of a leaf node is the SHA256 of 0x00 followed by the extent hash,
+ * the hash of an interior node is the SHA256 of 0x01 followed by the hashes
+ * of its 2 child nodes, a node without a sibling is promoted to the next level as-is.
+ * The prefixes prevent a leaf from having the same hash as an interior node.
+ * The root hash of extent hashes without extents is the SHA256 of no data
+ * Returns 1 if successful or -1 on error
+ */
+int extent_hashes_calculate_root_hash(
+     extent_hashes_t *extent_hashes,
+     libcerror_error_t **error )
+{
+	libhmac_sha256_context_t *context = NULL;
+	uint8_t *nodes                    = NULL;
+	static char *function             = "extent_hashes_calculate_root_hash";
+	uint32_t node_index               = 0;
+	uint32_t number_of_nodes          = 0;
+
+	if( extent_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     extent_hashes->root_hash,
+	     0,
+	     EXTENT_HASHES_HASH_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear root hash.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_nodes = extent_hashes->number_of_extents;
+
+	if( number_of_nodes == 0 )
+	{
+		if( libhmac_sha256_initialize(
+		     &context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize SHA256 context.",
+			 function );
+
+			goto on_error;
+		}
+		if( libhmac_sha256_finalize(
+		     context,
+		     extent_hashes->root_hash,
+		     EXTENT_HASHES_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to finalize SHA256 hash.",
+			 function );
+
+			goto on_error;
+		}
+		if( libhmac_sha256_free(
+		     &context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free SHA256 context.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	if( extent_hashes->hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid extent hashes - missing hashes.",
+		 function );
+
+		return( -1 );
+	}
+	nodes = (uint8_t *) memory_allocate(
+	                     sizeof( uint8_t ) * EXTENT_HASHES_HASH_SIZE * (size_t) number_of_nodes );
+
+	if( nodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create nodes.",
+		 function );
+
+		goto on_error;
+	}
+	for( node_index = 0;
+	     node_index < number_of_nodes;
+	     node_index++ )
+	{
+		if( extent_hashes_calculate_node_hash(
+		     EXTENT_HASHES_NODE_TYPE_PREFIX_LEAF,
+		     &( extent_hashes->hashes[ (size_t) node_index * EXTENT_HASHES_HASH_SIZE ] ),
+		     EXTENT_HASHES_HASH_SIZE,
+		     &( nodes[ (size_t) node_index * EXTENT_HASHES_HASH_SIZE ] ),
+		     EXTENT_HASHES_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate leaf node: %" PRIu32 " hash.",
+			 function,
+			 node_index );
+
+			goto on_error;
+		}
+	}
+	/* The nodes of the next level are stored in place, since node: i / 2 is
+	 * written after nodes: i and i + 1 have been read
+	 */
+	while( number_of_nodes > 1 )
+	{
+		for( node_index = 0;
+		     node_index < number_of_nodes;
+		     node_index += 2 )
+		{
+			if( ( node_index + 1 ) >= number_of_nodes )
+			{
+				if( memory_copy(
+				     &( nodes[ (size_t) ( node_index / 2 ) * EXTENT_HASHES_HASH_SIZE ] ),
+				     &( nodes[ (size_t) node_index * EXTENT_HASHES_HASH_SIZE ] ),
+				     EXTENT_HASHES_HASH_SIZE ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy node: %" PRIu32 ".",
+					 function,
+					 node_index );
+
+					goto on_error;
+				}
+				continue;
+			}
+			if( extent_hashes_calculate_node_hash(
+			     EXTENT_HASHES_NODE_TYPE_PREFIX_INTERIOR,
+			     &( nodes[ (size_t) node_index * EXTENT_HASHES_HASH_SIZE ] ),
+			     2 * EXTENT_HASHES_HASH_SIZE,
+			     &( nodes[ (size_t) ( node_index / 2 ) * EXTENT_HASHES_HASH_SIZE ] ),
+			     EXTENT_HASHES_HASH_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to calculate interior node: %" PRIu32 " hash.",
+				 function,
+				 node_index / 2 );
+
+				goto on_error;
+			}
+		}
+		number_of_nodes = ( number_of_nodes / 2 ) + ( number_of_nodes % 2 );
+	}
+	if( memory_copy(
+	     extent_hashes->root_hash,
+	     nodes,
+	     EXTENT_HASHES_HASH_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy root hash.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 nodes );
+
+	return( 1 );
+
+on_error:
+	if( context != NULL )
+	{
+		libhmac_sha256_free(
+		 &context,
+		 NULL );
+	}
+	if( nodes != NULL )
+	{
+		memory_free(
+		 nodes );
+	}
+	return( -1 );
+}
+
+/* Compares the hash of a specific extent with the hash of a previous run
+ * Returns 1 if the extent is unchanged, 0 if changed or -1 on error
+ */
+int extent_hashes_compare_extent(
+     extent_hashes_t *extent_hashes,
+     extent_hashes_t *previous_extent_hashes,
+     uint32_t extent_index,
+     libcerror_error_t **error )
+{
+	static char *function = "extent_hashes_compare_extent";
+	size_t hash_offset    = 0;
+
+	if( extent_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_index >= extent_hashes->number_of_extents )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid extent index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( previous_extent_hashes == NULL )
+	 || ( previous_extent_hashes->logical_volume_size != extent_hashes->logical_volume_size )
+	 || ( previous_extent_hashes->extent_size != extent_hashes->extent_size ) )
+	{
+		return( 0 );
+	}
+	hash_offset = (size_t) extent_index * EXTENT_HASHES_HASH_SIZE;
+
+	if( memory_compare(
+	     &( extent_hashes->hashes[ hash_offset ] ),
+	     &( previous_extent_hashes->hashes[ hash_offset ] ),
+	     EXTENT_HASHES_HASH_SIZE ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
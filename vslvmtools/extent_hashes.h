@@ -0,0 +1,135 @@
+/*
+ * Extent hashes functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXTENT_HASHES_H )
+#define _EXTENT_HASHES_H
+
+#include <common.h>
+#include <types.h>
+
+#include "vslvmtools_libcerror.h"
+#include "vslvmtools_libhmac.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The extent hashes are SHA256 hashes
+ */
+#define EXTENT_HASHES_HASH_SIZE		32
+
+/* The Merkle tree node type prefixes, as defined by RFC 6962
+ */
+#define EXTENT_HASHES_NODE_TYPE_PREFIX_LEAF	0x00
+#define EXTENT_HASHES_NODE_TYPE_PREFIX_INTERIOR	0x01
+
+typedef struct extent_hashes extent_hashes_t;
+
+struct extent_hashes
+{
+	/* The logical volume size
+	 */
+	size64_t logical_volume_size;
+
+	/* The extent size
+	 */
+	size64_t extent_size;
+
+	/* The number of extents
+	 */
+	uint32_t number_of_extents;
+
+	/* The extent hashes
+	 */
+	uint8_t *hashes;
+
+	/* Values to indicate the hash of an extent was calculated
+	 */
+	uint8_t *hash_is_set;
+
+	/* The Merkle tree root hash
+	 */
+	uint8_t root_hash[ EXTENT_HASHES_HASH_SIZE ];
+
+	/* The SHA256 context of the current extent
+	 */
+	libhmac_sha256_context_t *context;
+
+	/* The index of the current extent
+	 */
+	uint32_t current_extent_index;
+
+	/* The number of bytes of the current extent that have been hashed
+	 */
+	size64_t current_extent_data_size;
+};
+
+int extent_hashes_initialize(
+     extent_hashes_t **extent_hashes,
+     size64_t logical_volume_size,
+     size64_t extent_size,
+     libcerror_error_t **error );
+
+int extent_hashes_free(
+     extent_hashes_t **extent_hashes,
+     libcerror_error_t **error );
+
+int extent_hashes_get_extent_data_size(
+     extent_hashes_t *extent_hashes,
+     uint32_t extent_index,
+     size64_t *extent_data_size,
+     libcerror_error_t **error );
+
+int extent_hashes_update(
+     extent_hashes_t *extent_hashes,
+     off64_t logical_volume_offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int extent_hashes_finalize(
+     extent_hashes_t *extent_hashes,
+     libcerror_error_t **error );
+
+int extent_hashes_calculate_node_hash(
+     uint8_t node_type_prefix,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *node_hash,
+     size_t node_hash_size,
+     libcerror_error_t **error );
+
+int extent_hashes_calculate_root_hash(
+     extent_hashes_t *extent_hashes,
+     libcerror_error_t **error );
+
+int extent_hashes_compare_extent(
+     extent_hashes_t *extent_hashes,
+     extent_hashes_t *previous_extent_hashes,
+     uint32_t extent_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EXTENT_HASHES_H ) */
+
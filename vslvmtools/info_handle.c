@@ -1083,11 +1083,15 @@ int info_handle_physical_volume_fprint(
 {
 	system_character_t volume_size_string[ 16 ];
 
-	static char *function    = "info_handle_physical_volume_fprint";
-	char *value_string       = NULL;
-	size64_t volume_size     = 0;
-	size_t value_string_size = 0;
-	int result               = 0;
+	static char *function     = "info_handle_physical_volume_fprint";
+	char *value_string        = NULL;
+	off64_t extent_run_offset = 0;
+	size64_t extent_run_size  = 0;
+	size64_t volume_size      = 0;
+	size_t value_string_size  = 0;
+	int extent_run_index      = 0;
+	int number_of_extent_runs = 0;
+	int result                = 0;
 
 	if( info_handle == NULL )
 	{
@@ -1339,6 +1343,69 @@ int info_handle_physical_volume_fprint(
 		 "\tVolume size:\t\t\t\t%" PRIu64 " bytes\n",
 		 volume_size );
 	}
+	if( info_handle->print_unallocated_extent_runs != 0 )
+	{
+		if( libvslvm_physical_volume_get_number_of_unallocated_extent_runs(
+		     physical_volume,
+		     &number_of_extent_runs,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of unallocated extent runs.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tNumber of unallocated extent runs:\t%d\n",
+		 number_of_extent_runs );
+
+		for( extent_run_index = 0;
+		     extent_run_index < number_of_extent_runs;
+		     extent_run_index++ )
+		{
+			if( libvslvm_physical_volume_get_unallocated_extent_run_by_index(
+			     physical_volume,
+			     extent_run_index,
+			     &extent_run_offset,
+			     &extent_run_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve unallocated extent run: %d.",
+				 function,
+				 extent_run_index );
+
+				goto on_error;
+			}
+			fprintf(
+			 info_handle->notify_stream,
+			 "\n" );
+
+			fprintf(
+			 info_handle->notify_stream,
+			 "\tUnallocated extent run: %d\n",
+			 extent_run_index + 1 );
+
+			fprintf(
+			 info_handle->notify_stream,
+			 "\t\tOffset:\t\t\t\t0x%08" PRIx64 " (%" PRIi64 ")\n",
+			 extent_run_offset,
+			 extent_run_offset );
+
+			fprintf(
+			 info_handle->notify_stream,
+			 "\t\tSize:\t\t\t\t%" PRIu64 " bytes\n",
+			 extent_run_size );
+		}
+	}
 	fprintf(
 	 info_handle->notify_stream,
 	 "\n" );
@@ -1363,12 +1430,19 @@ int info_handle_logical_volume_fprint(
      libvslvm_logical_volume_t *logical_volume,
      libcerror_error_t **error )
 {
-	libvslvm_segment_t *segment = NULL;
-	static char *function       = "info_handle_logical_volume_fprint";
-	char *value_string          = NULL;
-	size_t value_string_size    = 0;
-	int number_of_segments      = 0;
-	int segment_index           = 0;
+	libvslvm_segment_t *segment    = NULL;
+	static char *function          = "info_handle_logical_volume_fprint";
+	char *value_string             = NULL;
+	off64_t logical_offset         = 0;
+	off64_t physical_volume_offset = 0;
+	size64_t extent_run_size       = 0;
+	size_t value_string_size       = 0;
+	uint8_t extent_run_type        = 0;
+	int extent_run_index           = 0;
+	int number_of_extent_runs      = 0;
+	int number_of_segments         = 0;
+	int physical_volume_index      = 0;
+	int segment_index              = 0;
 
 	if( info_handle == NULL )
 	{
@@ -1588,6 +1662,101 @@ int info_handle_logical_volume_fprint(
 			goto on_error;
 		}
 	}
+	if( libvslvm_logical_volume_get_number_of_extent_runs(
+	     logical_volume,
+	     &number_of_extent_runs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extent runs.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of extent runs:\t\t\t%d\n",
+	 number_of_extent_runs );
+
+	for( extent_run_index = 0;
+	     extent_run_index < number_of_extent_runs;
+	     extent_run_index++ )
+	{
+		if( libvslvm_logical_volume_get_extent_run_by_index(
+		     logical_volume,
+		     extent_run_index,
+		     &logical_offset,
+		     &extent_run_size,
+		     &physical_volume_index,
+		     &physical_volume_offset,
+		     &extent_run_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent run: %d.",
+			 function,
+			 extent_run_index );
+
+			goto on_error;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tExtent run: %d\n",
+		 extent_run_index + 1 );
+
+		fprintf(
+		 info_handle->notify_stream,
+		 "\t\tOffset:\t\t\t\t0x%08" PRIx64 " (%" PRIi64 ")\n",
+		 logical_offset,
+		 logical_offset );
+
+		fprintf(
+		 info_handle->notify_stream,
+		 "\t\tSize:\t\t\t\t%" PRIu64 " bytes\n",
+		 extent_run_size );
+
+		fprintf(
+		 info_handle->notify_stream,
+		 "\t\tType:\t\t\t\t" );
+
+		if( extent_run_type == LIBVSLVM_EXTENT_RUN_TYPE_LINEAR )
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 "linear" );
+		}
+		else
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 "unknown (%" PRIu8 ")",
+			 extent_run_type );
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\n" );
+
+		fprintf(
+		 info_handle->notify_stream,
+		 "\t\tPhysical volume:\t\t%d\n",
+		 physical_volume_index + 1 );
+
+		fprintf(
+		 info_handle->notify_stream,
+		 "\t\tPhysical volume offset:\t\t0x%08" PRIx64 " (%" PRIi64 ")\n",
+		 physical_volume_offset,
+		 physical_volume_offset );
+
+		fprintf(
+		 info_handle->notify_stream,
+		 "\n" );
+	}
 	return( 1 );
 
 on_error:
@@ -50,6 +50,10 @@ struct info_handle
 	 */
 	libvslvm_handle_t *input_handle;
 
+	/* Value to indicate if the unallocated extent runs should be printed
+	 */
+	uint8_t print_unallocated_extent_runs;
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
@@ -32,9 +32,20 @@
 
 #include "mount_file_entry.h"
 #include "mount_file_system.h"
+#include "vslvmtools_libbfio.h"
 #include "vslvmtools_libcerror.h"
 #include "vslvmtools_libvslvm.h"
 
+#if !defined( LIBVSLVM_HAVE_BFIO )
+
+extern \
+int libvslvm_logical_volume_set_physical_volume_file_io_pool(
+     libvslvm_logical_volume_t *logical_volume,
+     libbfio_pool_t *file_io_pool,
+     libvslvm_error_t **error );
+
+#endif /* !defined( LIBVSLVM_HAVE_BFIO ) */
+
 #if !defined( S_IFDIR )
 #define S_IFDIR 0x4000
 #endif
@@ -50,12 +61,14 @@
 int mount_file_entry_initialize(
      mount_file_entry_t **file_entry,
      mount_file_system_t *file_system,
-     int logical_volume_index,
+     int volume_index,
      const system_character_t *name,
      libcerror_error_t **error )
 {
 	static char *function = "mount_file_entry_initialize";
 	size_t name_length    = 0;
+	int result            = 0;
+	int type_index        = 0;
 
 	if( file_entry == NULL )
 	{
@@ -165,9 +178,31 @@ int mount_file_entry_initialize(
 
 		( *file_entry )->name_size = name_length + 1;
 	}
+	if( volume_index != -1 )
+	{
+		result = mount_file_system_get_volume_type_by_index(
+		          file_system,
+		          volume_index,
+		          &( ( *file_entry )->volume_type ),
+		          &type_index,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume type of volume: %d.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+	}
 	( *file_entry )->file_system = file_system;
 
-	( *file_entry )->logical_volume_index = logical_volume_index;
+	( *file_entry )->volume_index = volume_index;
 
 	return( 1 );
 
@@ -195,6 +230,7 @@ int mount_file_entry_free(
      libcerror_error_t **error )
 {
 	static char *function = "mount_file_entry_free";
+	int result            = 1;
 
 	if( file_entry == NULL )
 	{
@@ -209,6 +245,40 @@ int mount_file_entry_free(
 	}
 	if( *file_entry != NULL )
 	{
+		if( ( *file_entry )->logical_volume != NULL )
+		{
+			if( libvslvm_logical_volume_free(
+			     &( ( *file_entry )->logical_volume ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free logical volume.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The physical volume file IO pool is freed after the logical volume that uses it
+		 */
+		if( ( *file_entry )->physical_volume_file_io_pool != NULL )
+		{
+			if( libbfio_pool_free(
+			     &( ( *file_entry )->physical_volume_file_io_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free physical volume file IO pool.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( ( *file_entry )->name != NULL )
 		{
 			memory_free(
@@ -219,7 +289,132 @@ int mount_file_entry_free(
 
 		*file_entry = NULL;
 	}
+	return( result );
+}
+
+/* Opens the file entry for reading
+ * A separate volume is opened for every open file entry, so that concurrent
+ * reads of different open file entries do not share a read cursor, lock or cache.
+ * The volume reads from a clone of the physical volume file IO pool, so that
+ * these reads do not share the file handles and lock of the file IO pool either
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_entry_open(
+     mount_file_entry_t *file_entry,
+     libcerror_error_t **error )
+{
+	libbfio_pool_t *physical_volume_file_io_pool = NULL;
+	static char *function                        = "mount_file_entry_open";
+	int result                                   = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry->logical_volume != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry - logical volume value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry->volume_index == -1 )
+	{
+		return( 1 );
+	}
+	if( mount_file_system_open_volume_by_index(
+	     file_entry->file_system,
+	     file_entry->volume_index,
+	     &( file_entry->logical_volume ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume: %d.",
+		 function,
+		 file_entry->volume_index );
+
+		goto on_error;
+	}
+	result = mount_file_system_get_physical_volume_file_io_pool(
+	          file_entry->file_system,
+	          &physical_volume_file_io_pool,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve physical volume file IO pool.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		/* The handles of the cloned file IO pool are opened on demand
+		 */
+		if( libbfio_pool_clone(
+		     &( file_entry->physical_volume_file_io_pool ),
+		     physical_volume_file_io_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to clone physical volume file IO pool.",
+			 function );
+
+			goto on_error;
+		}
+		if( libvslvm_logical_volume_set_physical_volume_file_io_pool(
+		     file_entry->logical_volume,
+		     file_entry->physical_volume_file_io_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set physical volume file IO pool in volume: %d.",
+			 function,
+			 file_entry->volume_index );
+
+			goto on_error;
+		}
+	}
 	return( 1 );
+
+on_error:
+	if( file_entry->logical_volume != NULL )
+	{
+		libvslvm_logical_volume_free(
+		 &( file_entry->logical_volume ),
+		 NULL );
+	}
+	if( file_entry->physical_volume_file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &( file_entry->physical_volume_file_io_pool ),
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Retrieves the parent file entry
@@ -265,7 +460,7 @@ int mount_file_entry_get_parent_file_entry(
 
 		return( -1 );
 	}
-	if( file_entry->logical_volume_index != -1 )
+	if( file_entry->volume_index != -1 )
 	{
 		if( mount_file_entry_initialize(
 		     parent_file_entry,
@@ -480,7 +675,7 @@ int mount_file_entry_get_file_mode(
 
 		return( -1 );
 	}
-	if( file_entry->logical_volume_index == -1 )
+	if( file_entry->volume_index == -1 )
 	{
 		*file_mode = S_IFDIR | 0555;
 	}
@@ -623,8 +818,10 @@ int mount_file_entry_get_number_of_sub_file_entries(
      int *number_of_sub_file_entries,
      libcerror_error_t **error )
 {
-	static char *function         = "mount_file_entry_get_number_of_sub_file_entries";
-	int number_of_logical_volumes = 0;
+	static char *function          = "mount_file_entry_get_number_of_sub_file_entries";
+	int number_of_logical_volumes  = 0;
+	int number_of_physical_volumes = 0;
+	int number_of_volumes          = 0;
 
 	if( file_entry == NULL )
 	{
@@ -648,7 +845,7 @@ int mount_file_entry_get_number_of_sub_file_entries(
 
 		return( -1 );
 	}
-	if( file_entry->logical_volume_index == -1 )
+	if( file_entry->volume_index == -1 )
 	{
 		if( mount_file_system_get_number_of_logical_volumes(
 		     file_entry->file_system,
@@ -676,8 +873,35 @@ int mount_file_entry_get_number_of_sub_file_entries(
 
 			return( -1 );
 		}
+		if( mount_file_system_get_number_of_physical_volumes(
+		     file_entry->file_system,
+		     &number_of_physical_volumes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of physical volumes.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( number_of_physical_volumes < 0 )
+		 || ( number_of_physical_volumes > 99 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported number of physical volumes.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_volumes = number_of_logical_volumes + ( 2 * number_of_physical_volumes );
 	}
-	*number_of_sub_file_entries = number_of_logical_volumes;
+	*number_of_sub_file_entries = number_of_volumes;
 
 	return( 1 );
 }
@@ -755,7 +979,7 @@ int mount_file_entry_get_sub_file_entry_by_index(
 
 		return( -1 );
 	}
-	if( mount_file_system_get_path_from_logical_volume_index(
+	if( mount_file_system_get_path_from_volume_index(
 	     file_entry->file_system,
 	     sub_file_entry_index,
 	     path,
@@ -793,6 +1017,7 @@ int mount_file_entry_get_sub_file_entry_by_index(
 }
 
 /* Reads data at a specific offset
+ * The unallocated space of a physical volume is read as a sparse file of the size of the data areas
  * Returns the number of bytes read or -1 on error
  */
 ssize_t mount_file_entry_read_buffer_at_offset(
@@ -817,28 +1042,45 @@ ssize_t mount_file_entry_read_buffer_at_offset(
 
 		return( -1 );
 	}
-	if( mount_file_system_get_logical_volume_by_index(
-	     file_entry->file_system,
-	     file_entry->logical_volume_index,
-	     &logical_volume,
-	     error ) != 1 )
+	if( file_entry->logical_volume != NULL )
+	{
+		logical_volume = file_entry->logical_volume;
+	}
+	else if( mount_file_system_get_volume_by_index(
+	          file_entry->file_system,
+	          file_entry->volume_index,
+	          &logical_volume,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve logical volume: %d from file system.",
+		 "%s: unable to retrieve volume: %d from file system.",
 		 function,
-		 file_entry->logical_volume_index );
+		 file_entry->volume_index );
 
 		return( -1 );
 	}
-	read_count = libvslvm_logical_volume_read_buffer_at_offset(
-	              logical_volume,
-	              buffer,
-	              buffer_size,
-	              offset,
-	              error );
+	if( file_entry->volume_type == MOUNT_FILE_SYSTEM_VOLUME_TYPE_UNALLOCATED )
+	{
+		read_count = mount_file_entry_read_unallocated_buffer_at_offset(
+		              file_entry,
+		              logical_volume,
+		              buffer,
+		              buffer_size,
+		              offset,
+		              error );
+	}
+	else
+	{
+		read_count = libvslvm_logical_volume_read_buffer_at_offset(
+		              logical_volume,
+		              buffer,
+		              buffer_size,
+		              offset,
+		              error );
+	}
 
 	if( read_count < 0 )
 	{
@@ -846,17 +1088,549 @@ ssize_t mount_file_entry_read_buffer_at_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") from logical volume: %d.",
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") from volume: %d.",
 		 function,
 		 offset,
 		 offset,
-		 file_entry->logical_volume_index );
+		 file_entry->volume_index );
 
 		return( -1 );
 	}
 	return( read_count );
 }
 
+/* Determines if a specific offset of the data area volume is stored in unallocated space
+ * The range size is the number of bytes, starting at the offset, that are either all
+ * allocated or all unallocated
+ * Returns 1 if unallocated, 0 if allocated to a logical volume or -1 on error
+ */
+int mount_file_entry_get_unallocated_range(
+     mount_file_entry_t *file_entry,
+     libvslvm_logical_volume_t *data_area_volume,
+     off64_t offset,
+     size64_t *range_size,
+     libcerror_error_t **error )
+{
+	libvslvm_physical_volume_t *physical_volume = NULL;
+	static char *function                       = "mount_file_entry_get_unallocated_range";
+	off64_t logical_volume_offset               = 0;
+	off64_t physical_volume_offset              = 0;
+	size64_t allocated_size                     = 0;
+	size64_t contiguous_size                    = 0;
+	int logical_volume_index                    = 0;
+	int physical_volume_index                   = 0;
+	int result                                  = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range size.",
+		 function );
+
+		return( -1 );
+	}
+	result = libvslvm_logical_volume_get_physical_location(
+	          data_area_volume,
+	          offset,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &contiguous_size,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve physical location of offset: %" PRIi64 " (0x%08" PRIx64 ") in data area volume.",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	if( mount_file_system_get_physical_volume_by_index(
+	     file_entry->file_system,
+	     physical_volume_index,
+	     &physical_volume,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve physical volume: %d from file system.",
+		 function,
+		 physical_volume_index );
+
+		return( -1 );
+	}
+	result = libvslvm_physical_volume_get_logical_location(
+	          physical_volume,
+	          physical_volume_offset,
+	          &logical_volume_index,
+	          &logical_volume_offset,
+	          &allocated_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical location of physical volume: %d offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 physical_volume_index,
+		 physical_volume_offset,
+		 physical_volume_offset );
+
+		return( -1 );
+	}
+	if( ( allocated_size != 0 )
+	 && ( allocated_size < contiguous_size ) )
+	{
+		contiguous_size = allocated_size;
+	}
+	*range_size = contiguous_size;
+
+	return( result == 0 ? 1 : 0 );
+}
+
+/* Reads the unallocated space of a physical volume at a specific offset
+ * The offset is relative to the start of the data area volume, where ranges
+ * that are allocated to a logical volume are read as zero bytes
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t mount_file_entry_read_unallocated_buffer_at_offset(
+         mount_file_entry_t *file_entry,
+         libvslvm_logical_volume_t *data_area_volume,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "mount_file_entry_read_unallocated_buffer_at_offset";
+	size64_t range_size   = 0;
+	size64_t volume_size  = 0;
+	size_t buffer_offset  = 0;
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+	int result            = 0;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvslvm_logical_volume_get_size(
+	     data_area_volume,
+	     &volume_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size from data area volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= volume_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) buffer_size > ( volume_size - (size64_t) offset ) )
+	{
+		buffer_size = (size_t) ( volume_size - (size64_t) offset );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		result = mount_file_entry_get_unallocated_range(
+		          file_entry,
+		          data_area_volume,
+		          offset,
+		          &range_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine unallocated range at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		read_size = buffer_size - buffer_offset;
+
+		if( range_size < (size64_t) read_size )
+		{
+			read_size = (size_t) range_size;
+		}
+		if( result != 0 )
+		{
+			read_count = libvslvm_logical_volume_read_buffer_at_offset(
+			              data_area_volume,
+			              &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+			              read_size,
+			              offset,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") from data area volume.",
+				 function,
+				 offset,
+				 offset );
+
+				return( -1 );
+			}
+		}
+		else if( memory_set(
+		          &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+		          0,
+		          read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear buffer.",
+			 function );
+
+			return( -1 );
+		}
+		offset        += (off64_t) read_size;
+		buffer_offset += read_size;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Retrieves the unallocated range at or after a specific offset of the data area volume
+ * Consecutive unallocated ranges are merged
+ * Returns 1 if successful, 0 if there is no unallocated range at or after the offset or -1 on error
+ */
+int mount_file_entry_seek_unallocated_data(
+     mount_file_entry_t *file_entry,
+     libvslvm_logical_volume_t *data_area_volume,
+     off64_t offset,
+     off64_t *data_offset,
+     size64_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_entry_seek_unallocated_data";
+	size64_t range_size   = 0;
+	size64_t volume_size  = 0;
+	int result            = 0;
+
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvslvm_logical_volume_get_size(
+	     data_area_volume,
+	     &volume_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size from data area volume.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = 0;
+
+	while( (size64_t) offset < volume_size )
+	{
+		result = mount_file_entry_get_unallocated_range(
+		          file_entry,
+		          data_area_volume,
+		          offset,
+		          &range_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine unallocated range at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		if( range_size > ( volume_size - (size64_t) offset ) )
+		{
+			range_size = volume_size - (size64_t) offset;
+		}
+		if( result != 0 )
+		{
+			if( *data_size == 0 )
+			{
+				*data_offset = offset;
+			}
+			*data_size += range_size;
+		}
+		else if( *data_size != 0 )
+		{
+			break;
+		}
+		offset += (off64_t) range_size;
+	}
+	if( *data_size == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the physical location of a specific offset
+ * The unallocated space of a physical volume is not mapped, since part of it reads as zero bytes
+ * Returns 1 if successful, 0 if the offset is not mapped or -1 on error
+ */
+int mount_file_entry_get_physical_location(
+     mount_file_entry_t *file_entry,
+     off64_t offset,
+     int *physical_volume_index,
+     off64_t *physical_volume_offset,
+     size64_t *contiguous_size,
+     libcerror_error_t **error )
+{
+	libvslvm_logical_volume_t *logical_volume = NULL;
+	static char *function                     = "mount_file_entry_get_physical_location";
+	int result                                = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry->volume_type == MOUNT_FILE_SYSTEM_VOLUME_TYPE_UNALLOCATED )
+	{
+		return( 0 );
+	}
+	if( file_entry->logical_volume != NULL )
+	{
+		logical_volume = file_entry->logical_volume;
+	}
+	else if( mount_file_system_get_volume_by_index(
+	          file_entry->file_system,
+	          file_entry->volume_index,
+	          &logical_volume,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume: %d from file system.",
+		 function,
+		 file_entry->volume_index );
+
+		return( -1 );
+	}
+	result = libvslvm_logical_volume_get_physical_location(
+	          logical_volume,
+	          offset,
+	          physical_volume_index,
+	          physical_volume_offset,
+	          contiguous_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve physical location of offset: %" PRIi64 " (0x%08" PRIx64 ") in volume: %d.",
+		 function,
+		 offset,
+		 offset,
+		 file_entry->volume_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the data at or after a specific offset
+ * For the unallocated space of a physical volume only the unallocated ranges are considered data
+ * Returns 1 if successful, 0 if there is no data at or after the offset or -1 on error
+ */
+int mount_file_entry_seek_data(
+     mount_file_entry_t *file_entry,
+     off64_t offset,
+     off64_t *data_offset,
+     size64_t *data_size,
+     libcerror_error_t **error )
+{
+	libvslvm_logical_volume_t *logical_volume = NULL;
+	static char *function                     = "mount_file_entry_seek_data";
+	int result                                = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry->logical_volume != NULL )
+	{
+		logical_volume = file_entry->logical_volume;
+	}
+	else if( mount_file_system_get_volume_by_index(
+	          file_entry->file_system,
+	          file_entry->volume_index,
+	          &logical_volume,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume: %d from file system.",
+		 function,
+		 file_entry->volume_index );
+
+		return( -1 );
+	}
+	if( file_entry->volume_type != MOUNT_FILE_SYSTEM_VOLUME_TYPE_UNALLOCATED )
+	{
+		result = libvslvm_logical_volume_seek_data(
+		          logical_volume,
+		          offset,
+		          data_offset,
+		          data_size,
+		          error );
+	}
+	else
+	{
+		result = mount_file_entry_seek_unallocated_data(
+		          file_entry,
+		          logical_volume,
+		          offset,
+		          data_offset,
+		          data_size,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to seek data at offset: %" PRIi64 " (0x%08" PRIx64 ") in volume: %d.",
+		 function,
+		 offset,
+		 offset,
+		 file_entry->volume_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the size
  * Returns 1 if successful or -1 on error
  */
@@ -879,7 +1653,7 @@ int mount_file_entry_get_size(
 
 		return( -1 );
 	}
-	if( file_entry->logical_volume_index == -1 )
+	if( file_entry->volume_index == -1 )
 	{
 		if( size == NULL )
 		{
@@ -896,9 +1670,9 @@ int mount_file_entry_get_size(
 	}
 	else
 	{
-		if( mount_file_system_get_logical_volume_by_index(
+		if( mount_file_system_get_volume_by_index(
 		     file_entry->file_system,
-		     file_entry->logical_volume_index,
+		     file_entry->volume_index,
 		     &logical_volume,
 		     error ) != 1 )
 		{
@@ -906,9 +1680,9 @@ int mount_file_entry_get_size(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve logical volume: %d from file system.",
+			 "%s: unable to retrieve volume: %d from file system.",
 			 function,
-			 file_entry->logical_volume_index );
+			 file_entry->volume_index );
 
 			return( -1 );
 		}
@@ -921,9 +1695,9 @@ int mount_file_entry_get_size(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve size from logical volume: %d.",
+			 "%s: unable to retrieve size from volume: %d.",
 			 function,
-			 file_entry->logical_volume_index );
+			 file_entry->volume_index );
 
 			return( -1 );
 		}
@@ -26,6 +26,7 @@
 #include <types.h>
 
 #include "mount_file_system.h"
+#include "vslvmtools_libbfio.h"
 #include "vslvmtools_libcerror.h"
 #include "vslvmtools_libvslvm.h"
 
@@ -49,15 +50,29 @@ struct mount_file_entry
 	 */
 	size_t name_size;
 
-	/* The logical_volume index
+	/* The volume index
 	 */
-	int logical_volume_index;
+	int volume_index;
+
+	/* The volume type
+	 */
+	int volume_type;
+
+	/* The logical volume opened for the file entry
+	 * This provides a read cursor, lock and cache per open file entry
+	 */
+	libvslvm_logical_volume_t *logical_volume;
+
+	/* The physical volume file IO pool of the logical volume
+	 * This provides separate file handles per open file entry
+	 */
+	libbfio_pool_t *physical_volume_file_io_pool;
 };
 
 int mount_file_entry_initialize(
      mount_file_entry_t **file_entry,
      mount_file_system_t *file_system,
-     int logical_volume_index,
+     int volume_index,
      const system_character_t *name,
      libcerror_error_t **error );
 
@@ -65,6 +80,10 @@ int mount_file_entry_free(
      mount_file_entry_t **file_entry,
      libcerror_error_t **error );
 
+int mount_file_entry_open(
+     mount_file_entry_t *file_entry,
+     libcerror_error_t **error );
+
 int mount_file_entry_get_parent_file_entry(
      mount_file_entry_t *file_entry,
      mount_file_entry_t **parent_file_entry,
@@ -124,6 +143,44 @@ ssize_t mount_file_entry_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+int mount_file_entry_get_unallocated_range(
+     mount_file_entry_t *file_entry,
+     libvslvm_logical_volume_t *data_area_volume,
+     off64_t offset,
+     size64_t *range_size,
+     libcerror_error_t **error );
+
+ssize_t mount_file_entry_read_unallocated_buffer_at_offset(
+         mount_file_entry_t *file_entry,
+         libvslvm_logical_volume_t *data_area_volume,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int mount_file_entry_seek_unallocated_data(
+     mount_file_entry_t *file_entry,
+     libvslvm_logical_volume_t *data_area_volume,
+     off64_t offset,
+     off64_t *data_offset,
+     size64_t *data_size,
+     libcerror_error_t **error );
+
+int mount_file_entry_get_physical_location(
+     mount_file_entry_t *file_entry,
+     off64_t offset,
+     int *physical_volume_index,
+     off64_t *physical_volume_offset,
+     size64_t *contiguous_size,
+     libcerror_error_t **error );
+
+int mount_file_entry_seek_data(
+     mount_file_entry_t *file_entry,
+     off64_t offset,
+     off64_t *data_offset,
+     size64_t *data_size,
+     libcerror_error_t **error );
+
 int mount_file_entry_get_size(
      mount_file_entry_t *file_entry,
      size64_t *size,
@@ -134,6 +134,34 @@ int mount_file_system_initialize(
 
 		goto on_error;
 	}
+	if( libcdata_array_initialize(
+	     &( ( *file_system )->physical_volumes_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize physical volumes array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( ( *file_system )->data_area_volumes_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize data area volumes array.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( WINAPI )
 	if( memory_set(
 	     &systemtime,
@@ -213,6 +241,27 @@ int mount_file_system_initialize(
 on_error:
 	if( *file_system != NULL )
 	{
+		if( ( *file_system )->data_area_volumes_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *file_system )->data_area_volumes_array ),
+			 NULL,
+			 NULL );
+		}
+		if( ( *file_system )->physical_volumes_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *file_system )->physical_volumes_array ),
+			 NULL,
+			 NULL );
+		}
+		if( ( *file_system )->logical_volumes_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *file_system )->logical_volumes_array ),
+			 NULL,
+			 NULL );
+		}
 		memory_free(
 		 *file_system );
 
@@ -263,6 +312,34 @@ int mount_file_system_free(
 
 			result = -1;
 		}
+		if( libcdata_array_free(
+		     &( ( *file_system )->physical_volumes_array ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free physical volumes array.",
+			 function );
+
+			result = -1;
+		}
+		if( libcdata_array_free(
+		     &( ( *file_system )->data_area_volumes_array ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free data area volumes array.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *file_system );
 
@@ -384,6 +461,100 @@ on_error:
 	return( -1 );
 }
 
+/* Sets the volume group
+ * The volume group is not managed by the file system
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_set_volume_group(
+     mount_file_system_t *file_system,
+     libvslvm_volume_group_t *volume_group,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_set_volume_group";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	file_system->volume_group = volume_group;
+
+	return( 1 );
+}
+
+/* Sets the physical volume file IO pool
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_set_physical_volume_file_io_pool(
+     mount_file_system_t *file_system,
+     libbfio_pool_t *physical_volume_file_io_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_set_physical_volume_file_io_pool";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	file_system->physical_volume_file_io_pool = physical_volume_file_io_pool;
+
+	return( 1 );
+}
+
+/* Retrieves the physical volume file IO pool
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int mount_file_system_get_physical_volume_file_io_pool(
+     mount_file_system_t *file_system,
+     libbfio_pool_t **physical_volume_file_io_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_get_physical_volume_file_io_pool";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( physical_volume_file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical volume file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->physical_volume_file_io_pool == NULL )
+	{
+		return( 0 );
+	}
+	*physical_volume_file_io_pool = file_system->physical_volume_file_io_pool;
+
+	return( 1 );
+}
+
 /* Retrieves the number of logical volumes
  * Returns 1 if successful or -1 on error
  */
@@ -542,21 +713,15 @@ int mount_file_system_append_logical_volume(
 	return( 1 );
 }
 
-/* Retrieves the logical volume index from a path
- * Returns 1 if successful, 0 if no such logical volume index or -1 on error
+/* Retrieves the number of physical volumes
+ * Returns 1 if successful or -1 on error
  */
-int mount_file_system_get_logical_volume_index_from_path(
+int mount_file_system_get_number_of_physical_volumes(
      mount_file_system_t *file_system,
-     const system_character_t *path,
-     size_t path_length,
-     int *logical_volume_index,
+     int *number_of_physical_volumes,
      libcerror_error_t **error )
 {
-	static char *function        = "mount_file_system_get_logical_volume_index_from_path";
-	system_character_t character = 0;
-	size_t path_index            = 0;
-	int logical_volume_number    = 0;
-	int result                   = 0;
+	static char *function = "mount_file_system_get_number_of_physical_volumes";
 
 	if( file_system == NULL )
 	{
@@ -569,115 +734,98 @@ int mount_file_system_get_logical_volume_index_from_path(
 
 		return( -1 );
 	}
-	if( file_system->path_prefix == NULL )
+	if( libcdata_array_get_number_of_entries(
+	     file_system->physical_volumes_array,
+	     number_of_physical_volumes,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file system - missing path prefix.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of physical volumes.",
 		 function );
 
 		return( -1 );
 	}
-	if( path == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path.",
-		 function );
+	return( 1 );
+}
 
-		return( -1 );
-	}
-	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid path length value exceeds maximum.",
-		 function );
+/* Retrieves a specific physical volume and its data area volume
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_get_physical_volume_by_index(
+     mount_file_system_t *file_system,
+     int physical_volume_index,
+     libvslvm_physical_volume_t **physical_volume,
+     libvslvm_logical_volume_t **data_area_volume,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_get_physical_volume_by_index";
 
-		return( -1 );
-	}
-	if( logical_volume_index == NULL )
+	if( file_system == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid logical volume index.",
+		 "%s: invalid file system.",
 		 function );
 
 		return( -1 );
 	}
-	path_length = system_string_length(
-	               path );
-
-	if( ( path_length == 1 )
-	 && ( path[ 0 ] == file_system->path_prefix[ 0 ] ) )
+	if( physical_volume != NULL )
 	{
-		*logical_volume_index = -1;
+		if( libcdata_array_get_entry_by_index(
+		     file_system->physical_volumes_array,
+		     physical_volume_index,
+		     (intptr_t **) physical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve physical volume: %d.",
+			 function,
+			 physical_volume_index );
 
-		return( 1 );
-	}
-	if( ( path_length < file_system->path_prefix_size )
-	 || ( path_length > ( file_system->path_prefix_size + 3 ) ) )
-	{
-		return( 0 );
-	}
-#if defined( WINAPI )
-	result = system_string_compare_no_case(
-	          path,
-	          file_system->path_prefix,
-	          file_system->path_prefix_size - 1 );
-#else
-	result = system_string_compare(
-	          path,
-	          file_system->path_prefix,
-	          file_system->path_prefix_size - 1 );
-#endif
-	if( result != 0 )
-	{
-		return( 0 );
+			return( -1 );
+		}
 	}
-	logical_volume_number = 0;
-
-	path_index = file_system->path_prefix_size - 1;
-
-	while( path_index < path_length )
+	if( data_area_volume != NULL )
 	{
-		character = path[ path_index++ ];
-
-		if( ( character < (system_character_t) '0' )
-		 || ( character > (system_character_t) '9' ) )
+		if( libcdata_array_get_entry_by_index(
+		     file_system->data_area_volumes_array,
+		     physical_volume_index,
+		     (intptr_t **) data_area_volume,
+		     error ) != 1 )
 		{
-			return( 0 );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data area volume: %d.",
+			 function,
+			 physical_volume_index );
+
+			return( -1 );
 		}
-		logical_volume_number *= 10;
-		logical_volume_number += character - (system_character_t) '0';
 	}
-	*logical_volume_index = logical_volume_number - 1;
-
 	return( 1 );
 }
 
-/* Retrieves the path from a logical volume index.
+/* Appends a physical volume and its data area volume to the file system
  * Returns 1 if successful or -1 on error
  */
-int mount_file_system_get_path_from_logical_volume_index(
+int mount_file_system_append_physical_volume(
      mount_file_system_t *file_system,
-     int logical_volume_index,
-     system_character_t *path,
-     size_t path_size,
+     libvslvm_physical_volume_t *physical_volume,
+     libvslvm_logical_volume_t *data_area_volume,
      libcerror_error_t **error )
 {
-	static char *function     = "mount_file_system_get_path_from_logical_volume_index";
-	size_t path_index         = 0;
-	size_t required_path_size = 0;
-	int logical_volume_number = 0;
+	static char *function = "mount_file_system_append_physical_volume";
+	int entry_index       = 0;
 
 	if( file_system == NULL )
 	{
@@ -690,55 +838,726 @@ int mount_file_system_get_path_from_logical_volume_index(
 
 		return( -1 );
 	}
-	if( file_system->path_prefix == NULL )
+	if( libcdata_array_append_entry(
+	     file_system->physical_volumes_array,
+	     &entry_index,
+	     (intptr_t *) physical_volume,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file system - missing path prefix.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append physical volume to array.",
 		 function );
 
 		return( -1 );
 	}
-	if( path == NULL )
+	if( libcdata_array_append_entry(
+	     file_system->data_area_volumes_array,
+	     &entry_index,
+	     (intptr_t *) data_area_volume,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append data area volume to array.",
 		 function );
 
 		return( -1 );
 	}
-	if( path_size > (size_t) SSIZE_MAX )
+	return( 1 );
+}
+
+/* Retrieves the number of volumes
+ * Every physical volume provides both a data area and an unallocated volume
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_get_number_of_volumes(
+     mount_file_system_t *file_system,
+     int *number_of_volumes,
+     libcerror_error_t **error )
+{
+	static char *function          = "mount_file_system_get_number_of_volumes";
+	int number_of_logical_volumes  = 0;
+	int number_of_physical_volumes = 0;
+
+	if( number_of_volumes == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid path length value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of volumes.",
 		 function );
 
 		return( -1 );
 	}
-        required_path_size = file_system->path_prefix_size;
-
-	logical_volume_number = logical_volume_index + 1;
-
-	while( logical_volume_number > 0 )
-	{
-		required_path_size++;
-
-		logical_volume_number /= 10;
-	}
-	if( path_size <= required_path_size )
+	if( mount_file_system_get_number_of_logical_volumes(
+	     file_system,
+	     &number_of_logical_volumes,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of logical volumes.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_file_system_get_number_of_physical_volumes(
+	     file_system,
+	     &number_of_physical_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of physical volumes.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_volumes = number_of_logical_volumes + ( 2 * number_of_physical_volumes );
+
+	return( 1 );
+}
+
+/* Retrieves the volume type of a specific volume index
+ * The type index is the index of the logical or physical volume the volume refers to
+ * Returns 1 if successful, 0 if no such volume or -1 on error
+ */
+int mount_file_system_get_volume_type_by_index(
+     mount_file_system_t *file_system,
+     int volume_index,
+     int *volume_type,
+     int *type_index,
+     libcerror_error_t **error )
+{
+	static char *function          = "mount_file_system_get_volume_type_by_index";
+	int number_of_logical_volumes  = 0;
+	int number_of_physical_volumes = 0;
+
+	if( volume_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume type.",
+		 function );
+
+		return( -1 );
+	}
+	if( type_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid type index.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_file_system_get_number_of_logical_volumes(
+	     file_system,
+	     &number_of_logical_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of logical volumes.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_file_system_get_number_of_physical_volumes(
+	     file_system,
+	     &number_of_physical_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of physical volumes.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_index < 0 )
+	{
+		return( 0 );
+	}
+	if( volume_index < number_of_logical_volumes )
+	{
+		*volume_type = MOUNT_FILE_SYSTEM_VOLUME_TYPE_LOGICAL_VOLUME;
+		*type_index  = volume_index;
+
+		return( 1 );
+	}
+	volume_index -= number_of_logical_volumes;
+
+	if( volume_index < number_of_physical_volumes )
+	{
+		*volume_type = MOUNT_FILE_SYSTEM_VOLUME_TYPE_PHYSICAL_VOLUME;
+		*type_index  = volume_index;
+
+		return( 1 );
+	}
+	volume_index -= number_of_physical_volumes;
+
+	if( volume_index < number_of_physical_volumes )
+	{
+		*volume_type = MOUNT_FILE_SYSTEM_VOLUME_TYPE_UNALLOCATED;
+		*type_index  = volume_index;
+
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves a specific volume
+ * For a physical volume and its unallocated space this is the data area volume of the physical volume
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_get_volume_by_index(
+     mount_file_system_t *file_system,
+     int volume_index,
+     libvslvm_logical_volume_t **volume,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_get_volume_by_index";
+	int result            = 0;
+	int type_index        = 0;
+	int volume_type       = 0;
+
+	result = mount_file_system_get_volume_type_by_index(
+	          file_system,
+	          volume_index,
+	          &volume_type,
+	          &type_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume type of volume: %d.",
+		 function,
+		 volume_index );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volume index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_type == MOUNT_FILE_SYSTEM_VOLUME_TYPE_LOGICAL_VOLUME )
+	{
+		result = mount_file_system_get_logical_volume_by_index(
+		          file_system,
+		          type_index,
+		          volume,
+		          error );
+	}
+	else
+	{
+		result = mount_file_system_get_physical_volume_by_index(
+		          file_system,
+		          type_index,
+		          NULL,
+		          volume,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume: %d.",
+		 function,
+		 volume_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens a separate instance of a specific volume
+ * The volume has its own current offset, lock and cache and
+ * must be freed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_open_volume_by_index(
+     mount_file_system_t *file_system,
+     int volume_index,
+     libvslvm_logical_volume_t **volume,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_open_volume_by_index";
+	int result            = 0;
+	int type_index        = 0;
+	int volume_type       = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->volume_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system - missing volume group.",
+		 function );
+
+		return( -1 );
+	}
+	result = mount_file_system_get_volume_type_by_index(
+	          file_system,
+	          volume_index,
+	          &volume_type,
+	          &type_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume type of volume: %d.",
+		 function,
+		 volume_index );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volume index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_type == MOUNT_FILE_SYSTEM_VOLUME_TYPE_LOGICAL_VOLUME )
+	{
+		result = libvslvm_volume_group_get_logical_volume(
+		          file_system->volume_group,
+		          type_index,
+		          volume,
+		          error );
+	}
+	else
+	{
+		result = libvslvm_volume_group_get_data_area_volume(
+		          file_system->volume_group,
+		          type_index,
+		          volume,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume: %d from volume group.",
+		 function,
+		 volume_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the volume index from a path
+ * A logical volume path consists of the path prefix followed by the logical volume number,
+ * a physical volume path of the path prefix followed by "_pv" and the physical volume number
+ * and an unallocated space path of the physical volume path followed by "_unallocated"
+ * Returns 1 if successful, 0 if no such volume index or -1 on error
+ */
+int mount_file_system_get_volume_index_from_path(
+     mount_file_system_t *file_system,
+     const system_character_t *path,
+     size_t path_length,
+     int *volume_index,
+     libcerror_error_t **error )
+{
+	static char *function          = "mount_file_system_get_volume_index_from_path";
+	system_character_t character   = 0;
+	size_t number_of_digits        = 0;
+	size_t path_index              = 0;
+	int number_of_logical_volumes  = 0;
+	int number_of_physical_volumes = 0;
+	int result                     = 0;
+	int volume_number              = 0;
+	int volume_type                = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->path_prefix == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system - missing path prefix.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume index.",
+		 function );
+
+		return( -1 );
+	}
+	path_length = system_string_length(
+	               path );
+
+	if( ( path_length == 1 )
+	 && ( path[ 0 ] == file_system->path_prefix[ 0 ] ) )
+	{
+		*volume_index = -1;
+
+		return( 1 );
+	}
+	if( ( path_length < file_system->path_prefix_size )
+	 || ( path_length > ( file_system->path_prefix_size + 17 ) ) )
+	{
+		return( 0 );
+	}
+#if defined( WINAPI )
+	result = system_string_compare_no_case(
+	          path,
+	          file_system->path_prefix,
+	          file_system->path_prefix_size - 1 );
+#else
+	result = system_string_compare(
+	          path,
+	          file_system->path_prefix,
+	          file_system->path_prefix_size - 1 );
+#endif
+	if( result != 0 )
+	{
+		return( 0 );
+	}
+	path_index = file_system->path_prefix_size - 1;
+
+	volume_type = MOUNT_FILE_SYSTEM_VOLUME_TYPE_LOGICAL_VOLUME;
+
+	if( path[ path_index ] == (system_character_t) '_' )
+	{
+		if( ( path_length - path_index ) < 3 )
+		{
+			return( 0 );
+		}
+#if defined( WINAPI )
+		result = system_string_compare_no_case(
+		          &( path[ path_index ] ),
+		          _SYSTEM_STRING( "_pv" ),
+		          3 );
+#else
+		result = system_string_compare(
+		          &( path[ path_index ] ),
+		          _SYSTEM_STRING( "_pv" ),
+		          3 );
+#endif
+		if( result != 0 )
+		{
+			return( 0 );
+		}
+		path_index += 3;
+
+		volume_type = MOUNT_FILE_SYSTEM_VOLUME_TYPE_PHYSICAL_VOLUME;
+	}
+	while( path_index < path_length )
+	{
+		character = path[ path_index ];
+
+		if( ( character < (system_character_t) '0' )
+		 || ( character > (system_character_t) '9' ) )
+		{
+			break;
+		}
+		if( number_of_digits >= 3 )
+		{
+			return( 0 );
+		}
+		volume_number *= 10;
+		volume_number += character - (system_character_t) '0';
+
+		number_of_digits++;
+		path_index++;
+	}
+	if( number_of_digits == 0 )
+	{
+		return( 0 );
+	}
+	if( path_index < path_length )
+	{
+		if( ( volume_type != MOUNT_FILE_SYSTEM_VOLUME_TYPE_PHYSICAL_VOLUME )
+		 || ( ( path_length - path_index ) != 12 ) )
+		{
+			return( 0 );
+		}
+#if defined( WINAPI )
+		result = system_string_compare_no_case(
+		          &( path[ path_index ] ),
+		          _SYSTEM_STRING( "_unallocated" ),
+		          12 );
+#else
+		result = system_string_compare(
+		          &( path[ path_index ] ),
+		          _SYSTEM_STRING( "_unallocated" ),
+		          12 );
+#endif
+		if( result != 0 )
+		{
+			return( 0 );
+		}
+		volume_type = MOUNT_FILE_SYSTEM_VOLUME_TYPE_UNALLOCATED;
+	}
+	if( mount_file_system_get_number_of_logical_volumes(
+	     file_system,
+	     &number_of_logical_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of logical volumes.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_file_system_get_number_of_physical_volumes(
+	     file_system,
+	     &number_of_physical_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of physical volumes.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_type == MOUNT_FILE_SYSTEM_VOLUME_TYPE_LOGICAL_VOLUME )
+	{
+		if( ( volume_number < 1 )
+		 || ( volume_number > number_of_logical_volumes ) )
+		{
+			return( 0 );
+		}
+		*volume_index = volume_number - 1;
+	}
+	else
+	{
+		if( ( volume_number < 1 )
+		 || ( volume_number > number_of_physical_volumes ) )
+		{
+			return( 0 );
+		}
+		*volume_index = number_of_logical_volumes + volume_number - 1;
+
+		if( volume_type == MOUNT_FILE_SYSTEM_VOLUME_TYPE_UNALLOCATED )
+		{
+			*volume_index += number_of_physical_volumes;
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the path from a volume index.
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_get_path_from_volume_index(
+     mount_file_system_t *file_system,
+     int volume_index,
+     system_character_t *path,
+     size_t path_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "mount_file_system_get_path_from_volume_index";
+	size_t path_index         = 0;
+	size_t required_path_size = 0;
+	size_t suffix_length      = 0;
+	int result                = 0;
+	int type_index            = 0;
+	int volume_number         = 0;
+	int volume_type           = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->path_prefix == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system - missing path prefix.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = mount_file_system_get_volume_type_by_index(
+	          file_system,
+	          volume_index,
+	          &volume_type,
+	          &type_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume type of volume: %d.",
+		 function,
+		 volume_index );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volume index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	required_path_size = file_system->path_prefix_size;
+
+	if( volume_type != MOUNT_FILE_SYSTEM_VOLUME_TYPE_LOGICAL_VOLUME )
+	{
+		required_path_size += 3;
+	}
+	if( volume_type == MOUNT_FILE_SYSTEM_VOLUME_TYPE_UNALLOCATED )
+	{
+		suffix_length = 12;
+	}
+	required_path_size += suffix_length;
+
+	volume_number = type_index + 1;
+
+	while( volume_number > 0 )
+	{
+		required_path_size++;
+
+		volume_number /= 10;
+	}
+	if( path_size <= required_path_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
 		 "%s: invalid path size value too small.",
 		 function );
 
@@ -758,17 +1577,51 @@ int mount_file_system_get_path_from_logical_volume_index(
 
 		return( -1 );
 	}
-	path_index = required_path_size - 1;
+	if( volume_type != MOUNT_FILE_SYSTEM_VOLUME_TYPE_LOGICAL_VOLUME )
+	{
+		if( system_string_copy(
+		     &( path[ file_system->path_prefix_size - 1 ] ),
+		     _SYSTEM_STRING( "_pv" ),
+		     3 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy physical volume prefix.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( suffix_length > 0 )
+	{
+		if( system_string_copy(
+		     &( path[ required_path_size - suffix_length - 1 ] ),
+		     _SYSTEM_STRING( "_unallocated" ),
+		     suffix_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy unallocated suffix.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	path_index = required_path_size - suffix_length - 1;
 
-	logical_volume_number = logical_volume_index + 1;
+	volume_number = type_index + 1;
 
-	path[ path_index-- ] = 0;
+	path[ required_path_size - 1 ] = 0;
 
-	while( logical_volume_number > 0 )
+	while( volume_number > 0 )
 	{
-		path[ path_index-- ] = (system_character_t) '0' + ( logical_volume_number % 10 );
+		path[ --path_index ] = (system_character_t) '0' + ( volume_number % 10 );
 
-		logical_volume_number /= 10;
+		volume_number /= 10;
 	}
 	return( 1 );
 }
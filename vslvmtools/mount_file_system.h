@@ -25,13 +25,26 @@
 #include <common.h>
 #include <types.h>
 
+#include "vslvmtools_libbfio.h"
 #include "vslvmtools_libcdata.h"
 #include "vslvmtools_libcerror.h"
+#include "vslvmtools_libvslvm.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The volume index of the file system refers to the logical volumes,
+ * followed by the physical volume data areas and the physical volume
+ * unallocated space
+ */
+enum MOUNT_FILE_SYSTEM_VOLUME_TYPES
+{
+	MOUNT_FILE_SYSTEM_VOLUME_TYPE_LOGICAL_VOLUME	= 1,
+	MOUNT_FILE_SYSTEM_VOLUME_TYPE_PHYSICAL_VOLUME	= 2,
+	MOUNT_FILE_SYSTEM_VOLUME_TYPE_UNALLOCATED	= 3
+};
+
 typedef struct mount_file_system mount_file_system_t;
 
 struct mount_file_system
@@ -48,9 +61,28 @@ struct mount_file_system
 	 */
 	uint64_t mounted_timestamp;
 
+	/* The volume group
+	 */
+	libvslvm_volume_group_t *volume_group;
+
+	/* The physical volume file IO pool
+	 * Cloned by every open file entry so that reads of different open file entries
+	 * do not share the lock of the file IO pool
+	 */
+	libbfio_pool_t *physical_volume_file_io_pool;
+
 	/* The logical_volumes array
 	 */
 	libcdata_array_t *logical_volumes_array;
+
+	/* The physical volumes array
+	 */
+	libcdata_array_t *physical_volumes_array;
+
+	/* The data area volumes array
+	 * Contains the data area volume of every physical volume in the physical volumes array
+	 */
+	libcdata_array_t *data_area_volumes_array;
 };
 
 int mount_file_system_initialize(
@@ -67,6 +99,21 @@ int mount_file_system_set_path_prefix(
      size_t path_prefix_size,
      libcerror_error_t **error );
 
+int mount_file_system_set_volume_group(
+     mount_file_system_t *file_system,
+     libvslvm_volume_group_t *volume_group,
+     libcerror_error_t **error );
+
+int mount_file_system_set_physical_volume_file_io_pool(
+     mount_file_system_t *file_system,
+     libbfio_pool_t *physical_volume_file_io_pool,
+     libcerror_error_t **error );
+
+int mount_file_system_get_physical_volume_file_io_pool(
+     mount_file_system_t *file_system,
+     libbfio_pool_t **physical_volume_file_io_pool,
+     libcerror_error_t **error );
+
 int mount_file_system_get_mounted_timestamp(
      mount_file_system_t *file_system,
      uint64_t *mounted_timestamp,
@@ -88,16 +135,58 @@ int mount_file_system_append_logical_volume(
      libvslvm_logical_volume_t *logical_volume,
      libcerror_error_t **error );
 
-int mount_file_system_get_logical_volume_index_from_path(
+int mount_file_system_get_number_of_physical_volumes(
+     mount_file_system_t *file_system,
+     int *number_of_physical_volumes,
+     libcerror_error_t **error );
+
+int mount_file_system_get_physical_volume_by_index(
+     mount_file_system_t *file_system,
+     int physical_volume_index,
+     libvslvm_physical_volume_t **physical_volume,
+     libvslvm_logical_volume_t **data_area_volume,
+     libcerror_error_t **error );
+
+int mount_file_system_append_physical_volume(
+     mount_file_system_t *file_system,
+     libvslvm_physical_volume_t *physical_volume,
+     libvslvm_logical_volume_t *data_area_volume,
+     libcerror_error_t **error );
+
+int mount_file_system_get_number_of_volumes(
+     mount_file_system_t *file_system,
+     int *number_of_volumes,
+     libcerror_error_t **error );
+
+int mount_file_system_get_volume_type_by_index(
+     mount_file_system_t *file_system,
+     int volume_index,
+     int *volume_type,
+     int *type_index,
+     libcerror_error_t **error );
+
+int mount_file_system_get_volume_by_index(
+     mount_file_system_t *file_system,
+     int volume_index,
+     libvslvm_logical_volume_t **volume,
+     libcerror_error_t **error );
+
+int mount_file_system_open_volume_by_index(
+     mount_file_system_t *file_system,
+     int volume_index,
+     libvslvm_logical_volume_t **volume,
+     libcerror_error_t **error );
+
+int mount_file_system_get_volume_index_from_path(
      mount_file_system_t *file_system,
      const system_character_t *path,
      size_t path_length,
-     int *logical_volume_index,
+     int *volume_index,
      libcerror_error_t **error );
 
-int mount_file_system_get_path_from_logical_volume_index(
+int mount_file_system_get_path_from_volume_index(
      mount_file_system_t *file_system,
-     int logical_volume_index,
+     int volume_index,
      system_character_t *path,
      size_t path_size,
      libcerror_error_t **error );
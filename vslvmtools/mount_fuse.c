@@ -19,6 +19,12 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+/* SEEK_DATA and SEEK_HOLE are only defined by glibc if _GNU_SOURCE is defined
+ */
+#if !defined( _GNU_SOURCE )
+#define _GNU_SOURCE 1
+#endif
+
 #include <common.h>
 #include <narrow_string.h>
 #include <types.h>
@@ -309,6 +315,57 @@ int mount_fuse_filldir(
 	return( 1 );
 }
 
+/* Initializes the file system
+ * Returns the private data
+ */
+#if defined( HAVE_LIBFUSE3 )
+void *mount_fuse_init(
+       struct fuse_conn_info *connection_information,
+       struct fuse_config *configuration )
+#else
+void *mount_fuse_init(
+       struct fuse_conn_info *connection_information )
+#endif
+{
+	static char *function = "mount_fuse_init";
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s\n",
+		 function );
+	}
+#endif
+	if( connection_information != NULL )
+	{
+#if defined( HAVE_LIBFUSE3 )
+		/* libfuse derives the maximum number of pages of a request from the maximum write size
+		 * the maximum read size is left at 0 which represents no limit
+		 */
+		connection_information->max_write = MOUNT_FUSE_MAXIMUM_REQUEST_SIZE;
+#endif
+#if defined( HAVE_MOUNT_FUSE_READ_BUF ) && defined( FUSE_CAP_SPLICE_WRITE )
+		/* Allow libfuse to splice the physical volume data into the reply
+		 */
+		if( ( connection_information->capable & FUSE_CAP_SPLICE_WRITE ) != 0 )
+		{
+			connection_information->want |= FUSE_CAP_SPLICE_WRITE;
+		}
+#endif
+	}
+#if defined( HAVE_LIBFUSE3 )
+	if( configuration != NULL )
+	{
+		configuration->kernel_cache     = 1;
+		configuration->attr_timeout     = MOUNT_FUSE_CACHE_TIMEOUT;
+		configuration->entry_timeout    = MOUNT_FUSE_CACHE_TIMEOUT;
+		configuration->negative_timeout = MOUNT_FUSE_CACHE_TIMEOUT;
+	}
+#endif
+	return( vslvmmount_mount_handle );
+}
+
 /* Opens a file or directory
  * Returns 0 if successful or a negative errno value otherwise
  */
@@ -316,9 +373,10 @@ int mount_fuse_open(
      const char *path,
      struct fuse_file_info *file_info )
 {
-	libcerror_error_t *error = NULL;
-	static char *function    = "mount_fuse_open";
-	int result               = 0;
+	libcerror_error_t *error       = NULL;
+	mount_file_entry_t *file_entry = NULL;
+	static char *function          = "mount_fuse_open";
+	int result                     = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -384,7 +442,7 @@ int mount_fuse_open(
 	if( mount_handle_get_file_entry_by_path(
 	     vslvmmount_mount_handle,
 	     path,
-	     (mount_file_entry_t **) &( file_info->fh ),
+	     &file_entry,
 	     &error ) != 1 )
 	{
 		libcerror_error_set(
@@ -399,6 +457,24 @@ int mount_fuse_open(
 
 		goto on_error;
 	}
+	if( mount_file_entry_open(
+	     file_entry,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file entry for path: %s.",
+		 function,
+		 path );
+
+		result = -EIO;
+
+		goto on_error;
+	}
+	file_info->fh = (uint64_t) file_entry;
+
 	return( 0 );
 
 on_error:
@@ -409,6 +485,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( file_entry != NULL )
+	{
+		mount_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
 	return( result );
 }
 
@@ -521,6 +603,501 @@ on_error:
 	return( result );
 }
 
+#if defined( HAVE_MOUNT_FUSE_READ_BUF )
+
+/* Reads a buffer of data at the specified offset into a buffer vector
+ * Data of linear extents on the opened physical volume is referenced by file descriptor,
+ * so that libfuse can pass it to the kernel without copying it through user space,
+ * other data is read into memory. The buffer vector is freed by libfuse
+ * Returns 0 if successful or a negative errno value otherwise
+ */
+int mount_fuse_read_buf(
+     const char *path,
+     struct fuse_bufvec **buffer_vector,
+     size_t size,
+     off_t offset,
+     struct fuse_file_info *file_info )
+{
+	struct fuse_buf *read_buffer           = NULL;
+	struct fuse_bufvec *read_buffer_vector = NULL;
+	libcerror_error_t *error               = NULL;
+	mount_file_entry_t *file_entry         = NULL;
+	static char *function                  = "mount_fuse_read_buf";
+	size64_t contiguous_size               = 0;
+	size64_t file_size                     = 0;
+	size_t read_size                       = 0;
+	ssize_t read_count                     = 0;
+	off64_t file_offset                    = 0;
+	off64_t physical_volume_offset         = 0;
+	int buffer_index                       = 0;
+	int file_descriptor                    = -1;
+	int physical_volume_index              = 0;
+	int result                             = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: %s\n",
+		 function,
+		 path );
+	}
+#endif
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( buffer_vector == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer vector.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( size > (size_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file information.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info->fh == (uint64_t) NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file information - missing file handle.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	file_entry = (mount_file_entry_t *) file_info->fh;
+
+	if( mount_file_entry_get_size(
+	     file_entry,
+	     &file_size,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry size.",
+		 function );
+
+		result = -EIO;
+
+		goto on_error;
+	}
+	if( (size64_t) offset >= file_size )
+	{
+		size = 0;
+	}
+	else if( (size64_t) size > ( file_size - (size64_t) offset ) )
+	{
+		size = (size_t) ( file_size - (size64_t) offset );
+	}
+	/* libfuse frees the buffer vector and its memory buffers with free()
+	 */
+	read_buffer_vector = (struct fuse_bufvec *) memory_allocate(
+	                                             sizeof( struct fuse_bufvec ) + ( sizeof( struct fuse_buf ) * ( MOUNT_FUSE_MAXIMUM_NUMBER_OF_READ_BUFFERS - 1 ) ) );
+
+	if( read_buffer_vector == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer vector.",
+		 function );
+
+		result = -ENOMEM;
+
+		goto on_error;
+	}
+	if( memory_set(
+	     read_buffer_vector,
+	     0,
+	     sizeof( struct fuse_bufvec ) + ( sizeof( struct fuse_buf ) * ( MOUNT_FUSE_MAXIMUM_NUMBER_OF_READ_BUFFERS - 1 ) ) ) == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffer vector.",
+		 function );
+
+		memory_free(
+		 read_buffer_vector );
+
+		read_buffer_vector = NULL;
+
+		result = -ENOMEM;
+
+		goto on_error;
+	}
+	read_buffer_vector->count = 1;
+
+	while( size > 0 )
+	{
+		read_buffer = &( read_buffer_vector->buf[ buffer_index ] );
+		read_size   = size;
+		result      = 0;
+
+		/* The last buffer is used to read the remaining data into memory
+		 */
+		if( buffer_index < ( MOUNT_FUSE_MAXIMUM_NUMBER_OF_READ_BUFFERS - 1 ) )
+		{
+			result = mount_file_entry_get_physical_location(
+			          file_entry,
+			          (off64_t) offset,
+			          &physical_volume_index,
+			          &physical_volume_offset,
+			          &contiguous_size,
+			          &error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve physical location of offset: %" PRIi64 ".",
+				 function,
+				 (int64_t) offset );
+
+				result = -EIO;
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				if( (size64_t) read_size > contiguous_size )
+				{
+					read_size = (size_t) contiguous_size;
+				}
+				result = mount_handle_get_physical_volume_file_descriptor(
+				          vslvmmount_mount_handle,
+				          physical_volume_index,
+				          &file_descriptor,
+				          &file_offset,
+				          &error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 &error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve physical volume: %d file descriptor.",
+					 function,
+					 physical_volume_index );
+
+					result = -EIO;
+
+					goto on_error;
+				}
+			}
+		}
+		if( result != 0 )
+		{
+			read_buffer->flags = FUSE_BUF_IS_FD | FUSE_BUF_FD_SEEK | FUSE_BUF_FD_RETRY;
+			read_buffer->fd    = file_descriptor;
+			read_buffer->pos   = (off_t) ( file_offset + physical_volume_offset );
+		}
+		else
+		{
+			read_buffer->mem = memory_allocate(
+			                    sizeof( uint8_t ) * read_size );
+
+			if( read_buffer->mem == NULL )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create buffer.",
+				 function );
+
+				result = -ENOMEM;
+
+				goto on_error;
+			}
+			read_count = mount_file_entry_read_buffer_at_offset(
+			              file_entry,
+			              read_buffer->mem,
+			              read_size,
+			              (off64_t) offset,
+			              &error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read from file entry.",
+				 function );
+
+				result = -EIO;
+
+				goto on_error;
+			}
+		}
+		read_buffer->size = read_size;
+
+		offset += (off_t) read_size;
+		size   -= read_size;
+
+		buffer_index++;
+
+		read_buffer_vector->count = (size_t) buffer_index;
+	}
+	*buffer_vector = read_buffer_vector;
+
+	return( 0 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_buffer_vector != NULL )
+	{
+		for( buffer_index = 0;
+		     buffer_index < MOUNT_FUSE_MAXIMUM_NUMBER_OF_READ_BUFFERS;
+		     buffer_index++ )
+		{
+			if( read_buffer_vector->buf[ buffer_index ].mem != NULL )
+			{
+				memory_free(
+				 read_buffer_vector->buf[ buffer_index ].mem );
+			}
+		}
+		memory_free(
+		 read_buffer_vector );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_MOUNT_FUSE_READ_BUF ) */
+
+#if defined( HAVE_MOUNT_FUSE_LSEEK )
+
+/* Seeks the next data or hole at or after the specified offset
+ * Data and holes are determined from the extent map of the logical volume,
+ * where the end of the file is considered a hole
+ * Returns the offset if successful or a negative errno value otherwise
+ */
+off_t mount_fuse_lseek(
+       const char *path,
+       off_t offset,
+       int whence,
+       struct fuse_file_info *file_info )
+{
+	libcerror_error_t *error       = NULL;
+	mount_file_entry_t *file_entry = NULL;
+	static char *function          = "mount_fuse_lseek";
+	size64_t data_size             = 0;
+	size64_t file_size             = 0;
+	off64_t data_offset            = 0;
+	off_t result                   = 0;
+	int data_result                = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: %s\n",
+		 function,
+		 path );
+	}
+#endif
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( ( whence != SEEK_DATA )
+	 && ( whence != SEEK_HOLE ) )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file information.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info->fh == (uint64_t) NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file information - missing file handle.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	file_entry = (mount_file_entry_t *) file_info->fh;
+
+	if( mount_file_entry_get_size(
+	     file_entry,
+	     &file_size,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry size.",
+		 function );
+
+		result = -EIO;
+
+		goto on_error;
+	}
+	/* Seeking data or a hole at or beyond the end of the file fails with ENXIO
+	 */
+	if( ( offset < 0 )
+	 || ( (size64_t) offset >= file_size ) )
+	{
+		return( -ENXIO );
+	}
+	data_result = mount_file_entry_seek_data(
+	               file_entry,
+	               (off64_t) offset,
+	               &data_offset,
+	               &data_size,
+	               &error );
+
+	if( data_result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to seek data.",
+		 function );
+
+		result = -EIO;
+
+		goto on_error;
+	}
+	if( whence == SEEK_DATA )
+	{
+		if( data_result == 0 )
+		{
+			return( -ENXIO );
+		}
+		return( (off_t) data_offset );
+	}
+	if( ( data_result == 0 )
+	 || ( data_offset > (off64_t) offset ) )
+	{
+		return( offset );
+	}
+	data_offset += (off64_t) data_size;
+
+	if( (size64_t) data_offset > file_size )
+	{
+		data_offset = (off64_t) file_size;
+	}
+	return( (off_t) data_offset );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_MOUNT_FUSE_LSEEK ) */
+
 /* Releases a file entry
  * Returns 0 if successful or a negative errno value otherwise
  */
@@ -74,6 +74,32 @@ typedef struct stat mount_fuse_stat_t;
 
 #if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
 
+/* The volume data does not change while mounted, hence the kernel can cache
+ * attributes, entries and data for a long time, in seconds
+ */
+#define MOUNT_FUSE_CACHE_TIMEOUT			86400.0
+#define MOUNT_FUSE_CACHE_OPTIONS			"kernel_cache,attr_timeout=86400,entry_timeout=86400,negative_timeout=86400"
+
+/* The maximum size of a request, libfuse caps it to the size of its buffers
+ */
+#define MOUNT_FUSE_MAXIMUM_REQUEST_SIZE			( 1024 * 1024 )
+
+/* The maximum number of buffers used to answer a single read request
+ */
+#define MOUNT_FUSE_MAXIMUM_NUMBER_OF_READ_BUFFERS	16
+
+/* Answering reads with file descriptor buffers requires libfuse 2.9 or later
+ */
+#if ( defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) ) && defined( HAVE_MOUNT_HANDLE_FILE_DESCRIPTOR ) && defined( FUSE_VERSION ) && ( FUSE_VERSION >= 29 )
+#define HAVE_MOUNT_FUSE_READ_BUF
+#endif
+
+/* Seeking data and holes requires libfuse 3.8 or later
+ */
+#if defined( HAVE_LIBFUSE3 ) && defined( FUSE_MAKE_VERSION ) && ( FUSE_VERSION >= FUSE_MAKE_VERSION( 3, 8 ) )
+#define HAVE_MOUNT_FUSE_LSEEK
+#endif
+
 int mount_fuse_set_stat_info(
      mount_fuse_stat_t *stat_info,
      size64_t size,
@@ -91,6 +117,15 @@ int mount_fuse_filldir(
      mount_file_entry_t *file_entry,
      libcerror_error_t **error );
 
+#if defined( HAVE_LIBFUSE3 )
+void *mount_fuse_init(
+       struct fuse_conn_info *connection_information,
+       struct fuse_config *configuration );
+#else
+void *mount_fuse_init(
+       struct fuse_conn_info *connection_information );
+#endif
+
 int mount_fuse_open(
      const char *path,
      struct fuse_file_info *file_info );
@@ -102,6 +137,23 @@ int mount_fuse_read(
      off_t offset,
      struct fuse_file_info *file_info );
 
+#if defined( HAVE_MOUNT_FUSE_READ_BUF )
+int mount_fuse_read_buf(
+     const char *path,
+     struct fuse_bufvec **buffer_vector,
+     size_t size,
+     off_t offset,
+     struct fuse_file_info *file_info );
+#endif
+
+#if defined( HAVE_MOUNT_FUSE_LSEEK )
+off_t mount_fuse_lseek(
+       const char *path,
+       off_t offset,
+       int whence,
+       struct fuse_file_info *file_info );
+#endif
+
 int mount_fuse_release(
      const char *path,
      struct fuse_file_info *file_info );
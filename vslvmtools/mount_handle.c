@@ -26,6 +26,14 @@
 #include <types.h>
 #include <wide_string.h>
 
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
 #include "mount_file_entry.h"
 #include "mount_file_system.h"
 #include "mount_handle.h"
@@ -221,6 +229,8 @@ int mount_handle_initialize(
 
 		goto on_error;
 	}
+	( *mount_handle )->physical_volume_file_descriptor = -1;
+
 	if( mount_file_system_initialize(
 	     &( ( *mount_handle )->file_system ),
 	     error ) != 1 )
@@ -288,6 +298,13 @@ int mount_handle_free(
 
 			result = -1;
 		}
+#if defined( HAVE_MOUNT_HANDLE_FILE_DESCRIPTOR )
+		if( ( *mount_handle )->physical_volume_file_descriptor != -1 )
+		{
+			close(
+			 ( *mount_handle )->physical_volume_file_descriptor );
+		}
+#endif
 		memory_free(
 		 *mount_handle );
 
@@ -494,6 +511,32 @@ int mount_handle_set_offset(
 	return( 1 );
 }
 
+/* Sets if the physical volume data areas and unallocated space should be included
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_set_include_physical_volumes(
+     mount_handle_t *mount_handle,
+     uint8_t include_physical_volumes,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_set_include_physical_volumes";
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	mount_handle->include_physical_volumes = include_physical_volumes;
+
+	return( 1 );
+}
+
 /* Sets the path prefix
  * Returns 1 if successful or -1 on error
  */
@@ -546,7 +589,9 @@ int mount_handle_open(
 	libbfio_handle_t *physical_volume_file_io_handle = NULL;
 	libbfio_pool_t *physical_volume_file_io_pool     = NULL;
 	libvslvm_handle_t *handle                        = NULL;
+	libvslvm_logical_volume_t *data_area_volume      = NULL;
 	libvslvm_logical_volume_t *logical_volume        = NULL;
+	libvslvm_physical_volume_t *physical_volume      = NULL;
 	const system_character_t *basename_end           = NULL;
 	static char *function                            = "mount_handle_open";
 	size_t basename_length                           = 0;
@@ -554,6 +599,8 @@ int mount_handle_open(
 	int entry_index                                  = 0;
 	int logical_volume_index                         = 0;
 	int number_of_logical_volumes                    = 0;
+	int number_of_physical_volumes                   = 0;
+	int physical_volume_index                        = 0;
 
 	if( mount_handle == NULL )
 	{
@@ -804,6 +851,34 @@ int mount_handle_open(
 
 		goto on_error;
 	}
+	if( mount_file_system_set_volume_group(
+	     mount_handle->file_system,
+	     mount_handle->volume_group,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set volume group in file system.",
+		 function );
+
+		goto on_error;
+	}
+	if( mount_file_system_set_physical_volume_file_io_pool(
+	     mount_handle->file_system,
+	     physical_volume_file_io_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set physical volume file IO pool in file system.",
+		 function );
+
+		goto on_error;
+	}
 	if( libvslvm_volume_group_get_number_of_logical_volumes(
 	     mount_handle->volume_group,
 	     &number_of_logical_volumes,
@@ -855,6 +930,89 @@ int mount_handle_open(
 		}
 		logical_volume = NULL;
 	}
+	if( mount_handle->include_physical_volumes != 0 )
+	{
+		if( libvslvm_volume_group_get_number_of_physical_volumes(
+		     mount_handle->volume_group,
+		     &number_of_physical_volumes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of physical volumes.",
+			 function );
+
+			goto on_error;
+		}
+		/* The data area volumes are read through the same physical volume
+		 * file IO pool as the logical volumes
+		 */
+		for( physical_volume_index = 0;
+		     physical_volume_index < number_of_physical_volumes;
+		     physical_volume_index++ )
+		{
+			if( libvslvm_volume_group_get_physical_volume(
+			     mount_handle->volume_group,
+			     physical_volume_index,
+			     &physical_volume,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve physical volume: %d.",
+				 function,
+				 physical_volume_index );
+
+				goto on_error;
+			}
+			if( libvslvm_volume_group_get_data_area_volume(
+			     mount_handle->volume_group,
+			     physical_volume_index,
+			     &data_area_volume,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data area volume of physical volume: %d.",
+				 function,
+				 physical_volume_index );
+
+				goto on_error;
+			}
+			if( mount_file_system_append_physical_volume(
+			     mount_handle->file_system,
+			     physical_volume,
+			     data_area_volume,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append physical volume: %d to file system.",
+				 function,
+				 physical_volume_index );
+
+				goto on_error;
+			}
+			physical_volume  = NULL;
+			data_area_volume = NULL;
+		}
+	}
+#if defined( HAVE_MOUNT_HANDLE_FILE_DESCRIPTOR )
+	/* The file descriptor is only used to pass data to the kernel without copying
+	 * it through user space, if the file cannot be opened reads use the pool
+	 */
+	mount_handle->physical_volume_file_descriptor = open(
+	                                                 filename,
+	                                                 O_RDONLY );
+#endif
 	mount_handle->file_io_handle               = handle_file_io_handle;
 	mount_handle->handle                       = handle;
 	mount_handle->physical_volume_file_io_pool = physical_volume_file_io_pool;
@@ -862,6 +1020,18 @@ int mount_handle_open(
 	return( 1 );
 
 on_error:
+	if( data_area_volume != NULL )
+	{
+		libvslvm_logical_volume_free(
+		 &data_area_volume,
+		 NULL );
+	}
+	if( physical_volume != NULL )
+	{
+		libvslvm_physical_volume_free(
+		 &physical_volume,
+		 NULL );
+	}
 	if( logical_volume != NULL )
 	{
 		libvslvm_logical_volume_free(
@@ -870,6 +1040,16 @@ on_error:
 	}
 	if( mount_handle->volume_group != NULL )
 	{
+		mount_file_system_set_physical_volume_file_io_pool(
+		 mount_handle->file_system,
+		 NULL,
+		 NULL );
+
+		mount_file_system_set_volume_group(
+		 mount_handle->file_system,
+		 NULL,
+		 NULL );
+
 		libvslvm_volume_group_free(
 		 &( mount_handle->volume_group ),
 		 NULL );
@@ -908,10 +1088,14 @@ int mount_handle_close(
      mount_handle_t *mount_handle,
      libcerror_error_t **error )
 {
-	libvslvm_logical_volume_t *logical_volume = NULL;
-	static char *function                     = "mount_handle_close";
-	int logical_volume_index                  = 0;
-	int number_of_logical_volumes             = 0;
+	libvslvm_logical_volume_t *data_area_volume = NULL;
+	libvslvm_logical_volume_t *logical_volume   = NULL;
+	libvslvm_physical_volume_t *physical_volume = NULL;
+	static char *function                       = "mount_handle_close";
+	int logical_volume_index                    = 0;
+	int number_of_logical_volumes               = 0;
+	int number_of_physical_volumes              = 0;
+	int physical_volume_index                   = 0;
 
 	if( mount_handle == NULL )
 	{
@@ -973,6 +1157,98 @@ int mount_handle_close(
 			return( -1 );
 		}
 	}
+	if( mount_file_system_get_number_of_physical_volumes(
+	     mount_handle->file_system,
+	     &number_of_physical_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of physical volumes.",
+		 function );
+
+		return( -1 );
+	}
+	for( physical_volume_index = number_of_physical_volumes - 1;
+	     physical_volume_index >= 0;
+	     physical_volume_index-- )
+	{
+		if( mount_file_system_get_physical_volume_by_index(
+		     mount_handle->file_system,
+		     physical_volume_index,
+		     &physical_volume,
+		     &data_area_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve physical volume: %d.",
+			 function,
+			 physical_volume_index );
+
+			return( -1 );
+		}
+		if( libvslvm_logical_volume_free(
+		     &data_area_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free data area volume: %d.",
+			 function,
+			 physical_volume_index );
+
+			return( -1 );
+		}
+		if( libvslvm_physical_volume_free(
+		     &physical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free physical volume: %d.",
+			 function,
+			 physical_volume_index );
+
+			return( -1 );
+		}
+	}
+	if( mount_file_system_set_physical_volume_file_io_pool(
+	     mount_handle->file_system,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to unset physical volume file IO pool in file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_file_system_set_volume_group(
+	     mount_handle->file_system,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to unset volume group in file system.",
+		 function );
+
+		return( -1 );
+	}
 	if( libvslvm_volume_group_free(
 	     &( mount_handle->volume_group ),
 	     error ) != 1 )
@@ -1038,9 +1314,86 @@ int mount_handle_close(
 
 		return( -1 );
 	}
+#if defined( HAVE_MOUNT_HANDLE_FILE_DESCRIPTOR )
+	if( mount_handle->physical_volume_file_descriptor != -1 )
+	{
+		if( close(
+		     mount_handle->physical_volume_file_descriptor ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close physical volume file descriptor.",
+			 function );
+
+			return( -1 );
+		}
+		mount_handle->physical_volume_file_descriptor = -1;
+	}
+#endif
 	return( 0 );
 }
 
+/* Retrieves the file descriptor of a specific physical volume
+ * The file offset is the offset of the physical volume in the file
+ * Returns 1 if successful, 0 if no file descriptor is available or -1 on error
+ */
+int mount_handle_get_physical_volume_file_descriptor(
+     mount_handle_t *mount_handle,
+     int physical_volume_index,
+     int *file_descriptor,
+     off64_t *file_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_get_physical_volume_file_descriptor";
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only the first physical volume is opened by the mount handle
+	 */
+	if( ( physical_volume_index != 0 )
+	 || ( mount_handle->physical_volume_file_descriptor == -1 ) )
+	{
+		return( 0 );
+	}
+	*file_descriptor = mount_handle->physical_volume_file_descriptor;
+	*file_offset     = mount_handle->volume_offset;
+
+	return( 1 );
+}
+
 /* Retrieves a file entry for a specific path
  * Returns 1 if successful, 0 if no such file entry or -1 on error
  */
@@ -1054,8 +1407,8 @@ int mount_handle_get_file_entry_by_path(
 	const system_character_t *filename        = NULL;
 	static char *function                     = "mount_handle_get_file_entry_by_path";
 	size_t path_length                        = 0;
-	int logical_volume_index                  = 0;
 	int result                                = 0;
+	int volume_index                          = 0;
 
 	if( mount_handle == NULL )
 	{
@@ -1093,11 +1446,11 @@ int mount_handle_get_file_entry_by_path(
 
 		return( -1 );
 	}
-	result = mount_file_system_get_logical_volume_index_from_path(
+	result = mount_file_system_get_volume_index_from_path(
 	          mount_handle->file_system,
 	          path,
 	          path_length,
-	          &logical_volume_index,
+	          &volume_index,
 	          error );
 
 	if( result == -1 )
@@ -1106,7 +1459,7 @@ int mount_handle_get_file_entry_by_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve logical volume index.",
+		 "%s: unable to retrieve volume index.",
 		 function );
 
 		return( -1 );
@@ -1115,11 +1468,11 @@ int mount_handle_get_file_entry_by_path(
 	{
 		return( 0 );
 	}
-	if( logical_volume_index != -1 )
+	if( volume_index != -1 )
 	{
-		if( mount_file_system_get_logical_volume_by_index(
+		if( mount_file_system_get_volume_by_index(
 		     mount_handle->file_system,
-		     logical_volume_index,
+		     volume_index,
 		     &logical_volume,
 		     error ) != 1 )
 		{
@@ -1127,9 +1480,9 @@ int mount_handle_get_file_entry_by_path(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve logical volume: %d.",
+			 "%s: unable to retrieve volume: %d.",
 			 function,
-			 logical_volume_index );
+			 volume_index );
 
 			return( -1 );
 		}
@@ -1139,9 +1492,9 @@ int mount_handle_get_file_entry_by_path(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing logical volume: %d.",
+			 "%s: missing volume: %d.",
 			 function,
-			 logical_volume_index );
+			 volume_index );
 
 			return( -1 );
 		}
@@ -1150,7 +1503,7 @@ int mount_handle_get_file_entry_by_path(
 	if( mount_file_entry_initialize(
 	     file_entry,
 	     mount_handle->file_system,
-	     logical_volume_index,
+	     volume_index,
 	     filename,
 	     error ) != 1 )
 	{
@@ -1158,9 +1511,9 @@ int mount_handle_get_file_entry_by_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to initialize file entry for logical volume: %d.",
+		 "%s: unable to initialize file entry for volume: %d.",
 		 function,
-		 logical_volume_index );
+		 volume_index );
 
 		return( -1 );
 	}
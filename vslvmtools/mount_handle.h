@@ -36,6 +36,12 @@
 extern "C" {
 #endif
 
+/* Passing the physical volume data to the kernel by file descriptor requires open
+ */
+#if defined( HAVE_OPEN ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) && !defined( WINAPI )
+#define HAVE_MOUNT_HANDLE_FILE_DESCRIPTOR
+#endif
+
 typedef struct mount_handle mount_handle_t;
 
 struct mount_handle
@@ -56,6 +62,10 @@ struct mount_handle
 	 */
 	off64_t volume_offset;
 
+	/* Value to indicate the physical volume data areas and unallocated space should be included
+	 */
+	uint8_t include_physical_volumes;
+
 	/* The libbfio file IO handle
 	 */
 	libbfio_handle_t *file_io_handle;
@@ -72,6 +82,10 @@ struct mount_handle
 	 */
 	libvslvm_volume_group_t *volume_group;
 
+	/* The physical volume file descriptor
+	 */
+	int physical_volume_file_descriptor;
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
@@ -110,6 +124,11 @@ int mount_handle_set_offset(
      const system_character_t *string,
      libcerror_error_t **error );
 
+int mount_handle_set_include_physical_volumes(
+     mount_handle_t *mount_handle,
+     uint8_t include_physical_volumes,
+     libcerror_error_t **error );
+
 int mount_handle_set_path_prefix(
      mount_handle_t *mount_handle,
      const system_character_t *path_prefix,
@@ -125,6 +144,13 @@ int mount_handle_close(
      mount_handle_t *mount_handle,
      libcerror_error_t **error );
 
+int mount_handle_get_physical_volume_file_descriptor(
+     mount_handle_t *mount_handle,
+     int physical_volume_index,
+     int *file_descriptor,
+     off64_t *file_offset,
+     libcerror_error_t **error );
+
 int mount_handle_get_file_entry_by_path(
      mount_handle_t *mount_handle,
      const system_character_t *path,
@@ -0,0 +1,537 @@
+/*
+ * Benchmarks reading a Linux Logical Volume Manager (LVM) volume system.
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "bench_handle.h"
+#include "vslvmtools_getopt.h"
+#include "vslvmtools_libcerror.h"
+#include "vslvmtools_libclocale.h"
+#include "vslvmtools_libcnotify.h"
+#include "vslvmtools_libvslvm.h"
+#include "vslvmtools_output.h"
+#include "vslvmtools_signal.h"
+#include "vslvmtools_unused.h"
+
+bench_handle_t *vslvmbench_bench_handle = NULL;
+int vslvmbench_abort                    = 0;
+
+/* Signal handler for vslvmbench
+ */
+void vslvmbench_signal_handler(
+      vslvmtools_signal_t signal VSLVMTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "vslvmbench_signal_handler";
+
+	VSLVMTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	vslvmbench_abort = 1;
+
+	if( vslvmbench_bench_handle != NULL )
+	{
+		if( bench_handle_signal_abort(
+		     vslvmbench_bench_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal bench handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description = \
+		"Use vslvmbench to benchmark opening and reading a logical volume of a Linux Logical Volume\n"
+		"Manager (LVM) volume system.";
+
+	vslvmtools_option_t options[ ] = {
+		{ 'f', "format", "specify the output format of the results, options: text (default),\n"
+		                 "csv or json" },
+		{ 'h', NULL, "shows this help" },
+		{ 'i', "iterations", "specify the number of times the volume system is opened\n"
+		                     "(default is 10)" },
+		{ 'j', "threads", "specify the number of read threads of the multi-threaded read\n"
+		                  "benchmark (default is 4), use 0 to skip the benchmark" },
+		{ 'l', "index", "specify the index of the logical volume to read (default is 0)" },
+		{ 'o', "offset", "specify the volume offset in bytes" },
+		{ 's', "size", "specify the number of bytes to read per read benchmark, e.g. 1GiB\n"
+		               "(default is 64MiB)" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 0, "source", "the source volume" },
+	};
+	system_character_t options_string[ 32 ];
+
+	libvslvm_error_t *error                   = NULL;
+	system_character_t *option_format         = NULL;
+	system_character_t *option_index          = NULL;
+	system_character_t *option_iterations     = NULL;
+	system_character_t *option_offset         = NULL;
+	system_character_t *option_read_size      = NULL;
+	system_character_t *option_threads        = NULL;
+	system_character_t *source                = NULL;
+	char *program                             = "vslvmbench";
+	system_integer_t option                   = 0;
+	int number_of_options                     = (int) ( sizeof( options ) / sizeof( vslvmtools_option_t ) );
+	int result                                = 0;
+	int verbose                               = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "vslvmtools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( vslvmtools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	if( vslvmtools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = vslvmtools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				vslvmtools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'f':
+				option_format = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				vslvmtools_output_version_fprint(
+				 stdout,
+				 program );
+
+				vslvmtools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'i':
+				option_iterations = optarg;
+
+				break;
+
+			case (system_integer_t) 'j':
+				option_threads = optarg;
+
+				break;
+
+			case (system_integer_t) 'l':
+				option_index = optarg;
+
+				break;
+
+			case (system_integer_t) 'o':
+				option_offset = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				option_read_size = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				vslvmtools_output_version_fprint(
+				 stdout,
+				 program );
+
+				vslvmtools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source volume.\n" );
+
+		vslvmtools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	libcnotify_verbose_set(
+	 verbose );
+	libvslvm_notify_set_stream(
+	 stderr,
+	 NULL );
+	libvslvm_notify_set_verbose(
+	 verbose );
+
+	if( bench_handle_initialize(
+	     &vslvmbench_bench_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize bench handle.\n" );
+
+		goto on_error;
+	}
+#if defined( __clang_analyzer__ )
+	__builtin_assume( vslvmbench_bench_handle != NULL );
+#endif
+	if( option_format != NULL )
+	{
+		result = bench_handle_set_output_format(
+		          vslvmbench_bench_handle,
+		          option_format,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set output format.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported output format defaulting to: text.\n" );
+		}
+	}
+	/* The version is not printed with the results in a machine-readable format
+	 * so that the output can be parsed as is
+	 */
+	if( vslvmbench_bench_handle->output_format == BENCH_HANDLE_OUTPUT_FORMAT_TEXT )
+	{
+		vslvmtools_output_version_fprint(
+		 stdout,
+		 program );
+	}
+	if( option_offset != NULL )
+	{
+		if( bench_handle_set_volume_offset(
+		     vslvmbench_bench_handle,
+		     option_offset,
+		     &error ) != 1 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			fprintf(
+			 stderr,
+			 "Unsupported volume offset defaulting to: %" PRIi64 ".\n",
+			 vslvmbench_bench_handle->volume_offset );
+		}
+	}
+	if( option_index != NULL )
+	{
+		result = bench_handle_set_logical_volume_index(
+		          vslvmbench_bench_handle,
+		          option_index,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set logical volume index.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported logical volume index defaulting to: %d.\n",
+			 vslvmbench_bench_handle->logical_volume_index );
+		}
+	}
+	if( option_iterations != NULL )
+	{
+		result = bench_handle_set_number_of_iterations(
+		          vslvmbench_bench_handle,
+		          option_iterations,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of iterations.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of iterations defaulting to: %d.\n",
+			 vslvmbench_bench_handle->number_of_iterations );
+		}
+	}
+	if( option_read_size != NULL )
+	{
+		result = bench_handle_set_read_size(
+		          vslvmbench_bench_handle,
+		          option_read_size,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set read size.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported read size defaulting to: %" PRIu64 ".\n",
+			 vslvmbench_bench_handle->read_size );
+		}
+	}
+	if( option_threads != NULL )
+	{
+		result = bench_handle_set_number_of_threads(
+		          vslvmbench_bench_handle,
+		          option_threads,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of threads.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: %d.\n",
+			 vslvmbench_bench_handle->number_of_threads );
+		}
+	}
+	if( vslvmtools_signal_attach(
+	     vslvmbench_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	result = bench_handle_run(
+	          vslvmbench_bench_handle,
+	          source,
+	          &error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	if( vslvmtools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( result == 1 )
+	{
+		if( bench_handle_results_fprint(
+		     vslvmbench_bench_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print results.\n" );
+
+			goto on_error;
+		}
+	}
+	if( bench_handle_free(
+	     &vslvmbench_bench_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free bench handle.\n" );
+
+		goto on_error;
+	}
+	if( result == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Benchmark: ABORTED\n" );
+
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( vslvmbench_bench_handle != NULL )
+	{
+		bench_handle_free(
+		 &vslvmbench_bench_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,608 @@
+/*
+ * Exports the logical volumes of a Linux Logical Volume Manager (LVM) volume system.
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "export_handle.h"
+#include "vslvmtools_getopt.h"
+#include "vslvmtools_libcerror.h"
+#include "vslvmtools_libclocale.h"
+#include "vslvmtools_libcnotify.h"
+#include "vslvmtools_libvslvm.h"
+#include "vslvmtools_output.h"
+#include "vslvmtools_signal.h"
+#include "vslvmtools_unused.h"
+
+export_handle_t *vslvmexport_export_handle = NULL;
+int vslvmexport_abort                      = 0;
+
+/* Signal handler for vslvmexport
+ */
+void vslvmexport_signal_handler(
+      vslvmtools_signal_t signal VSLVMTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "vslvmexport_signal_handler";
+
+	VSLVMTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	vslvmexport_abort = 1;
+
+	if( vslvmexport_export_handle != NULL )
+	{
+		if( export_handle_signal_abort(
+		     vslvmexport_export_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal export handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description = \
+		"Use vslvmexport to export the logical volumes of a Linux Logical Volume Manager (LVM) volume system.\n"
+		"The physical volumes are read in one sequential sweep ordered by their offset.";
+
+	vslvmtools_option_t options[ ] = {
+		{ 'b', "buffer_size", "specify the size of the read buffer, e.g. 4MiB (default is 1MiB)" },
+		{ 'd', "digest_types", "calculate digest (hash) types of the logical volumes while they\n"
+		                       "are exported, options: md5, sha1, sha256, e.g. md5,sha256" },
+		{ 'e', "hash_file", "write the SHA256 hashes of the logical volume extents and their\n"
+		                    "Merkle tree root hash to the hash file" },
+		{ 'h', NULL, "shows this help" },
+		{ 'i', "previous_hash_file", "export incrementally, only write the extents that changed\n"
+		                             "since the export that wrote the previous hash file" },
+		{ 'j', "threads", "specify the number of write threads (default is 4), use 0 to\n"
+		                  "write from the reading thread" },
+		{ 'n', NULL, "do not write sparse output, write blocks of 0-byte values" },
+		{ 'o', "offset", "specify the volume offset in bytes" },
+		{ 'r', NULL, "copy the logical volume extents kernel-side using reflinks or\n"
+		             "copy_file_range where supported instead of reading them in\n"
+		             "one sweep" },
+		{ 't', "target", "specify the target path prefix of the exported logical volumes,\n"
+		                 "the logical volume number is appended to the prefix (default is lvm)" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 0, "source", "the source volume" },
+	};
+	system_character_t options_string[ 32 ];
+
+	libvslvm_error_t *error                       = NULL;
+	system_character_t *option_buffer_size        = NULL;
+	system_character_t *option_digest_types       = NULL;
+	system_character_t *option_hash_file          = NULL;
+	system_character_t *option_offset             = NULL;
+	system_character_t *option_previous_hash_file = NULL;
+	system_character_t *option_threads            = NULL;
+	system_character_t *option_target             = NULL;
+	system_character_t *source                    = NULL;
+	char *program                                 = "vslvmexport";
+	system_integer_t option                       = 0;
+	size_t option_target_length                   = 0;
+	uint8_t use_kernel_copy                       = 0;
+	uint8_t write_sparse                          = 1;
+	int number_of_options                         = (int) ( sizeof( options ) / sizeof( vslvmtools_option_t ) );
+	int number_of_unsupported_logical_volumes     = 0;
+	int result                                    = 0;
+	int verbose                                   = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "vslvmtools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( vslvmtools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	vslvmtools_output_version_fprint(
+	 stdout,
+	 program );
+
+	if( vslvmtools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = vslvmtools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				vslvmtools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'b':
+				option_buffer_size = optarg;
+
+				break;
+
+			case (system_integer_t) 'd':
+				option_digest_types = optarg;
+
+				break;
+
+			case (system_integer_t) 'e':
+				option_hash_file = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				vslvmtools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'i':
+				option_previous_hash_file = optarg;
+
+				break;
+
+			case (system_integer_t) 'j':
+				option_threads = optarg;
+
+				break;
+
+			case (system_integer_t) 'n':
+				write_sparse = 0;
+
+				break;
+
+			case (system_integer_t) 'o':
+				option_offset = optarg;
+
+				break;
+
+			case (system_integer_t) 'r':
+				use_kernel_copy = 1;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_target = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				vslvmtools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source volume.\n" );
+
+		vslvmtools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	libcnotify_verbose_set(
+	 verbose );
+	libvslvm_notify_set_stream(
+	 stderr,
+	 NULL );
+	libvslvm_notify_set_verbose(
+	 verbose );
+
+	if( export_handle_initialize(
+	     &vslvmexport_export_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize export handle.\n" );
+
+		goto on_error;
+	}
+#if defined( __clang_analyzer__ )
+	__builtin_assume( vslvmexport_export_handle != NULL );
+#endif
+	if( option_offset != NULL )
+	{
+		if( export_handle_set_volume_offset(
+		     vslvmexport_export_handle,
+		     option_offset,
+		     &error ) != 1 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			fprintf(
+			 stderr,
+			 "Unsupported volume offset defaulting to: %" PRIi64 ".\n",
+			 vslvmexport_export_handle->volume_offset );
+		}
+	}
+	if( option_buffer_size != NULL )
+	{
+		result = export_handle_set_buffer_size(
+		          vslvmexport_export_handle,
+		          option_buffer_size,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set buffer size.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported buffer size defaulting to: %" PRIzd ".\n",
+			 vslvmexport_export_handle->buffer_size );
+		}
+	}
+	if( option_threads != NULL )
+	{
+		result = export_handle_set_number_of_threads(
+		          vslvmexport_export_handle,
+		          option_threads,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of threads.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: %d.\n",
+			 vslvmexport_export_handle->number_of_threads );
+		}
+	}
+	if( option_digest_types != NULL )
+	{
+		result = export_handle_set_digest_types(
+		          vslvmexport_export_handle,
+		          option_digest_types,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set digest types.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported digest types: %" PRIs_SYSTEM ".\n",
+			 option_digest_types );
+
+			goto on_error;
+		}
+	}
+	if( option_hash_file != NULL )
+	{
+		if( export_handle_set_extent_hash_filename(
+		     vslvmexport_export_handle,
+		     option_hash_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set hash file.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_previous_hash_file != NULL )
+	{
+		if( export_handle_set_previous_extent_hash_filename(
+		     vslvmexport_export_handle,
+		     option_previous_hash_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set previous hash file.\n" );
+
+			goto on_error;
+		}
+	}
+	vslvmexport_export_handle->write_sparse = write_sparse;
+
+	/* The extent hashes are calculated over the data read by the sweep
+	 */
+	if( ( use_kernel_copy != 0 )
+	 && ( ( option_hash_file != NULL )
+	  || ( option_previous_hash_file != NULL ) ) )
+	{
+		fprintf(
+		 stderr,
+		 "Kernel-side copies not supported with hash files, defaulting to sweep.\n" );
+
+		use_kernel_copy = 0;
+	}
+#if defined( HAVE_EXPORT_HANDLE_KERNEL_COPY )
+	vslvmexport_export_handle->use_kernel_copy = use_kernel_copy;
+#else
+	if( use_kernel_copy != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Kernel-side copies not supported, defaulting to sweep.\n" );
+	}
+#endif
+
+	if( option_target == NULL )
+	{
+		option_target = _SYSTEM_STRING( "lvm" );
+	}
+	option_target_length = system_string_length(
+	                        option_target );
+
+	if( export_handle_set_target_path_prefix(
+	     vslvmexport_export_handle,
+	     option_target,
+	     option_target_length + 1,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set target path prefix.\n" );
+
+		goto on_error;
+	}
+	if( vslvmtools_signal_attach(
+	     vslvmexport_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( export_handle_open_input(
+	     vslvmexport_export_handle,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	result = export_handle_export_logical_volumes(
+	          vslvmexport_export_handle,
+	          &error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to export logical volumes.\n" );
+
+		goto on_error;
+	}
+	number_of_unsupported_logical_volumes = vslvmexport_export_handle->number_of_unsupported_logical_volumes;
+
+	if( vslvmtools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( export_handle_close_input(
+	     vslvmexport_export_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close export handle.\n" );
+
+		goto on_error;
+	}
+	if( export_handle_free(
+	     &vslvmexport_export_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free export handle.\n" );
+
+		goto on_error;
+	}
+	if( result == 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Export: ABORTED\n" );
+
+		return( EXIT_FAILURE );
+	}
+	/* Logical volumes with a layout that is not supported are skipped
+	 * by the export and make it fail
+	 */
+	if( number_of_unsupported_logical_volumes > 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to export: %d logical volume(s) with an unsupported layout.\n",
+		 number_of_unsupported_logical_volumes );
+
+		fprintf(
+		 stdout,
+		 "Export: FAILURE\n" );
+
+		return( EXIT_FAILURE );
+	}
+	fprintf(
+	 stdout,
+	 "Export: SUCCESS\n" );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( vslvmexport_export_handle != NULL )
+	{
+		export_handle_free(
+		 &vslvmexport_export_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
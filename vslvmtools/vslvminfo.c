@@ -111,6 +111,7 @@ int main( int argc, char * const argv[] )
 	vslvmtools_option_t options[ ] = {
 		{ 'h', NULL, "shows this help" },
 		{ 'o', "offset", "specify the volume offset in bytes" },
+		{ 'u', NULL, "shows the unallocated extent runs of the physical volumes" },
 		{ 'v', NULL, "verbose output to stderr" },
 		{ 'V', NULL, "print version" },
 		{ 0, "source", "the source volume" },
@@ -122,6 +123,7 @@ int main( int argc, char * const argv[] )
 	system_character_t *source        = NULL;
 	char *program                     = "vslvminfo";
 	system_integer_t option           = 0;
+	uint8_t print_unallocated         = 0;
 	int number_of_options             = (int) ( sizeof( options ) / sizeof( vslvmtools_option_t ) );
 	int verbose                       = 0;
 
@@ -210,6 +212,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'u':
+				print_unallocated = 1;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -278,6 +285,8 @@ int main( int argc, char * const argv[] )
 			 vslvminfo_info_handle->volume_offset );
 		}
 	}
+	vslvminfo_info_handle->print_unallocated_extent_runs = print_unallocated;
+
 	if( info_handle_open_input(
 	     vslvminfo_info_handle,
 	     source,
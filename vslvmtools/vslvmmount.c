@@ -117,6 +117,12 @@ int main( int argc, char * const argv[] )
 	vslvmtools_option_t options[ ] = {
 		{ 'h', NULL, "shows this help" },
 		{ 'o', "offset", "specify the volume offset in bytes" },
+		{ 'p', NULL, "include the data area and unallocated space of every physical\n"
+		             "volume as files" },
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
+		{ 's', NULL, "handle fuse requests in a single thread, by default requests of\n"
+		             "different open files are handled by multiple threads" },
+#endif
 		{ 'v', NULL, "verbose output to stderr, while vslvmmount will remain running in the foreground" },
 		{ 'V', NULL, "print version" },
 #if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
@@ -134,6 +140,7 @@ int main( int argc, char * const argv[] )
 	system_character_t *source                  = NULL;
 	char *program                               = "vslvmmount";
 	system_integer_t option                     = 0;
+	uint8_t include_physical_volumes            = 0;
 	int number_of_options                       = (int) ( sizeof( options ) / sizeof( vslvmtools_option_t ) );
 	int verbose                                 = 0;
 
@@ -146,6 +153,7 @@ int main( int argc, char * const argv[] )
 	struct fuse_operations vslvmmount_fuse_operations;
 
 	system_character_t *option_extended_options = NULL;
+	int single_threaded                         = 0;
 
 #if defined( HAVE_LIBFUSE3 )
 	/* Need to set this to 1 even if there no arguments, otherwise this causes
@@ -249,6 +257,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'p':
+				include_physical_volumes = 1;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -261,6 +274,11 @@ int main( int argc, char * const argv[] )
 				return( EXIT_SUCCESS );
 
 #if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
+			case (system_integer_t) 's':
+				single_threaded = 1;
+
+				break;
+
 			case (system_integer_t) 'X':
 				option_extended_options = optarg;
 
@@ -355,6 +373,17 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( mount_handle_set_include_physical_volumes(
+	     vslvmmount_mount_handle,
+	     include_physical_volumes,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set include physical volumes.\n" );
+
+		goto on_error;
+	}
 	if( mount_handle_open(
 	     vslvmmount_mount_handle,
 	     source,
@@ -407,6 +436,47 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+#if !defined( HAVE_LIBFUSE3 )
+	/* Before libfuse 3 the kernel cache and timeouts cannot be configured
+	 * by the init callback and are passed as options instead
+	 */
+	if( vslvmmount_fuse_arguments.argc == 0 )
+	{
+		/* This argument is required but ignored
+		 */
+		if( fuse_opt_add_arg(
+		     &vslvmmount_fuse_arguments,
+		     "" ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable add fuse arguments.\n" );
+
+			goto on_error;
+		}
+	}
+	if( fuse_opt_add_arg(
+	     &vslvmmount_fuse_arguments,
+	     "-o" ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable add fuse arguments.\n" );
+
+		goto on_error;
+	}
+	if( fuse_opt_add_arg(
+	     &vslvmmount_fuse_arguments,
+	     MOUNT_FUSE_CACHE_OPTIONS ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable add fuse arguments.\n" );
+
+		goto on_error;
+	}
+#endif /* !defined( HAVE_LIBFUSE3 ) */
+
 	if( memory_set(
 	     &vslvmmount_fuse_operations,
 	     0,
@@ -418,6 +488,7 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	vslvmmount_fuse_operations.init       = &mount_fuse_init;
 	vslvmmount_fuse_operations.open       = &mount_fuse_open;
 	vslvmmount_fuse_operations.read       = &mount_fuse_read;
 	vslvmmount_fuse_operations.release    = &mount_fuse_release;
@@ -427,6 +498,13 @@ int main( int argc, char * const argv[] )
 	vslvmmount_fuse_operations.getattr    = &mount_fuse_getattr;
 	vslvmmount_fuse_operations.destroy    = &mount_fuse_destroy;
 
+#if defined( HAVE_MOUNT_FUSE_READ_BUF )
+	vslvmmount_fuse_operations.read_buf   = &mount_fuse_read_buf;
+#endif
+#if defined( HAVE_MOUNT_FUSE_LSEEK )
+	vslvmmount_fuse_operations.lseek      = &mount_fuse_lseek;
+#endif
+
 #if defined( HAVE_LIBFUSE3 )
 	vslvmmount_fuse_handle = fuse_new(
 	                          &vslvmmount_fuse_arguments,
@@ -496,8 +574,25 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
-	result = fuse_loop(
-	          vslvmmount_fuse_handle );
+	/* Every open file entry has its own logical volume, hence read cursor,
+	 * so requests of different open files can be handled concurrently
+	 */
+	if( single_threaded != 0 )
+	{
+		result = fuse_loop(
+		          vslvmmount_fuse_handle );
+	}
+	else
+	{
+#if defined( HAVE_LIBFUSE3 )
+		result = fuse_loop_mt(
+		          vslvmmount_fuse_handle,
+		          0 );
+#else
+		result = fuse_loop_mt(
+		          vslvmmount_fuse_handle );
+#endif
+	}
 
 	if( result != 0 )
 	{